@@ -0,0 +1,118 @@
+#!/usr/bin/env bash
+#
+# Runs each instance of a test set several times with 1 to MAXTHREADS threads using the settings in
+# settings/deterministic.set and checks that the status, the number of nodes, the primal and dual bounds and the
+# solution are the same in all runs.
+#
+# usage (from the check directory):
+#    ./reproducibility.sh <test> <binary> [maxthreads] [repetitions] [timelimit]
+#
+#    test        - name of the test set in testset/ (e.g., short)
+#    binary      - SCIP-SDP binary, relative to the main directory (e.g., bin/scipsdp)
+#    maxthreads  - maximal number of threads (default: 4)
+#    repetitions - number of runs for each number of threads (default: 2)
+#    timelimit   - time limit in seconds for each run (default: 3600)
+#
+# The number of threads is set for all parallel parts of SCIP-SDP (BLAS, presolving, readers, SDP solver). Values are
+# compared as written by SCIP, i.e., with 15 significant digits. The output of all runs is kept in
+# results/reproducibility.<test>.<pid>. Returns 1 if some run differs from the first run of its instance.
+
+TESTNAME=$1
+BINARY=$2
+MAXTHREADS=${3:-4}
+REPETITIONS=${4:-2}
+TIMELIMIT=${5:-3600}
+
+if test -z "$TESTNAME" || test -z "$BINARY"
+then
+    echo "usage: $0 <test> <binary> [maxthreads] [repetitions] [timelimit]"
+    exit 2
+fi
+
+TESTFILE=testset/$TESTNAME.test
+if test ! -f $TESTFILE
+then
+    echo "Test set file <$TESTFILE> not found."
+    exit 2
+fi
+
+if test ! -x ../$BINARY
+then
+    echo "Binary <../$BINARY> not found."
+    exit 2
+fi
+
+if test $MAXTHREADS -lt 1 || test $REPETITIONS -lt 1
+then
+    echo "The maximal number of threads and the number of repetitions have to be positive."
+    exit 2
+fi
+
+OUTDIR=results/reproducibility.$TESTNAME.$$
+mkdir -p $OUTDIR
+
+NINSTANCES=0
+NDIFFER=0
+
+for INSTANCE in $(cat $TESTFILE)
+do
+    if test ! -f $INSTANCE
+    then
+        echo "Skipping instance <$INSTANCE>: file not found."
+        continue
+    fi
+
+    NAME=$(basename $INSTANCE)
+    REFERENCE=""
+    DIFFER=""
+    NINSTANCES=$((NINSTANCES + 1))
+
+    for ((THREADS = 1; THREADS <= MAXTHREADS; THREADS++))
+    do
+        for ((REP = 1; REP <= REPETITIONS; REP++))
+        do
+            BASE=$OUTDIR/$NAME.t$THREADS.r$REP
+
+            # parameters of parallel parts that are not available (e.g., without OMP) are ignored when loading
+            SETFILE=$BASE.set
+            cp ../settings/deterministic.set $SETFILE
+            echo "limits/time = $TIMELIMIT"                 >> $SETFILE
+            echo "constraints/SDP/threads = $THREADS"       >> $SETFILE
+            echo "constraints/SDP/presolthreads = $THREADS" >> $SETFILE
+            echo "reading/cbfreader/threads = $THREADS"     >> $SETFILE
+            echo "reading/sdpareader/threads = $THREADS"    >> $SETFILE
+            echo "relaxing/SDP/sdpsolverthreads = $THREADS" >> $SETFILE
+
+            ../$BINARY -c "set load $SETFILE read $INSTANCE optimize write solution $BASE.sol quit" > $BASE.out 2>&1
+
+            # everything that has to be reproducible, but no timing information
+            grep -E "^(SCIP Status|Solving Nodes|Primal Bound|Dual Bound) *:" $BASE.out  > $BASE.fingerprint
+            test -f $BASE.sol && cat $BASE.sol                                        >> $BASE.fingerprint
+
+            if test -z "$REFERENCE"
+            then
+                REFERENCE=$BASE.fingerprint
+            elif ! cmp -s $REFERENCE $BASE.fingerprint
+            then
+                DIFFER="$DIFFER t$THREADS.r$REP"
+            fi
+        done
+    done
+
+    if test -z "$DIFFER"
+    then
+        printf "%-40s reproducible\n" $NAME
+    else
+        printf "%-40s differs in runs:%s (compare with $REFERENCE)\n" $NAME "$DIFFER"
+        NDIFFER=$((NDIFFER + 1))
+    fi
+done
+
+echo
+echo "$NDIFFER of $NINSTANCES instances differ between runs (output in $OUTDIR)."
+
+if test $NDIFFER -gt 0
+then
+    exit 1
+fi
+exit 0
@@ -0,0 +1,287 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   SdpLinebuffer.c
+ * @brief  buffer for lines of coordinate entries in input files, which are parsed in parallel
+ * @author SCIP-SDP developers
+ */
+
+#include <assert.h>
+#include <stdlib.h>                     /* for strtol, strtod */
+#include <string.h>                     /* for strlen, memcpy */
+
+#include "scip/scip.h"
+#include "SdpLinebuffer.h"
+
+#ifdef OMP
+#include "omp.h"
+#endif
+
+/* turn off lint warnings for whole file: */
+/*lint --e{788,818}*/
+
+struct Sdplinebuffer
+{
+   char*                 text;               /**< text of all lines, each terminated by '\0' */
+   size_t                textlen;            /**< used length of text */
+   size_t                textsize;           /**< allocated length of text */
+   size_t*               offsets;            /**< start of each line in text */
+   SCIP_Longint*         linenumbers;        /**< number of each line in the file */
+   int                   nlines;             /**< number of lines */
+   int                   linessize;          /**< allocated length of offsets and linenumbers */
+};
+
+/** parses one line consisting of @p nints integers followed by one real value */
+static
+SCIP_Bool parseCoordLine(
+   const char*           line,               /**< line to parse */
+   int                   nints,              /**< number of integers at the beginning of the line */
+   int*                  ints,               /**< array to store the integers */
+   SCIP_Real*            val                 /**< pointer to store the real value */
+   )
+{
+   const char* pos = line;
+   char* endptr;
+   int k;
+
+   /* strtol() and strtod() are thread safe, as opposed to the locking done by sscanf() in some C libraries */
+   for (k = 0; k < nints; ++k)
+   {
+      ints[k] = (int) strtol(pos, &endptr, 10);
+      if ( endptr == pos )
+         return FALSE;
+      pos = endptr;
+   }
+
+   *val = strtod(pos, &endptr);
+
+   return endptr != pos;
+}
+
+/** ensures that the arrays for the lines can store at least one more line */
+static
+SCIP_RETCODE ensureLinesSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer*        linebuffer          /**< line buffer */
+   )
+{
+   if ( linebuffer->nlines >= linebuffer->linessize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, linebuffer->nlines + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &linebuffer->offsets, linebuffer->linessize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &linebuffer->linenumbers, linebuffer->linessize, newsize) );
+      linebuffer->linessize = newsize;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates an empty line buffer */
+SCIP_RETCODE SCIPsdpLinebufferCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer**       linebuffer          /**< pointer to the line buffer that should be created */
+   )
+{
+   assert( scip != NULL );
+   assert( linebuffer != NULL );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, linebuffer) );
+   (*linebuffer)->text = NULL;
+   (*linebuffer)->textlen = 0;
+   (*linebuffer)->textsize = 0;
+   (*linebuffer)->offsets = NULL;
+   (*linebuffer)->linenumbers = NULL;
+   (*linebuffer)->nlines = 0;
+   (*linebuffer)->linessize = 0;
+
+   return SCIP_OKAY;
+}
+
+/** frees the line buffer */
+void SCIPsdpLinebufferFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer**       linebuffer          /**< pointer to the line buffer that should be freed */
+   )
+{
+   assert( scip != NULL );
+   assert( linebuffer != NULL );
+
+   if ( *linebuffer == NULL )
+      return;
+
+   SCIPfreeBlockMemoryArrayNull(scip, &(*linebuffer)->linenumbers, (*linebuffer)->linessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*linebuffer)->offsets, (*linebuffer)->linessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*linebuffer)->text, (*linebuffer)->textsize);
+   SCIPfreeBlockMemory(scip, linebuffer);
+}
+
+/** removes all lines from the line buffer (the memory is kept for the next chunk) */
+void SCIPsdpLinebufferClear(
+   SdpLinebuffer*        linebuffer          /**< line buffer */
+   )
+{
+   assert( linebuffer != NULL );
+
+   linebuffer->textlen = 0;
+   linebuffer->nlines = 0;
+}
+
+/** appends a copy of a line to the line buffer */
+SCIP_RETCODE SCIPsdpLinebufferAppend(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   const char*           line,               /**< line to append (terminated by '\0') */
+   SCIP_Longint          linenumber          /**< number of the line in the file (for error messages) */
+   )
+{
+   size_t len;
+
+   assert( scip != NULL );
+   assert( linebuffer != NULL );
+   assert( line != NULL );
+
+   len = strlen(line) + 1;
+
+   if ( linebuffer->textlen + len > linebuffer->textsize )
+   {
+      size_t newsize;
+
+      newsize = MAX(2 * linebuffer->textsize, linebuffer->textlen + len);
+      newsize = MAX(newsize, 4096);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &linebuffer->text, linebuffer->textsize, newsize) );
+      linebuffer->textsize = newsize;
+   }
+
+   SCIP_CALL( ensureLinesSize(scip, linebuffer) );
+
+   memcpy(linebuffer->text + linebuffer->textlen, line, len);
+   linebuffer->offsets[linebuffer->nlines] = linebuffer->textlen;
+   linebuffer->linenumbers[linebuffer->nlines] = linenumber;
+   linebuffer->textlen += len;
+   ++linebuffer->nlines;
+
+   return SCIP_OKAY;
+}
+
+/** parses a line directly and appends only its line number to the line buffer
+ *
+ *  This is used instead of SCIPsdpLinebufferAppend() and SCIPsdpLinebufferParseCoords() if the lines are parsed by one
+ *  thread, since then the line does not need to be copied. The integers are stored in ints[n * nints], ...,
+ *  ints[n * nints + nints - 1] and the real value in vals[n], where n is the number of lines before the call.
+ */
+SCIP_RETCODE SCIPsdpLinebufferAppendParsed(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   const char*           line,               /**< line to parse (terminated by '\0') */
+   SCIP_Longint          linenumber,         /**< number of the line in the file (for error messages) */
+   int                   nints,              /**< number of integers at the beginning of the line */
+   int*                  ints,               /**< array to store the integers of all lines of the chunk */
+   SCIP_Real*            vals,               /**< array to store the real values of all lines of the chunk */
+   SCIP_Bool*            success             /**< pointer to store whether the line could be parsed */
+   )
+{
+   assert( scip != NULL );
+   assert( linebuffer != NULL );
+   assert( line != NULL );
+   assert( nints >= 0 );
+   assert( ints != NULL || nints == 0 );
+   assert( vals != NULL );
+   assert( success != NULL );
+
+   SCIP_CALL( ensureLinesSize(scip, linebuffer) );
+
+   *success = parseCoordLine(line, nints, &ints[linebuffer->nlines * nints], &vals[linebuffer->nlines]);  /*lint !e679*/
+   linebuffer->offsets[linebuffer->nlines] = 0;
+   linebuffer->linenumbers[linebuffer->nlines] = linenumber;
+   ++linebuffer->nlines;
+
+   return SCIP_OKAY;
+}
+
+/** gets the number of lines in the line buffer */
+int SCIPsdpLinebufferGetNLines(
+   SdpLinebuffer*        linebuffer          /**< line buffer */
+   )
+{
+   assert( linebuffer != NULL );
+
+   return linebuffer->nlines;
+}
+
+/** gets the number in the file of the i-th line in the line buffer */
+SCIP_Longint SCIPsdpLinebufferGetLinenumber(
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   int                   i                   /**< index of the line in the line buffer */
+   )
+{
+   assert( linebuffer != NULL );
+   assert( 0 <= i && i < linebuffer->nlines );
+
+   return linebuffer->linenumbers[i];
+}
+
+/** parses all lines of the line buffer, each consisting of @p nints integers followed by one real value
+ *
+ *  The integers of line i are stored in ints[i * nints], ..., ints[i * nints + nints - 1] and its real value in vals[i].
+ *  Further content of a line is ignored. Returns the index of the first line that could not be parsed or -1 if all lines
+ *  could be parsed. With OpenMP, the lines are parsed by @p nthreads threads.
+ */
+int SCIPsdpLinebufferParseCoords(
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   int                   nints,              /**< number of integers at the beginning of each line */
+   int*                  ints,               /**< array to store the integers (length nlines * nints) */
+   SCIP_Real*            vals,               /**< array to store the real values (length nlines) */
+   int                   nthreads            /**< number of threads to use */
+   )
+{
+   int firsterror;
+   int nlines;
+   int i;
+
+   assert( linebuffer != NULL );
+   assert( nints >= 0 );
+   assert( ints != NULL || nints == 0 );
+   assert( vals != NULL );
+   assert( nthreads >= 1 );
+
+   nlines = linebuffer->nlines;
+   firsterror = nlines;
+
+#ifdef OMP
+#pragma omp parallel for num_threads(nthreads) schedule(static) reduction(min:firsterror)
+#endif
+   for (i = 0; i < nlines; ++i)
+   {
+      if ( ! parseCoordLine(linebuffer->text + linebuffer->offsets[i], nints, &ints[i * nints], &vals[i]) )  /*lint !e679*/
+         firsterror = MIN(firsterror, i);
+   }
+
+   return firsterror < nlines ? firsterror : -1;
+}
@@ -0,0 +1,130 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   SdpLinebuffer.h
+ * @brief  buffer for lines of coordinate entries in input files, which are parsed in parallel
+ * @author SCIP-SDP developers
+ *
+ * The readers collect a chunk of lines of a coordinate section (e.g., HCOORD in CBF files or the block entries in SDPA
+ * files) with SCIPsdpLinebufferAppend() while reading the file sequentially. Since the lines are independent, the
+ * conversion of their numbers with SCIPsdpLinebufferParseCoords() can be distributed over several threads if SCIP-SDP is
+ * compiled with OpenMP. The readers then check and insert the parsed entries in the order of the file, so the result
+ * does not depend on the number of threads.
+ */
+
+#ifndef __SDPLINEBUFFER_H__
+#define __SDPLINEBUFFER_H__
+
+#include "scip/scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Sdplinebuffer SdpLinebuffer;
+
+/** creates an empty line buffer */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsdpLinebufferCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer**       linebuffer          /**< pointer to the line buffer that should be created */
+   );
+
+/** frees the line buffer */
+SCIP_EXPORT
+void SCIPsdpLinebufferFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer**       linebuffer          /**< pointer to the line buffer that should be freed */
+   );
+
+/** removes all lines from the line buffer (the memory is kept for the next chunk) */
+SCIP_EXPORT
+void SCIPsdpLinebufferClear(
+   SdpLinebuffer*        linebuffer          /**< line buffer */
+   );
+
+/** appends a copy of a line to the line buffer */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsdpLinebufferAppend(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   const char*           line,               /**< line to append (terminated by '\0') */
+   SCIP_Longint          linenumber          /**< number of the line in the file (for error messages) */
+   );
+
+/** parses a line directly and appends only its line number to the line buffer
+ *
+ *  This is used instead of SCIPsdpLinebufferAppend() and SCIPsdpLinebufferParseCoords() if the lines are parsed by one
+ *  thread, since then the line does not need to be copied. The integers are stored in ints[n * nints], ...,
+ *  ints[n * nints + nints - 1] and the real value in vals[n], where n is the number of lines before the call.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsdpLinebufferAppendParsed(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   const char*           line,               /**< line to parse (terminated by '\0') */
+   SCIP_Longint          linenumber,         /**< number of the line in the file (for error messages) */
+   int                   nints,              /**< number of integers at the beginning of the line */
+   int*                  ints,               /**< array to store the integers of all lines of the chunk */
+   SCIP_Real*            vals,               /**< array to store the real values of all lines of the chunk */
+   SCIP_Bool*            success             /**< pointer to store whether the line could be parsed */
+   );
+
+/** gets the number of lines in the line buffer */
+SCIP_EXPORT
+int SCIPsdpLinebufferGetNLines(
+   SdpLinebuffer*        linebuffer          /**< line buffer */
+   );
+
+/** gets the number in the file of the i-th line in the line buffer */
+SCIP_EXPORT
+SCIP_Longint SCIPsdpLinebufferGetLinenumber(
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   int                   i                   /**< index of the line in the line buffer */
+   );
+
+/** parses all lines of the line buffer, each consisting of @p nints integers followed by one real value
+ *
+ *  The integers of line i are stored in ints[i * nints], ..., ints[i * nints + nints - 1] and its real value in vals[i].
+ *  Further content of a line is ignored. Returns the index of the first line that could not be parsed or -1 if all lines
+ *  could be parsed. With OpenMP, the lines are parsed by @p nthreads threads.
+ */
+SCIP_EXPORT
+int SCIPsdpLinebufferParseCoords(
+   SdpLinebuffer*        linebuffer,         /**< line buffer */
+   int                   nints,              /**< number of integers at the beginning of each line */
+   int*                  ints,               /**< array to store the integers (length nlines * nints) */
+   SCIP_Real*            vals,               /**< array to store the real values (length nlines) */
+   int                   nthreads            /**< number of threads to use */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
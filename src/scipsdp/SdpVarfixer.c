@@ -31,10 +31,13 @@
  * @author Tristan Gally
  */
 
+#include <stdint.h>
+
 #include "scip/type_misc.h"
 #include "scip/def.h"
 #include "scip/pub_message.h"                /* for debug and error message */
 #include "scip/pub_misc.h" /* for sorting */
+#include "blockmemshell/memory.h"            /* for the radix sort buffers */
 #include "SdpVarfixer.h"
 
 /* turn off lint warnings for whole file: */
@@ -46,9 +49,155 @@
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #include "sorttpllex.c" /*lint !e451*/
 
+/** minimal length of arrays that are sorted by radix sort; shorter arrays are sorted by the comparison sort */
+#define RADIXSORTMINLEN      64
+
+/** number of bits per radix sort pass */
+#define RADIXBITS            8
+
+/** packs a row/col pair into a 64 bit key that has the same lexicographic order */
+#define ROWCOLKEY(r, c)      (((uint64_t) (uint32_t) (r) << 32) | (uint64_t) (uint32_t) (c))
+
+
+/** returns whether the given row and col arrays are sorted lexicographically */
+static
+SCIP_Bool isSortedRowCol(
+   int*                  row,                /**< row indices */
+   int*                  col,                /**< column indices */
+   int                   length              /**< length of the given arrays */
+   )
+{
+   int j;
+
+   for (j = 1; j < length; ++j)
+   {
+      if ( ROWCOLKEY(row[j-1], col[j-1]) > ROWCOLKEY(row[j], col[j]) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** sorts the given row, col and val arrays lexicographically by a least significant digit radix sort
+ *
+ *  Row and column indices are packed into one key, using only as many bits as needed by the largest indices. Passes in
+ *  which all keys have the same digit are skipped. Returns FALSE if no memory for the buffers was available, in which
+ *  case the arrays are unchanged.
+ */
+static
+SCIP_Bool radixSortRowCol(
+   int*                  row,                /**< row indices */
+   int*                  col,                /**< column indices */
+   SCIP_Real*            val,                /**< values */
+   int                   length              /**< length of the given arrays */
+   )
+{
+   uint64_t* keys = NULL;
+   uint64_t* tmpkeys = NULL;
+   SCIP_Real* vals = NULL;
+   SCIP_Real* tmpvals = NULL;
+   uint64_t* swapkeys;
+   SCIP_Real* swapvals;
+   uint64_t colmask;
+   int counts[1 << RADIXBITS];
+   int maxrow = 0;
+   int maxcol = 0;
+   int colbits = 0;
+   int keybits;
+   int shift;
+   int j;
+
+   assert( length > 0 );
+
+   for (j = 0; j < length; ++j)
+   {
+      assert( row[j] >= 0 );
+      assert( col[j] >= 0 );
+      if ( row[j] > maxrow )
+         maxrow = row[j];
+      if ( col[j] > maxcol )
+         maxcol = col[j];
+   }
+
+   while ( ((uint64_t) maxcol >> colbits) > 0 )
+      ++colbits;
+   keybits = colbits;
+   while ( ((uint64_t) maxrow >> (keybits - colbits)) > 0 )
+      ++keybits;
+   colmask = ((uint64_t) 1 << colbits) - 1;
+
+   if ( BMSallocMemoryArray(&keys, length) == NULL || BMSallocMemoryArray(&tmpkeys, length) == NULL
+      || BMSduplicateMemoryArray(&vals, val, length) == NULL || BMSallocMemoryArray(&tmpvals, length) == NULL )
+   {
+      BMSfreeMemoryArrayNull(&tmpvals);
+      BMSfreeMemoryArrayNull(&vals);
+      BMSfreeMemoryArrayNull(&tmpkeys);
+      BMSfreeMemoryArrayNull(&keys);
+      return FALSE;
+   }
+
+   for (j = 0; j < length; ++j)
+      keys[j] = ((uint64_t) row[j] << colbits) | (uint64_t) col[j];
+
+   for (shift = 0; shift < keybits; shift += RADIXBITS)
+   {
+      int sum = 0;
+      int d;
+
+      BMSclearMemoryArray(counts, 1 << RADIXBITS);
+      for (j = 0; j < length; ++j)
+         ++counts[(keys[j] >> shift) & ((1 << RADIXBITS) - 1)];
+
+      /* skip pass if all keys have the same digit */
+      if ( counts[(keys[0] >> shift) & ((1 << RADIXBITS) - 1)] == length )
+         continue;
+
+      /* compute starting positions of the digits */
+      for (d = 0; d < (1 << RADIXBITS); ++d)
+      {
+         int cnt = counts[d];
+         counts[d] = sum;
+         sum += cnt;
+      }
+
+      /* stable distribution of keys and values */
+      for (j = 0; j < length; ++j)
+      {
+         int pos = counts[(keys[j] >> shift) & ((1 << RADIXBITS) - 1)]++;
+         tmpkeys[pos] = keys[j];
+         tmpvals[pos] = vals[j];
+      }
+
+      swapkeys = keys;
+      keys = tmpkeys;
+      tmpkeys = swapkeys;
+      swapvals = vals;
+      vals = tmpvals;
+      tmpvals = swapvals;
+   }
+
+   /* unpack keys */
+   for (j = 0; j < length; ++j)
+   {
+      row[j] = (int) (keys[j] >> colbits);
+      col[j] = (int) (keys[j] & colmask);
+   }
+   BMScopyMemoryArray(val, vals, length);
+
+   BMSfreeMemoryArray(&tmpvals);
+   BMSfreeMemoryArray(&vals);
+   BMSfreeMemoryArray(&tmpkeys);
+   BMSfreeMemoryArray(&keys);
+
+   return TRUE;
+}
+
 
 /** sort the given row, col and val arrays lexicographically, that is, sort them first by non-decreasing row-indices,
  *  then for those with identical row-indices by non-decreasing col-indices
+ *
+ *  Arrays that are already sorted are detected in a linear pass and left unchanged. Long arrays are sorted by a radix sort
+ *  on packed row/col keys, short arrays by a comparison sort.
  */
 void SCIPsdpVarfixerSortRowCol(
    int*                  row,                /**< row indices */
@@ -57,7 +206,11 @@ void SCIPsdpVarfixerSortRowCol(
    int                   length              /**< length of the given arrays */
    )
 {
-   SCIPlexSortIntIntReal(row, col, val, length);
+   if ( isSortedRowCol(row, col, length) )
+      return;
+
+   if ( length < RADIXSORTMINLEN || ! radixSortRowCol(row, col, val, length) )
+      SCIPlexSortIntIntReal(row, col, val, length);
 
 #ifndef NDEBUG
    {
@@ -71,6 +224,51 @@ void SCIPsdpVarfixerSortRowCol(
 #endif
 }
 
+/** sorts the given row, col and val arrays and combines entries with the same row and col
+ *
+ *  The arrays are sorted as in SCIPsdpVarfixerSortRowCol(); afterwards, the values of all entries with identical row/col
+ *  combination are added together into a single entry, which is only kept if its absolute value is bigger than epsilon.
+ */
+void SCIPsdpVarfixerSortAndCombine(
+   SCIP_Real             epsilon,            /**< only values bigger than this are counted as nonzeros */
+   int*                  row,                /**< row indices */
+   int*                  col,                /**< column indices */
+   SCIP_Real*            val,                /**< values */
+   int*                  length              /**< length of the given arrays, will be updated to the length after combining */
+   )
+{
+   int ind;
+   int i;
+
+   assert( length != NULL );
+   assert( *length == 0 || (row != NULL && col != NULL && val != NULL) );
+
+   SCIPsdpVarfixerSortRowCol(row, col, val, *length);
+
+   /* traverse the sorted arrays and collect the sum of each row/col combination at position ind */
+   ind = 0;
+   i = 0;
+   while (i < *length)
+   {
+      row[ind] = row[i];
+      col[ind] = col[i];
+      val[ind] = val[i];
+      ++i;
+
+      while (i < *length && row[i] == row[ind] && col[i] == col[ind])
+      {
+         val[ind] += val[i];
+         ++i;
+      }
+
+      /* keep the entry only if the values did not cancel each other out */
+      if ( REALABS(val[ind]) > epsilon )
+         ++ind;
+   }
+
+   *length = ind;
+}
+
 /** merges two three-tuple-arrays together
  *
  *  The original arrays (which may have multiple entries for the same row and col) will be mulitplied with
@@ -105,6 +303,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArrays(
    int naddednonz;  /* this gives the number of nonzeros that were added to the end of the arrays (this does NOT include those that were added in
                      * the middle of the arrays by decreasing the number of leftshifts) */
    int insertionpos;
+   uint64_t originkey;
    SCIP_Bool debugmsg; /* should a debug message about insufficient length be thrown */
 
    assert ( blkmem != NULL );
@@ -126,14 +325,16 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArrays(
    nleftshifts = 0;
    debugmsg = FALSE;
 
-   /* iterate over all nonzeroes */
+   /* iterate over all nonzeroes; row and col are compared via packed keys */
    for (i = 0; i < originlength; i++)
    {
+      originkey = ROWCOLKEY(originrow[i], origincol[i]);
+
       /* search the target arrays for an entry at this position, as both the origin and the target arrays are sorted, we go on until
        * we find an entry that is not < as the current entry in the origin arrays according to this sorting, if this has equal row/col,
        * we have found the entry we have to edit, if it is >, then we know, that there is no identical entry, and we can just add a new
        * entry for this row and col */
-      while (ind < *targetlength && (targetrow[ind] < originrow[i] || (targetrow[ind] == originrow[i] && targetcol[ind] < origincol[i])))
+      while (ind < *targetlength && ROWCOLKEY(targetrow[ind], targetcol[ind]) < originkey)
       {
          /* shift the target nonzeros to the left if needed */
          if ( nleftshifts > 0 )
@@ -145,7 +346,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArrays(
          ind++;
       }
 
-      if ( ind < *targetlength && (targetrow[ind] == originrow[i] && targetcol[ind] == origincol[i]) )
+      if ( ind < *targetlength && ROWCOLKEY(targetrow[ind], targetcol[ind]) == originkey )
       {
          /* add to the old entry */
 
@@ -159,7 +360,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArrays(
 
          /* there could be multiple entries to add with identical row and col, so look for further ones in the next entries until there
           * are no more */
-         while (i + 1 < originlength && originrow[i + 1] == targetrow[ind - nleftshifts] && origincol[i + 1] == targetcol[ind - nleftshifts])
+         while (i + 1 < originlength && ROWCOLKEY(originrow[i + 1], origincol[i + 1]) == originkey)
          {
             targetval[ind - nleftshifts] += scalar * originval[i + 1];
             i++;
@@ -195,7 +396,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArrays(
             targetval[insertionpos] = scalar * originval[i];
 
             /* there could be multiple entries to add with identical row and col, so look for further ones in the next entries until there are no more */
-            while (i + 1 < originlength && originrow[i + 1] == targetrow[insertionpos] && origincol[i + 1] == targetcol[insertionpos])
+            while (i + 1 < originlength && ROWCOLKEY(originrow[i + 1], origincol[i + 1]) == originkey)
             {
                targetval[insertionpos] += scalar * originval[i + 1];
                i++;
@@ -252,10 +453,12 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
    int*                  firstcol,           /**< first column-index-array that is going to be merged, may be NULL if firstlength = 0 */
    SCIP_Real*            firstval,           /**< first nonzero-values-array that is going to be merged, may be NULL if firstlength = 0 */
    int                   firstlength,        /**< length of the first arrays */
+   SCIP_Bool             firstsorted,        /**< are the first arrays already sorted by non-decreasing row and in case of ties col */
    int*                  secondrow,          /**< second row-index-array that is going to be merged, may be NULL if secondlength = 0 */
    int*                  secondcol,          /**< second column-index-array that is going to be merged, may be NULL if secondlength = 0 */
    SCIP_Real*            secondval,          /**< second nonzero-values-array that is going to be merged, may be NULL if secondlength = 0 */
    int                   secondlength,       /**< length of the second arrays */
+   SCIP_Bool             secondsorted,       /**< are the second arrays already sorted by non-decreasing row and in case of ties col */
    int*                  targetrow,          /**< row-index-array the original arrays will be merged into */
    int*                  targetcol,          /**< column-index-array the original arrays will be merged into */
    SCIP_Real*            targetval,          /**< nonzero-values-array the original arrays will be merged into */
@@ -266,6 +469,8 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
    int firstind;
    int secondind;
    int targetind;
+   uint64_t firstkey;
+   uint64_t secondkey;
    SCIP_Bool debugmsg; /* should we throw a debug message about insufficient memory */
 
    assert ( blkmem != NULL );
@@ -280,8 +485,10 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
    debugmsg = FALSE;
 
    /* sort both arrays by non-decreasing row and then col indices to make comparisons easier */
-   SCIPsdpVarfixerSortRowCol(firstrow, firstcol, firstval, firstlength);
-   SCIPsdpVarfixerSortRowCol(secondrow, secondcol, secondval, secondlength);
+   if ( ! firstsorted )
+      SCIPsdpVarfixerSortRowCol(firstrow, firstcol, firstval, firstlength);
+   if ( ! secondsorted )
+      SCIPsdpVarfixerSortRowCol(secondrow, secondcol, secondval, secondlength);
 
    /* as both arrays are sorted, traverse them simultanously, always adding the current entry with the lower index of either array to the
     * target arrays (if they both have the same index, we have found entries that need to be merged) */
@@ -291,9 +498,12 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
 
    while (firstind < firstlength && secondind < secondlength)
    {
+      firstkey = ROWCOLKEY(firstrow[firstind], firstcol[firstind]);
+      secondkey = ROWCOLKEY(secondrow[secondind], secondcol[secondind]);
+
       /* if the next entry of the first arrays comes before the next entry of the second arrays according to the row then col sorting, then we can
        * insert the next entry of the first arrays, as there can't be an entry in the second arrays for the same row/col-combination */
-      if ( firstrow[firstind] < secondrow[secondind] || (firstrow[firstind] == secondrow[secondind] && firstcol[firstind] < secondcol[secondind]) )
+      if ( firstkey < secondkey )
       {
          if ( targetind < *targetlength )
          {
@@ -308,7 +518,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
          firstind++;
       }
       /* if the next entry of the second array comes first, we insert it */
-      else if ( firstrow[firstind] > secondrow[secondind] || (firstrow[firstind] == secondrow[secondind] && firstcol[firstind] > secondcol[secondind]) )
+      else if ( firstkey > secondkey )
       {
          if ( targetind < *targetlength )
          {
@@ -322,7 +532,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
 
          /* as the second arrays may have duplicate entries, we have to check the next entry, if it has the same row/col combination, if yes, then we
           * add it's value to the created entry in the target entries and continue */
-         while (secondind < secondlength && (secondrow[secondind] == targetrow[targetind] && secondcol[secondind] == targetcol[targetind]))
+         while (secondind < secondlength && ROWCOLKEY(secondrow[secondind], secondcol[secondind]) == secondkey)
          {
             if ( targetind < *targetlength )
                targetval[targetind] += secondval[secondind];
@@ -350,7 +560,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
 
          /* as the second arrays may have duplicate entries, we have to check the next entry, if it has the same row/col combination, if yes, then we
           * add it's value to the created entry in the target entries and continue */
-         while (secondind < secondlength && (secondrow[secondind] == targetrow[targetind] && secondcol[secondind] == targetcol[targetind]))
+         while (secondind < secondlength && ROWCOLKEY(secondrow[secondind], secondcol[secondind]) == secondkey)
          {
             if ( targetind < *targetlength )
                targetval[targetind] += secondval[secondind];
@@ -382,6 +592,8 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
 
    while (secondind < secondlength)
    {
+      secondkey = ROWCOLKEY(secondrow[secondind], secondcol[secondind]);
+
       if ( targetind < *targetlength )
       {
          targetrow[targetind] = secondrow[secondind];
@@ -394,7 +606,7 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
 
       /* as the second arrays may have duplicate entries, we have to check the next entry, if it has the same row/col combination, if yes, then we
        * add it's value to the created entry in the target entries and continue */
-      while (secondind < secondlength && (secondrow[secondind] == targetrow[targetind] && secondcol[secondind] == targetcol[targetind]))
+      while (secondind < secondlength && ROWCOLKEY(secondrow[secondind], secondcol[secondind]) == secondkey)
       {
          if ( targetind < *targetlength )
             targetval[targetind] += secondval[secondind];
@@ -51,6 +51,20 @@ void SCIPsdpVarfixerSortRowCol(
    int                   length              /* length of the given arrays */
    );
 
+/** sorts the given row, col and val arrays and combines entries with the same row and col
+ *
+ *  The arrays are sorted as in SCIPsdpVarfixerSortRowCol(); afterwards, the values of all entries with identical row/col
+ *  combination are added together into a single entry, which is only kept if its absolute value is bigger than epsilon.
+ */
+SCIP_EXPORT
+void SCIPsdpVarfixerSortAndCombine(
+   SCIP_Real             epsilon,            /**< only values bigger than this are counted as nonzeros */
+   int*                  row,                /**< row indices */
+   int*                  col,                /**< column indices */
+   SCIP_Real*            val,                /**< values */
+   int*                  length              /**< length of the given arrays, will be updated to the length after combining */
+   );
+
 /** merges two three-tuple-arrays together
  *
  *  The original arrays (which may have multiple entries for the same row and col) will be mulitplied with
@@ -94,10 +108,12 @@ SCIP_RETCODE SCIPsdpVarfixerMergeArraysIntoNew(
    int*                  firstcol,           /** first column-index-array that is going to be merged, may be NULL if firstlength = 0 */
    SCIP_Real*            firstval,           /** first nonzero-values-array that is going to be merged, may be NULL if firstlength = 0 */
    int                   firstlength,        /** length of the first arrays */
+   SCIP_Bool             firstsorted,        /** are the first arrays already sorted by non-decreasing row and in case of ties col */
    int*                  secondrow,          /** second row-index-array that is going to be merged, may be NULL if secondlength = 0 */
    int*                  secondcol,          /** second column-index-array that is going to be merged, may be NULL if secondlength = 0 */
    SCIP_Real*            secondval,          /** second nonzero-values-array that is going to be merged, may be NULL if secondlength = 0 */
    int                   secondlength,       /** length of the second arrays */
+   SCIP_Bool             secondsorted,       /** are the second arrays already sorted by non-decreasing row and in case of ties col */
    int*                  targetrow,          /** row-index-array the original arrays will be merged into */
    int*                  targetcol,          /** column-index-array the original arrays will be merged into */
    SCIP_Real*            targetval,          /** nonzero-values-array the original arrays will be merged into */
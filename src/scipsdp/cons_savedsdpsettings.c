@@ -50,16 +50,27 @@
                                          *   propagation and enforcement, -1 for no eager evaluations, 0 for first only */
 #define CONSHDLR_NEEDSCONS         TRUE /**< should the constraint handler be skipped, if no constraints are available? */
 
+#define INITNODEMAPSIZE             100 /**< initial size of the hash map from node numbers to constraints */
+
 /** constraint data to store settings used to solve parent node */
 struct SCIP_ConsData
 {
+   SCIP_Longint          node;               /**< index of the node the settings belong to */
    SCIP_SDPSOLVERSETTING settings;           /**< pointer to save settings */
 };
 
+/** constraint handler data */
+struct SCIP_ConshdlrData
+{
+   SCIP_HASHMAP*         nodeconss;          /**< hash map from node numbers to the last Savedsdpsettings constraint created for the node */
+};
+
 /** frees specific constraint data */
 static
 SCIP_DECL_CONSDELETE(consDeleteSavedsdpsettings)
 {  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
    assert( scip != NULL );
    assert( conshdlr != NULL );
    assert( cons != NULL );
@@ -68,12 +79,41 @@ SCIP_DECL_CONSDELETE(consDeleteSavedsdpsettings)
 
    SCIPdebugMsg(scip, "Deleting store node data constraint: <%s>.\n", SCIPconsGetName(cons));
 
+   /* remove constraint from node map if it is the one stored for its node */
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   assert( conshdlrdata->nodeconss != NULL );
+   if ( SCIPhashmapGetImage(conshdlrdata->nodeconss, (void*) (size_t) (*consdata)->node) == (void*) cons )
+   {
+      SCIP_CALL( SCIPhashmapRemove(conshdlrdata->nodeconss, (void*) (size_t) (*consdata)->node) );
+   }
+
    SCIPfreeBlockMemory(scip, consdata);
 
    return SCIP_OKAY;
 }
 
 
+/** destructor of constraint handler to free constraint handler data (called when SCIP is exiting) */
+static
+SCIP_DECL_CONSFREE(consFreeSavedsdpsettings)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   SCIPhashmapFree(&conshdlrdata->nodeconss);
+   SCIPfreeBlockMemory(scip, &conshdlrdata);
+   SCIPconshdlrSetData(conshdlr, NULL);
+
+   return SCIP_OKAY;
+}
+
+
 /** constraint enforcing method of constraint handler for LP solutions */
 static
 SCIP_DECL_CONSENFOLP(consEnfolpSavedsdpsettings)
@@ -174,13 +214,18 @@ static
 SCIP_DECL_CONSCOPY(consCopySavedsdpsettings)
 {  /*lint --e{715}*/
 
+   SCIP_CONSDATA* sourcedata;
+
+   sourcedata = SCIPconsGetData(sourcecons);
+   assert( sourcedata != NULL );
+
    if ( name )
    {
-      SCIP_CALL( createConsSavedsdpsettings(scip, cons, name, SCIPconsSavedsdpsettingsGetSettings(sourcescip, sourcecons)) );
+      SCIP_CALL( createConsSavedsdpsettings(scip, cons, name, sourcedata->node, sourcedata->settings) );
    }
    else
    {
-      SCIP_CALL( createConsSavedsdpsettings(scip, cons, SCIPconsGetName(sourcecons), SCIPconsSavedsdpsettingsGetSettings(sourcescip, sourcecons)) );
+      SCIP_CALL( createConsSavedsdpsettings(scip, cons, SCIPconsGetName(sourcecons), sourcedata->node, sourcedata->settings) );
    }
 
    *valid = TRUE;
@@ -193,17 +238,23 @@ SCIP_RETCODE SCIPincludeConshdlrSavedsdpsettings(
    SCIP*                 scip                /**< SCIP data structure */
    )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata = NULL;
    SCIP_CONSHDLR* conshdlr;
 
+   /* create constraint handler data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &conshdlrdata) );
+   SCIP_CALL( SCIPhashmapCreate(&conshdlrdata->nodeconss, SCIPblkmem(scip), INITNODEMAPSIZE) );
+
    /* include constraint handler */
    conshdlr = NULL;
    SCIP_CALL( SCIPincludeConshdlrBasic(scip, &conshdlr, CONSHDLR_NAME, CONSHDLR_DESC,
          CONSHDLR_ENFOPRIORITY, CONSHDLR_CHECKPRIORITY, CONSHDLR_EAGERFREQ, CONSHDLR_NEEDSCONS,
          consEnfolpSavedsdpsettings, consEnfopsSavedsdpsettings, consCheckSavedsdpsettings, consLockSavedsdpsettings,
-         NULL) );
+         conshdlrdata) );
    assert( conshdlr != NULL );
 
    /* set additional callbacks */
+   SCIP_CALL( SCIPsetConshdlrFree(scip, conshdlr, consFreeSavedsdpsettings) );
    SCIP_CALL( SCIPsetConshdlrDelete(scip, conshdlr, consDeleteSavedsdpsettings) );
    SCIP_CALL( SCIPsetConshdlrEnforelax(scip, conshdlr, consEnforelaxSavedsdpsettings) );
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopySavedsdpsettings, consCopySavedsdpsettings) );
@@ -222,9 +273,11 @@ SCIP_RETCODE createConsSavedsdpsettings(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONS**           cons,               /**< pointer to hold the created constraint */
    const char*           name,               /**< name of constraint */
+   SCIP_Longint          node,               /**< index of the node the settings belong to */
    SCIP_SDPSOLVERSETTING settings            /**< settings to save */
    )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata = NULL;
    SCIP_CONSHDLR* conshdlr;
 
@@ -241,6 +294,7 @@ SCIP_RETCODE createConsSavedsdpsettings(
 
    /* create constraint data */
    SCIP_CALL( SCIPallocBlockMemory(scip, &consdata) );
+   consdata->node = node;
    consdata->settings = settings;
 
    SCIPdebugMsg(scip, "Creating savedsdpsettings constraint <%s>.\n", name);
@@ -249,9 +303,31 @@ SCIP_RETCODE createConsSavedsdpsettings(
    SCIP_CALL( SCIPcreateCons(scip, cons, name, conshdlr, consdata, FALSE, FALSE, FALSE, FALSE, FALSE,
          TRUE, FALSE, TRUE, FALSE, TRUE));
 
+   /* store the constraint for its node; a later constraint for the same node replaces the earlier one */
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   SCIP_CALL( SCIPhashmapSetImage(conshdlrdata->nodeconss, (void*) (size_t) node, (void*) *cons) );
+
    return SCIP_OKAY;
 }
 
+/** returns the last created Savedsdpsettings constraint for the given node, or NULL if there is none */
+SCIP_CONS* SCIPconshdlrSavedsdpsettingsGetNodeCons(
+   SCIP_CONSHDLR*        conshdlr,           /**< Savedsdpsettings constraint handler */
+   SCIP_Longint          node                /**< index of the node */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   return (SCIP_CONS*) SCIPhashmapGetImage(conshdlrdata->nodeconss, (void*) (size_t) node);
+}
+
 /** get the settings used to solve the SDP relaxation in this node */
 SCIP_SDPSOLVERSETTING SCIPconsSavedsdpsettingsGetSettings(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -56,9 +56,17 @@ SCIP_RETCODE createConsSavedsdpsettings(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONS**           cons,               /**< pointer to hold the created constraint */
    const char*           name,               /**< name of constraint */
+   SCIP_Longint          node,               /**< index of the node the settings belong to */
    SCIP_SDPSOLVERSETTING settings            /**< settings to save */
    );
 
+/** returns the last created Savedsdpsettings constraint for the given node, or NULL if there is none */
+SCIP_EXPORT
+SCIP_CONS* SCIPconshdlrSavedsdpsettingsGetNodeCons(
+   SCIP_CONSHDLR*        conshdlr,           /**< Savedsdpsettings constraint handler */
+   SCIP_Longint          node                /**< index of the node */
+   );
+
 /** get the settings used to solve the SDP relaxation in this node */
 SCIP_EXPORT
 SCIP_SDPSOLVERSETTING SCIPconsSavedsdpsettingsGetSettings(
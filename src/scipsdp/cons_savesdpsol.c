@@ -49,6 +49,8 @@
                                          *   propagation and enforcement, -1 for no eager evaluations, 0 for first only */
 #define CONSHDLR_NEEDSCONS         TRUE /**< should the constraint handler be skipped, if no constraints are available? */
 
+#define INITNODEMAPSIZE             100 /**< initial size of the hash map from node numbers to constraints */
+
 /** constraint data to store solution */
 struct SCIP_ConsData
 {
@@ -56,18 +58,65 @@ struct SCIP_ConsData
    SCIP_SOL*             sol;                /**< optimal solution for SDP-relaxation of this node; TODO: change to array*/
    SCIP_Real             maxprimalentry;     /**< maximal absolute value of primal matrix */
    int                   nlpcons;            /**< number of LP constraints of solution */
+   int*                  lprowinds;          /**< indices (SCIProwGetIndex()) of the LP rows of the solution (or NULL if nlpcons == 0) */
    int                   nblocks;            /**< number of blocks INCLUDING lp-block */
    int*                  startXnblocknonz;   /**< starting point primal matrix X: number of nonzeros for each block (or NULL if nblocks == 0) */
    int**                 startXrow;          /**< starting point primal matrix X: row indices for each block (or NULL if nblocks = 0) */
    int**                 startXcol;          /**< starting point primal matrix X: column indices for each block (or NULL if nblocks = 0) */
    SCIP_Real**           startXval;          /**< starting point primal matrix X: values for each block (or NULL if nblocks = 0) */
+   SCIP_Longint          memory;             /**< number of bytes used by this constraint data (including the solution) */
+};
+
+/** constraint handler data */
+struct SCIP_ConshdlrData
+{
+   SCIP_HASHMAP*         nodeconss;          /**< hash map from node numbers to the last Savesdpsol constraint created for the node */
+   SCIP_Longint          memory;             /**< number of bytes currently used by the data of all Savesdpsol constraints */
+   SCIP_Longint          peakmemory;         /**< maximal number of bytes used by the data of all Savesdpsol constraints */
 };
 
+/** frees the saved solution of a constraint; the constraint data itself is kept */
+static
+SCIP_RETCODE freeSolutionData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata            /**< constraint data */
+   )
+{
+   int b;
+
+   assert( scip != NULL );
+   assert( consdata != NULL );
+
+   for (b = 0; b < consdata->nblocks; b++)
+   {
+      assert( consdata->startXnblocknonz != NULL );
+      SCIPfreeBlockMemoryArray(scip, &consdata->startXval[b], consdata->startXnblocknonz[b]);
+      SCIPfreeBlockMemoryArray(scip, &consdata->startXcol[b], consdata->startXnblocknonz[b]);
+      SCIPfreeBlockMemoryArray(scip, &consdata->startXrow[b], consdata->startXnblocknonz[b]);
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->startXval, consdata->nblocks);
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->startXcol, consdata->nblocks);
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->startXrow, consdata->nblocks);
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->startXnblocknonz, consdata->nblocks);
+   consdata->nblocks = 0;
+
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->lprowinds, consdata->nlpcons);
+   consdata->nlpcons = 0;
+
+   if ( consdata->sol != NULL )
+   {
+      SCIP_CALL( SCIPfreeSol(scip, &consdata->sol) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
 /** frees specific constraint data */
 static
 SCIP_DECL_CONSDELETE(consDeleteSavesdpsol)
 {  /*lint --e{715}*/
-   int b;
+   SCIP_CONSHDLRDATA* conshdlrdata;
 
    assert( scip != NULL );
    assert( conshdlr != NULL );
@@ -77,30 +126,44 @@ SCIP_DECL_CONSDELETE(consDeleteSavesdpsol)
 
    SCIPdebugMsg(scip, "Deleting store node data constraint: <%s>.\n", SCIPconsGetName(cons));
 
-   assert( (*consdata)->startXval != NULL );
-   assert( (*consdata)->startXcol != NULL );
-   assert( (*consdata)->startXrow != NULL );
-   assert( (*consdata)->startXnblocknonz != NULL );
-   assert( (*consdata)->sol != NULL );
-
-   for (b = 0; b < (*consdata)->nblocks; b++)
+   /* remove constraint from node map if it is the one stored for its node */
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   assert( conshdlrdata->nodeconss != NULL );
+   if ( SCIPhashmapGetImage(conshdlrdata->nodeconss, (void*) (size_t) (*consdata)->node) == (void*) cons )
    {
-      SCIPfreeBlockMemoryArray(scip, &(*consdata)->startXval[b], (*consdata)->startXnblocknonz[b]);
-      SCIPfreeBlockMemoryArray(scip, &(*consdata)->startXcol[b], (*consdata)->startXnblocknonz[b]);
-      SCIPfreeBlockMemoryArray(scip, &(*consdata)->startXrow[b], (*consdata)->startXnblocknonz[b]);
+      SCIP_CALL( SCIPhashmapRemove(conshdlrdata->nodeconss, (void*) (size_t) (*consdata)->node) );
    }
-   SCIPfreeBlockMemoryArray(scip, &(*consdata)->startXval, (*consdata)->nblocks);
-   SCIPfreeBlockMemoryArray(scip, &(*consdata)->startXcol, (*consdata)->nblocks);
-   SCIPfreeBlockMemoryArray(scip, &(*consdata)->startXrow, (*consdata)->nblocks);
-   SCIPfreeBlockMemoryArray(scip, &(*consdata)->startXnblocknonz, (*consdata)->nblocks);
+   conshdlrdata->memory -= (*consdata)->memory;
+   assert( conshdlrdata->memory >= 0 );
 
-   SCIP_CALL( SCIPfreeSol(scip, &(*consdata)->sol) );
+   SCIP_CALL( freeSolutionData(scip, *consdata) );
    SCIPfreeBlockMemory(scip, consdata);
 
    return SCIP_OKAY;
 }
 
 
+/** destructor of constraint handler to free constraint handler data (called when SCIP is exiting) */
+static
+SCIP_DECL_CONSFREE(consFreeSavesdpsol)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   SCIPhashmapFree(&conshdlrdata->nodeconss);
+   SCIPfreeBlockMemory(scip, &conshdlrdata);
+   SCIPconshdlrSetData(conshdlr, NULL);
+
+   return SCIP_OKAY;
+}
+
+
 /** constraint enforcing method of constraint handler for LP solutions */
 static
 SCIP_DECL_CONSENFORELAX(consEnforelaxSavesdpsol)
@@ -210,16 +273,24 @@ SCIP_RETCODE SCIPincludeConshdlrSavesdpsol(
    SCIP*                 scip                /**< SCIP data structure */
    )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata = NULL;
    SCIP_CONSHDLR* conshdlr = NULL;
 
+   /* create constraint handler data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &conshdlrdata) );
+   SCIP_CALL( SCIPhashmapCreate(&conshdlrdata->nodeconss, SCIPblkmem(scip), INITNODEMAPSIZE) );
+   conshdlrdata->memory = 0;
+   conshdlrdata->peakmemory = 0;
+
    /* include constraint handler */
    SCIP_CALL( SCIPincludeConshdlrBasic(scip, &conshdlr, CONSHDLR_NAME, CONSHDLR_DESC,
          CONSHDLR_ENFOPRIORITY, CONSHDLR_CHECKPRIORITY, CONSHDLR_EAGERFREQ, CONSHDLR_NEEDSCONS,
          consEnfolpSavesdpsol, consEnfopsSavesdpsol, consCheckSavesdpsol, consLockSavesdpsol,
-         NULL) );
+         conshdlrdata) );
    assert( conshdlr != NULL );
 
    /* set additional callbacks */
+   SCIP_CALL( SCIPsetConshdlrFree(scip, conshdlr, consFreeSavesdpsol) );
    SCIP_CALL( SCIPsetConshdlrDelete(scip, conshdlr, consDeleteSavesdpsol) );
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopySavesdpsol, consCopySavesdpsol) );
    SCIP_CALL( SCIPsetConshdlrEnforelax(scip, conshdlr, consEnforelaxSavesdpsol) );
@@ -228,26 +299,26 @@ SCIP_RETCODE SCIPincludeConshdlrSavesdpsol(
 }
 
 
-/*
- * External functions
- */
-
-/** create a Savesdpsol constraint, i.e., save solution for the SDP-relaxation */
-SCIP_RETCODE createConsSavesdpsol(
+/** creates a Savesdpsol constraint, either copying the primal matrix or taking over its arrays */
+static
+SCIP_RETCODE createSavesdpsol(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONS**           cons,               /**< pointer to hold the created constraint */
    const char*           name,               /**< name of constraint */
    SCIP_Longint          node,               /**< index of the node the solution belongs to */
    int                   nlpcons,            /**< number of LP constraints of solution */
+   SCIP_ROW**            lprows,             /**< LP rows of solution, in the order of the LP block (or NULL if nlpcons == 0) */
    SCIP_SOL*             sol,                /**< optimal solution for SDP-relaxation of this node */
    SCIP_Real             maxprimalentry,     /**< maximal absolute value of primal matrix */
    int                   nblocks,            /**< number of blocks INCLUDING lp-block */
    int*                  startXnblocknonz,   /**< starting point primal matrix X: number of nonzeros for each block (or NULL if nblocks == 0) */
    int**                 startXrow,          /**< starting point primal matrix X: row indices for each block (or NULL if nblocks = 0) */
    int**                 startXcol,          /**< starting point primal matrix X: column indices for each block (or NULL if nblocks = 0) */
-   SCIP_Real**           startXval           /**< starting point primal matrix X: values for each block (or NULL if nblocks = 0) */
+   SCIP_Real**           startXval,          /**< starting point primal matrix X: values for each block (or NULL if nblocks = 0) */
+   SCIP_Bool             takeover            /**< whether the arrays of the primal matrix are stored without copying them */
    )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata = NULL;
    SCIP_CONSHDLR* conshdlr;
    int b;
@@ -255,6 +326,7 @@ SCIP_RETCODE createConsSavesdpsol(
    assert( scip != NULL );
    assert( name != NULL );
    assert( sol != NULL );
+   assert( nlpcons == 0 || lprows != NULL );
    assert( nblocks >= 0 );
    assert( nblocks == 0 || startXnblocknonz != NULL );
    assert( nblocks == 0 || startXrow != NULL );
@@ -276,12 +348,29 @@ SCIP_RETCODE createConsSavesdpsol(
 
    consdata->node = node;
    consdata->nlpcons = nlpcons;
+   consdata->lprowinds = NULL;
+
+   /* store the identities of the LP rows, such that the LP block can be mapped to a different set of rows later */
+   if ( nlpcons > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->lprowinds, nlpcons) );
+      for (b = 0; b < nlpcons; b++)
+         consdata->lprowinds[b] = SCIProwGetIndex(lprows[b]);
+   }
 
    SCIP_CALL( SCIPcreateSolCopy(scip, &consdata->sol, sol) );
    SCIP_CALL( SCIPunlinkSol(scip, consdata->sol) );
    consdata->maxprimalentry = maxprimalentry;
 
-   if ( nblocks > 0 )
+   if ( nblocks > 0 && takeover )
+   {
+      consdata->startXnblocknonz = startXnblocknonz;
+      consdata->startXrow = startXrow;
+      consdata->startXcol = startXcol;
+      consdata->startXval = startXval;
+      consdata->nblocks = nblocks;
+   }
+   else if ( nblocks > 0 )
    {
       SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &consdata->startXnblocknonz, startXnblocknonz, nblocks) );
       SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->startXrow, nblocks) );
@@ -307,10 +396,210 @@ SCIP_RETCODE createConsSavesdpsol(
       consdata->nblocks = 0;
    }
 
+   /* count the memory of the data from the lengths of the arrays; the solution stores one value for each variable */
+   consdata->memory = (SCIP_Longint) sizeof(SCIP_CONSDATA) + (SCIP_Longint) nlpcons * (SCIP_Longint) sizeof(*consdata->lprowinds);
+   consdata->memory += (SCIP_Longint) SCIPgetNVars(scip) * (SCIP_Longint) sizeof(SCIP_Real);
+   consdata->memory += (SCIP_Longint) consdata->nblocks * (SCIP_Longint) (sizeof(*consdata->startXnblocknonz)
+      + sizeof(*consdata->startXrow) + sizeof(*consdata->startXcol) + sizeof(*consdata->startXval));
+   for (b = 0; b < consdata->nblocks; b++)
+   {
+      consdata->memory += (SCIP_Longint) consdata->startXnblocknonz[b] * (SCIP_Longint) (sizeof(**consdata->startXrow)
+         + sizeof(**consdata->startXcol) + sizeof(**consdata->startXval));
+   }
+
    /* create constraint */
    SCIP_CALL( SCIPcreateCons(scip, cons, name, conshdlr, consdata, FALSE, FALSE, FALSE, FALSE, FALSE,
          TRUE, FALSE, TRUE, FALSE, TRUE));
 
+   /* store the constraint for its node; a later constraint for the same node replaces the earlier one */
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   SCIP_CALL( SCIPhashmapSetImage(conshdlrdata->nodeconss, (void*) (size_t) node, (void*) *cons) );
+
+   conshdlrdata->memory += consdata->memory;
+   conshdlrdata->peakmemory = MAX(conshdlrdata->peakmemory, conshdlrdata->memory);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * External functions
+ */
+
+/** create a Savesdpsol constraint, i.e., save solution for the SDP-relaxation */
+SCIP_RETCODE createConsSavesdpsol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           cons,               /**< pointer to hold the created constraint */
+   const char*           name,               /**< name of constraint */
+   SCIP_Longint          node,               /**< index of the node the solution belongs to */
+   int                   nlpcons,            /**< number of LP constraints of solution */
+   SCIP_ROW**            lprows,             /**< LP rows of solution, in the order of the LP block (or NULL if nlpcons == 0) */
+   SCIP_SOL*             sol,                /**< optimal solution for SDP-relaxation of this node */
+   SCIP_Real             maxprimalentry,     /**< maximal absolute value of primal matrix */
+   int                   nblocks,            /**< number of blocks INCLUDING lp-block */
+   int*                  startXnblocknonz,   /**< starting point primal matrix X: number of nonzeros for each block (or NULL if nblocks == 0) */
+   int**                 startXrow,          /**< starting point primal matrix X: row indices for each block (or NULL if nblocks = 0) */
+   int**                 startXcol,          /**< starting point primal matrix X: column indices for each block (or NULL if nblocks = 0) */
+   SCIP_Real**           startXval           /**< starting point primal matrix X: values for each block (or NULL if nblocks = 0) */
+   )
+{
+   SCIP_CALL( createSavesdpsol(scip, cons, name, node, nlpcons, lprows, sol, maxprimalentry, nblocks,
+         startXnblocknonz, startXrow, startXcol, startXval, FALSE) );
+
+   return SCIP_OKAY;
+}
+
+/** create a Savesdpsol constraint that takes over the arrays of the primal matrix instead of copying them
+ *
+ *  The arrays have to be allocated in SCIP's block memory with the exact number of nonzeros of each block, e.g., by
+ *  SCIPsdpiGetPrimalMatrixSparse(); the pointers are set to NULL afterwards.
+ */
+SCIP_RETCODE createConsSavesdpsolTakeover(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           cons,               /**< pointer to hold the created constraint */
+   const char*           name,               /**< name of constraint */
+   SCIP_Longint          node,               /**< index of the node the solution belongs to */
+   int                   nlpcons,            /**< number of LP constraints of solution */
+   SCIP_ROW**            lprows,             /**< LP rows of solution, in the order of the LP block (or NULL if nlpcons == 0) */
+   SCIP_SOL*             sol,                /**< optimal solution for SDP-relaxation of this node */
+   SCIP_Real             maxprimalentry,     /**< maximal absolute value of primal matrix */
+   int                   nblocks,            /**< number of blocks INCLUDING lp-block */
+   int**                 startXnblocknonz,   /**< pointer to number of nonzeros for each block of X (*startXnblocknonz may be NULL if nblocks == 0) */
+   int***                startXrow,          /**< pointer to row indices for each block of X (*startXrow may be NULL if nblocks == 0) */
+   int***                startXcol,          /**< pointer to column indices for each block of X (*startXcol may be NULL if nblocks == 0) */
+   SCIP_Real***          startXval           /**< pointer to values for each block of X (*startXval may be NULL if nblocks == 0) */
+   )
+{
+   assert( startXnblocknonz != NULL );
+   assert( startXrow != NULL );
+   assert( startXcol != NULL );
+   assert( startXval != NULL );
+
+   SCIP_CALL( createSavesdpsol(scip, cons, name, node, nlpcons, lprows, sol, maxprimalentry, nblocks,
+         *startXnblocknonz, *startXrow, *startXcol, *startXval, TRUE) );
+
+   if ( nblocks > 0 )
+   {
+      *startXnblocknonz = NULL;
+      *startXrow = NULL;
+      *startXcol = NULL;
+      *startXval = NULL;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the last created Savesdpsol constraint for the given node, or NULL if there is none */
+SCIP_CONS* SCIPconshdlrSavesdpsolGetNodeCons(
+   SCIP_CONSHDLR*        conshdlr,           /**< Savesdpsol constraint handler */
+   SCIP_Longint          node                /**< index of the node */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   return (SCIP_CONS*) SCIPhashmapGetImage(conshdlrdata->nodeconss, (void*) (size_t) node);
+}
+
+/** returns the current and maximal number of bytes used by the data of all Savesdpsol constraints */
+void SCIPconshdlrSavesdpsolGetMemory(
+   SCIP_CONSHDLR*        conshdlr,           /**< Savesdpsol constraint handler */
+   SCIP_Longint*         memory,             /**< pointer to store the current number of bytes */
+   SCIP_Longint*         peakmemory          /**< pointer to store the maximal number of bytes */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+   assert( memory != NULL );
+   assert( peakmemory != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   *memory = conshdlrdata->memory;
+   *peakmemory = conshdlrdata->peakmemory;
+}
+
+/** resets the maximal number of bytes used by the data of all Savesdpsol constraints to the current number */
+void SCIPconshdlrSavesdpsolResetPeakMemory(
+   SCIP_CONSHDLR*        conshdlr            /**< Savesdpsol constraint handler */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   conshdlrdata->peakmemory = conshdlrdata->memory;
+}
+
+/** frees the saved solutions of all Savesdpsol constraints that are not active at the current node
+ *
+ *  These constraints belong to nodes that are not ancestors of the current node, so their solutions are only used for
+ *  warmstarting nodes in other parts of the tree. The constraints are removed from the node map, such that these nodes
+ *  are solved without warmstart.
+ */
+SCIP_RETCODE SCIPconshdlrSavesdpsolFreeInactive(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< Savesdpsol constraint handler */
+   int*                  nfreed              /**< pointer to store the number of freed solutions */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONS** conss;
+   int nconss;
+   int c;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+   assert( nfreed != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   *nfreed = 0;
+   conss = SCIPconshdlrGetConss(conshdlr);
+   nconss = SCIPconshdlrGetNConss(conshdlr);
+
+   for (c = 0; c < nconss; ++c)
+   {
+      SCIP_CONSDATA* consdata;
+
+      if ( SCIPconsIsActive(conss[c]) )
+         continue;
+
+      consdata = SCIPconsGetData(conss[c]);
+      assert( consdata != NULL );
+
+      /* skip constraints whose solution has been freed before */
+      if ( consdata->sol == NULL )
+         continue;
+
+      if ( SCIPhashmapGetImage(conshdlrdata->nodeconss, (void*) (size_t) consdata->node) == (void*) conss[c] )
+      {
+         SCIP_CALL( SCIPhashmapRemove(conshdlrdata->nodeconss, (void*) (size_t) consdata->node) );
+      }
+
+      SCIP_CALL( freeSolutionData(scip, consdata) );
+
+      conshdlrdata->memory -= consdata->memory - (SCIP_Longint) sizeof(SCIP_CONSDATA);
+      consdata->memory = (SCIP_Longint) sizeof(SCIP_CONSDATA);
+      assert( conshdlrdata->memory >= 0 );
+      ++(*nfreed);
+   }
+
    return SCIP_OKAY;
 }
 
@@ -412,11 +701,130 @@ SCIP_RETCODE SCIPconsSavesdpsolGetPrimalMatrixNonzeros(
    return SCIP_OKAY;
 }
 
-/** for the given cons of type Savesdpsol returns the previous primal solution X */
+/** maps the LP block of the saved primal solution onto the given LP rows
+ *
+ *  The LP block has indices lhs(row0), rhs(row0), lhs(row1), ..., lb(var0), ub(var0), lb(var1), .... Entries of rows
+ *  that are not present anymore are dropped, entries of new rows are set to newrowval.
+ */
+static
+SCIP_RETCODE mapLPBlock(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   int                   nlprows,            /**< current number of LP rows */
+   SCIP_ROW**            lprows,             /**< current LP rows */
+   SCIP_Real             newrowval,          /**< value for the diagonal entries of new rows (no entries are added if <= 0) */
+   int*                  nnonz,              /**< input: allocated memory for row/col/val; output: length of row/col/val */
+   int*                  row,                /**< array to store row indices of LP block */
+   int*                  col,                /**< array to store column indices of LP block */
+   SCIP_Real*            val                 /**< array to store values of LP block */
+   )
+{
+   SCIP_Bool* covered;
+   int* rowinds;
+   int* rowpos;
+   int* newpos;
+   int lpblock;
+   int maxnnonz;
+   int cnt = 0;
+   int idx;
+   int pos;
+   int r;
+   int i;
+
+   assert( consdata != NULL );
+   assert( nlprows == 0 || lprows != NULL );
+   assert( nnonz != NULL );
+
+   lpblock = consdata->nblocks - 1;
+   maxnnonz = *nnonz;
+
+   /* sort current row indices to find the new position of the saved rows */
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowinds, nlprows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowpos, nlprows) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &covered, nlprows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &newpos, consdata->nlpcons) );
+   for (r = 0; r < nlprows; r++)
+   {
+      rowinds[r] = SCIProwGetIndex(lprows[r]);
+      rowpos[r] = r;
+   }
+   SCIPsortIntInt(rowinds, rowpos, nlprows);
+
+   for (r = 0; r < consdata->nlpcons; r++)
+   {
+      if ( SCIPsortedvecFindInt(rowinds, consdata->lprowinds[r], nlprows, &pos) )
+      {
+         newpos[r] = rowpos[pos];
+         covered[rowpos[pos]] = TRUE;
+      }
+      else
+         newpos[r] = -1;
+   }
+
+   for (i = 0; i < consdata->startXnblocknonz[lpblock]; i++)
+   {
+      idx = consdata->startXrow[lpblock][i];
+      assert( idx == consdata->startXcol[lpblock][i] );
+
+      if ( idx < 2 * consdata->nlpcons )
+      {
+         /* entry for lhs or rhs of a row: skip removed rows */
+         if ( newpos[idx / 2] < 0 )
+            continue;
+         idx = 2 * newpos[idx / 2] + idx % 2;
+      }
+      else
+      {
+         /* entry for a variable bound */
+         idx += 2 * (nlprows - consdata->nlpcons);
+      }
+
+      assert( cnt < maxnnonz );
+      row[cnt] = idx;
+      col[cnt] = idx;
+      val[cnt] = consdata->startXval[lpblock][i];
+      ++cnt;
+   }
+
+   /* add entries for new rows */
+   if ( newrowval > 0.0 )
+   {
+      for (r = 0; r < nlprows; r++)
+      {
+         if ( covered[r] )
+            continue;
+
+         assert( cnt + 1 < maxnnonz );
+         row[cnt] = 2 * r;
+         col[cnt] = 2 * r;
+         val[cnt++] = newrowval;
+         row[cnt] = 2 * r + 1;
+         col[cnt] = 2 * r + 1;
+         val[cnt++] = newrowval;
+      }
+   }
+   *nnonz = cnt;
+
+   SCIPfreeBufferArray(scip, &newpos);
+   SCIPfreeBufferArray(scip, &covered);
+   SCIPfreeBufferArray(scip, &rowpos);
+   SCIPfreeBufferArray(scip, &rowinds);
+
+   return SCIP_OKAY;
+}
+
+/** for the given cons of type Savesdpsol returns the previous primal solution X
+ *
+ *  The LP block (the last block) is mapped onto the given LP rows using the row indices stored with the solution, so the
+ *  solution can be used even if rows have been added or removed in the meantime.
+ */
 SCIP_RETCODE SCIPconsSavesdpsolGetPrimalMatrix(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONS*            cons,               /**< Savesdpsol constraint */
    int                   nblocks,            /**< number of blocks INCLUDING lp-block */
+   int                   nlprows,            /**< current number of LP rows */
+   SCIP_ROW**            lprows,             /**< current LP rows (or NULL if nlprows == 0) */
+   SCIP_Real             newrowval,          /**< value for the diagonal entries of LP rows not present in the saved solution */
    int*                  startXnblocknonz,   /**< input: allocated memory for startXrow/col/val; output: length of startXrow/col/val */
    int**                 startXrow,          /**< pointer to store pointer to row indices of X */
    int**                 startXcol,          /**< pointer to store pointer to column indices of X */
@@ -424,6 +832,7 @@ SCIP_RETCODE SCIPconsSavesdpsolGetPrimalMatrix(
    )
 {
    SCIP_CONSDATA* consdata;
+   SCIP_Bool samerows;
    int b;
    int i;
 
@@ -439,8 +848,22 @@ SCIP_RETCODE SCIPconsSavesdpsolGetPrimalMatrix(
       return SCIP_ERROR;
    }
 
+   /* check whether the LP rows are the same as for the saved solution */
+   samerows = (nlprows == consdata->nlpcons);
+   for (i = 0; i < nlprows && samerows; i++)
+   {
+      if ( SCIProwGetIndex(lprows[i]) != consdata->lprowinds[i] )
+         samerows = FALSE;
+   }
+
    for (b = 0; b < nblocks; b++)
    {
+      if ( b == nblocks - 1 && ! samerows )
+      {
+         SCIP_CALL( mapLPBlock(scip, consdata, nlprows, lprows, newrowval, &startXnblocknonz[b], startXrow[b], startXcol[b], startXval[b]) );
+         continue;
+      }
+
       assert( startXnblocknonz[b] >= consdata->startXnblocknonz[b] );
       startXnblocknonz[b] = consdata->startXnblocknonz[b];
       for (i = 0; i < consdata->startXnblocknonz[b]; i++)
@@ -57,6 +57,7 @@ SCIP_RETCODE createConsSavesdpsol(
    const char*           name,               /**< name of constraint */
    SCIP_Longint          node,               /**< index of the node the solution belongs to */
    int                   nlpcons,            /**< number of LP constraints of solution */
+   SCIP_ROW**            lprows,             /**< LP rows of solution, in the order of the LP block (or NULL if nlpcons == 0) */
    SCIP_SOL*             sol,                /**< solution for SDP-relaxation */
    SCIP_Real             maxprimalentry,     /**< maximal absolute value of primal matrix */
    int                   nblocks,            /**< number of blocks INCLUDING lp-block */
@@ -66,6 +67,60 @@ SCIP_RETCODE createConsSavesdpsol(
    SCIP_Real**           startXval           /**< starting point primal matrix X: values for each block (or NULL if nblocks = 0) */
    );
 
+/** create a Savesdpsol constraint that takes over the arrays of the primal matrix instead of copying them
+ *
+ *  The arrays have to be allocated in SCIP's block memory with the exact number of nonzeros of each block, e.g., by
+ *  SCIPsdpiGetPrimalMatrixSparse(); the pointers are set to NULL afterwards.
+ */
+SCIP_EXPORT
+SCIP_RETCODE createConsSavesdpsolTakeover(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           cons,               /**< pointer to hold the created constraint */
+   const char*           name,               /**< name of constraint */
+   SCIP_Longint          node,               /**< index of the node the solution belongs to */
+   int                   nlpcons,            /**< number of LP constraints of solution */
+   SCIP_ROW**            lprows,             /**< LP rows of solution, in the order of the LP block (or NULL if nlpcons == 0) */
+   SCIP_SOL*             sol,                /**< solution for SDP-relaxation */
+   SCIP_Real             maxprimalentry,     /**< maximal absolute value of primal matrix */
+   int                   nblocks,            /**< number of blocks INCLUDING lp-block */
+   int**                 startXnblocknonz,   /**< pointer to number of nonzeros for each block of X (*startXnblocknonz may be NULL if nblocks == 0) */
+   int***                startXrow,          /**< pointer to row indices for each block of X (*startXrow may be NULL if nblocks == 0) */
+   int***                startXcol,          /**< pointer to column indices for each block of X (*startXcol may be NULL if nblocks == 0) */
+   SCIP_Real***          startXval           /**< pointer to values for each block of X (*startXval may be NULL if nblocks == 0) */
+   );
+
+/** returns the last created Savesdpsol constraint for the given node, or NULL if there is none */
+SCIP_EXPORT
+SCIP_CONS* SCIPconshdlrSavesdpsolGetNodeCons(
+   SCIP_CONSHDLR*        conshdlr,           /**< Savesdpsol constraint handler */
+   SCIP_Longint          node                /**< index of the node */
+   );
+
+/** returns the current and maximal number of bytes used by the data of all Savesdpsol constraints */
+SCIP_EXPORT
+void SCIPconshdlrSavesdpsolGetMemory(
+   SCIP_CONSHDLR*        conshdlr,           /**< Savesdpsol constraint handler */
+   SCIP_Longint*         memory,             /**< pointer to store the current number of bytes */
+   SCIP_Longint*         peakmemory          /**< pointer to store the maximal number of bytes */
+   );
+
+/** resets the maximal number of bytes used by the data of all Savesdpsol constraints to the current number */
+SCIP_EXPORT
+void SCIPconshdlrSavesdpsolResetPeakMemory(
+   SCIP_CONSHDLR*        conshdlr            /**< Savesdpsol constraint handler */
+   );
+
+/** frees the saved solutions of all Savesdpsol constraints that are not active at the current node
+ *
+ *  The nodes of these constraints are solved without warmstart afterwards.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconshdlrSavesdpsolFreeInactive(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< Savesdpsol constraint handler */
+   int*                  nfreed              /**< pointer to store the number of freed solutions */
+   );
+
 /** for the given Savesdpsol constraint returns the node the information belongs to */
 SCIP_EXPORT
 SCIP_Longint SCIPconsSavesdpsolGetNodeIndex(
@@ -103,12 +158,19 @@ int SCIPconsSavesdpsolGetNLPcons(
    SCIP_CONS*            cons                /**< Savesdpsol constraint */
    );
 
-/** for the given Savesdpsol constraint returns the previous primal solution X */
+/** for the given Savesdpsol constraint returns the previous primal solution X
+ *
+ *  The LP block (the last block) is mapped onto the given LP rows using the row indices stored with the solution, so the
+ *  solution can be used even if rows have been added or removed in the meantime.
+ */
 SCIP_EXPORT
 SCIP_RETCODE SCIPconsSavesdpsolGetPrimalMatrix(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONS*            cons,               /**< Savesdpsol constraint */
    int                   nblocks,            /**< number of blocks INCLUDING lp-block */
+   int                   nlprows,            /**< current number of LP rows */
+   SCIP_ROW**            lprows,             /**< current LP rows (or NULL if nlprows == 0) */
+   SCIP_Real             newrowval,          /**< value for the diagonal entries of LP rows not present in the saved solution */
    int*                  startXnblocknonz,   /**< input: allocated memory for startXrow/col/val; output: length of startXrow/col/val */
    int**                 startXrow,          /**< pointer to store pointer to row indices of X */
    int**                 startXcol,          /**< pointer to store pointer to column indices of X */
@@ -101,8 +101,7 @@
 #define CONSHDLR_PRESOLTIMING     SCIP_PRESOLTIMING_EXHAUSTIVE
 #define CONSHDLR_PROPTIMING       SCIP_PROPTIMING_BEFORELP
 
-#define PARSE_STARTSIZE               1 /**< initial size of the consdata-arrays when parsing a problem */
-#define PARSE_SIZEFACTOR             10 /**< size of consdata-arrays is increased by this factor when parsing a problem */
+#define DENSETILESIZE                32 /**< tile size for cache-blocked transposition of dense matrices */
 
 #define DEFAULT_PROPUPPERBOUNDS    TRUE /**< Should upper bounds be propagated? */
 #define DEFAULT_PROPUBPRESOL       TRUE /**< Should upper bounds be propagated in presolving? */
@@ -141,9 +140,14 @@
 #define DEFAULT_ADDITIONALSTATS   FALSE /**< Should additional statistics be output at the end? */
 #define DEFAULT_ENABLEPROPTIMING  FALSE /**< Should timing be activated for propagation routines? */
 #define DEFAULT_REMOVESMALLVAL    FALSE /**< Should small values in the constraints be removed? */
+#define DEFAULT_MAXNSTOREDEVS         0 /**< maximal number of eigenvector directions stored per constraint and checked before computing eigenvalues (0: off) */
+#define DEFAULT_DETERMINISTIC     FALSE /**< Should the results be independent of the number of threads? */
 
 #ifdef OMP
-#define DEFAULT_NTHREADS              1 /**< number of threads used for OpenBLAS */
+#define DEFAULT_NTHREADS              1 /**< number of threads used for OpenBLAS (-1: leave unchanged) */
+#define DEFAULT_PRESOLNTHREADS        1 /**< number of threads used for the eigenvalue computations and one-variable SDPs in presolving */
+#else
+#define DEFAULT_NTHREADS             -1 /**< number of threads used for OpenBLAS (-1: leave unchanged) */
 #endif
 
 /* defines for sparsification of eigenvector cuts using TPower */
@@ -191,6 +195,14 @@ struct SCIP_ConsData
    SCIP_Real             tracebound;         /**< possible bound on the trace */
    SCIP_Bool             allmatricespsd;     /**< true if all variables are positive semidefinite (excluding the constant matrix) */
    SCIP_Bool             initallmatricespsd; /**< true if allmatricespsd has been initialized */
+   SCIP_Bool             sortednonz;         /**< true if the nonzeros of all variable matrices are sorted by row, then col, without duplicates */
+   /* store of eigenvector directions from earlier separation calls */
+   SCIP_Real*            storedevs;          /**< orthonormal eigenvector directions (maxnstoredevs * blocksize entries) or NULL */
+   int                   maxnstoredevs;      /**< maximal number of directions in storedevs */
+   int                   nstoredevs;         /**< current number of directions in storedevs */
+   int                   storedevspos;       /**< position in storedevs that is overwritten next if the store is full */
+   SCIP_Longint          memory;             /**< memory of the constraint data as counted in the constraint handler data */
+   SCIP_Longint          propmemory;         /**< memory of the propagation data as counted in the constraint handler data */
 };
 
 /** SDP constraint handler data */
@@ -234,9 +246,11 @@ struct SCIP_ConshdlrData
    SCIP_Bool             rank1approxheur;    /**< Should the heuristic that computes the best rank-1 approximation for a given solution be executed? */
    SCIP_Bool             generaterows;       /**< Should rows be generated (constraints otherwise)? */
    SCIP_Bool             generatecmir;       /**< Should CMIR cuts be generated? */
+   int                   nthreads;           /**< number of threads used for OpenBLAS (-1: number of cores) */
 #ifdef OMP
-   int                   nthreads;           /**< number of threads used for OpenBLAS */
+   int                   presolnthreads;     /**< number of threads used for the eigenvalue computations and one-variable SDPs in presolving */
 #endif
+   SCIP_Bool             deterministic;      /**< Should the results be independent of the number of threads? */
    int*                  quadconsidx;        /**< store index of variables appearing in quadratic constraints for upgrading */
    SCIP_VAR**            quadconsvars;       /**< temporary array to store variables appearing in quadratic constraints for upgrading */
    int                   nquadconsidx;       /**< size of quadconsidx/quadconsvars arrays */
@@ -255,6 +269,13 @@ struct SCIP_ConshdlrData
    SCIP_Bool             additionalstats;    /**< Should additional statistics be output at the end? */
    SCIP_Bool             enableproptiming;   /**< Should timing be activated for propagation routines? */
    SCIP_Bool             removesmallval;     /**< Should small values in the constraints be removed? */
+   int                   maxnstoredevs;      /**< maximal number of eigenvector directions stored per constraint and checked before computing eigenvalues (0: off) */
+   int                   nstoredevcuts;      /**< Number of separation calls in which a stored eigenvector direction produced a cut */
+   SCIP_Bool             dropcaches;         /**< Were the propagation data and stored eigenvectors freed because memory is short? */
+   SCIP_Longint          consdatamem;        /**< memory of the constraint data of all constraints of the handler */
+   SCIP_Longint          propmem;            /**< memory of the propagation data of all constraints of the handler */
+   SCIP_Longint          peakconsdatamem;    /**< maximal memory of the constraint data since the last reset */
+   SCIP_Longint          peakpropmem;        /**< maximal memory of the propagation data since the last reset */
 
    int                   ncallspropub;       /**< Number of calls of propagateUpperBounds in propagation */
    int                   ncallsproptb;       /**< Number of calls of tightenBounds in propagation */
@@ -284,6 +305,34 @@ struct SCIP_ConshdlrData
    int                   npropprob3minor;    /**< Number of propagations through 3x3 minor in probing */
 };
 
+/** returns whether the nonzeros of all variable matrices of the constraint are sorted by row, then col, without duplicates
+ *
+ *  This is checked once when the constraint data is created; all later changes of the variable matrices keep the nonzeros
+ *  sorted. The constant matrix is not included, since fixing variables appends its new nonzeros at the end.
+ */
+static
+SCIP_Bool consdataNonzSorted(
+   SCIP_CONSDATA*        consdata            /**< constraint data */
+   )
+{
+   int v;
+   int j;
+
+   assert( consdata != NULL );
+
+   for (v = 0; v < consdata->nvars; ++v)
+   {
+      for (j = 1; j < consdata->nvarnonz[v]; ++j)
+      {
+         if ( consdata->row[v][j-1] > consdata->row[v][j]
+            || (consdata->row[v][j-1] == consdata->row[v][j] && consdata->col[v][j-1] >= consdata->col[v][j]) )
+            return FALSE;
+      }
+   }
+
+   return TRUE;
+}
+
 /** generates matrix in colum-first format (needed by LAPACK) from matrix given in full row-first format (SCIP-SDP
  *  default)
  */
@@ -296,21 +345,30 @@ SCIP_RETCODE convertRowToColFormatFullMatrix(
                                               *   format */
    )
 {
+   int ib;
+   int jb;
    int i;
    int j;
-   SCIP_Real act;
 
    assert( rows > 0 );
    assert( cols > 0 );
    assert( rowmatrix != NULL );
    assert( colmatrix != NULL );
 
-   for (i = 0; i < rows; ++i)
+   /* transpose in tiles, such that both matrices are accessed in cache-friendly order */
+   for (ib = 0; ib < rows; ib += DENSETILESIZE)
    {
-      for (j = 0; j < cols; ++j)
+      int iend = MIN(ib + DENSETILESIZE, rows);
+
+      for (jb = 0; jb < cols; jb += DENSETILESIZE)
       {
-         act = rowmatrix[i*cols + j];
-         colmatrix[j*rows + i] = act;
+         int jend = MIN(jb + DENSETILESIZE, cols);
+
+         for (i = ib; i < iend; ++i)
+         {
+            for (j = jb; j < jend; ++j)
+               colmatrix[j*rows + i] = rowmatrix[i*cols + j];
+         }
       }
    }
 
@@ -334,42 +392,12 @@ SCIP_RETCODE scaleRowsMatrix(
 
    for (r = 0; r < blocksize; r++)
    {
-      for (c = 0; c < blocksize; c++)
-      {
-         /* row-first format! */
-         matrix[r * blocksize + c] *= scale[r];  /*lint !e679*/
-      }
-   }
-
-   return SCIP_OKAY;
-}
-
-/** takes a 0.5*n*(n+1) array of a symmetric matrix and expands it to an n*n array of the full matrix to input into LAPACK */
-static
-SCIP_RETCODE expandSymMatrix(
-   int                   size,               /**< size of the matrix, named n above */
-   SCIP_Real*            symMat,             /**< symmetric matrix indexed via SCIPconsSdpCompLowerTriangPos that should be expanded */
-   SCIP_Real*            fullMat             /**< pointer to store the n*n matrix, that is the symmetric expansion of symMat */
-   )
-{
-   int i;
-   int j;
-   int ind = 0;
-
-   assert( size >= 0 );
-   assert( symMat != NULL );
-   assert( fullMat != NULL );
+      /* row-first format! */
+      SCIP_Real* matrixrow = &matrix[r * blocksize];  /*lint !e679*/
+      SCIP_Real rowscale = scale[r];
 
-   /* traverse the lower triangular part in the order of the indices and copy the values to both lower and upper triangular part */
-   for (i = 0; i < size; i++)
-   {
-      for (j = 0; j <= i; j++)
-      {
-         assert( ind == SCIPconsSdpCompLowerTriangPos(i,j) );
-         fullMat[i*size + j] = symMat[ind]; /*lint !e679*/
-         fullMat[j*size + i] = symMat[ind]; /*lint !e679*/
-         ind++;
-      }
+      for (c = 0; c < blocksize; c++)
+         matrixrow[c] *= rowscale;
    }
 
    return SCIP_OKAY;
@@ -445,8 +473,7 @@ SCIP_RETCODE computeFullSdpMatrix(
    blocksize = consdata->blocksize;
 
    /* initialize the matrix with 0 */
-   for (i = 0; i < blocksize * blocksize; ++i)
-      fullmatrix[i] = 0.0;
+   BMSclearMemoryArray(fullmatrix, blocksize * blocksize);
 
    /* add the non-constant-part */
    for (i = 0; i < nvars; i++)
@@ -551,6 +578,72 @@ SCIP_RETCODE checkPropagateUpperbounds(
    return SCIP_OKAY;
 }
 
+/** computes the memory of the constraint data and of the propagation data from the lengths of their arrays */
+static
+void consdataComputeMemory(
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   SCIP_Longint*         memory,             /**< pointer to store the memory of the constraint data */
+   SCIP_Longint*         propmemory          /**< pointer to store the memory of the propagation data */
+   )
+{
+   SCIP_Longint nentries;
+
+   assert( consdata != NULL );
+   assert( memory != NULL );
+   assert( propmemory != NULL );
+
+   *memory = (SCIP_Longint) sizeof(SCIP_CONSDATA);
+   *memory += (SCIP_Longint) consdata->nvars * (SCIP_Longint) (sizeof(*consdata->nvarnonz) + sizeof(*consdata->col)
+      + sizeof(*consdata->row) + sizeof(*consdata->val) + sizeof(*consdata->vars));
+   *memory += (SCIP_Longint) consdata->nnonz * (SCIP_Longint) (sizeof(**consdata->col) + sizeof(**consdata->row) + sizeof(**consdata->val));
+   *memory += (SCIP_Longint) consdata->constnnonz * (SCIP_Longint) (sizeof(*consdata->constcol) + sizeof(*consdata->constrow)
+      + sizeof(*consdata->constval));
+   if ( consdata->locks != NULL )
+      *memory += (SCIP_Longint) consdata->nvars * (SCIP_Longint) sizeof(*consdata->locks);
+   if ( consdata->maxevsubmat != NULL )
+      *memory += 2 * (SCIP_Longint) sizeof(*consdata->maxevsubmat);
+   if ( consdata->storedevs != NULL )
+      *memory += (SCIP_Longint) consdata->maxnstoredevs * (SCIP_Longint) consdata->blocksize * (SCIP_Longint) sizeof(*consdata->storedevs);
+
+   *propmemory = 0;
+   if ( consdata->matrixvar != NULL )
+   {
+      nentries = (SCIP_Longint) consdata->blocksize * (SCIP_Longint) (consdata->blocksize + 1) / 2;
+      *propmemory = nentries * (SCIP_Longint) (sizeof(*consdata->matrixvar) + sizeof(*consdata->matrixval) + sizeof(*consdata->matrixconst));
+   }
+}
+
+/** updates the memory of a constraint in the data of its constraint handler; called after arrays of the constraint data
+ *  were (re)allocated or freed
+ */
+static
+void updateConsMemory(
+   SCIP_CONS*            cons                /**< SDP constraint */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSDATA* consdata;
+   SCIP_Longint memory;
+   SCIP_Longint propmemory;
+
+   assert( cons != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert( conshdlrdata != NULL );
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+
+   consdataComputeMemory(consdata, &memory, &propmemory);
+
+   conshdlrdata->consdatamem += memory - consdata->memory;
+   conshdlrdata->propmem += propmemory - consdata->propmemory;
+   consdata->memory = memory;
+   consdata->propmemory = propmemory;
+
+   conshdlrdata->peakconsdatamem = MAX(conshdlrdata->peakconsdatamem, conshdlrdata->consdatamem);
+   conshdlrdata->peakpropmem = MAX(conshdlrdata->peakpropmem, conshdlrdata->propmem);
+}
+
 /** build matrixvar data
  *
  *  We have:
@@ -656,6 +749,8 @@ SCIP_RETCODE constructMatrixvar(
    /* determine whether propagation of upper bounds is possible */
    SCIP_CALL( checkPropagateUpperbounds(cons) );
 
+   updateConsMemory(cons);
+
    return SCIP_OKAY;
 }
 
@@ -671,7 +766,7 @@ SCIP_RETCODE SCIPconsSdpCheckSdpCons(
    )
 {  /*lint --e{715}*/
    SCIP_CONSDATA* consdata;
-   SCIP_Real* fullmatrix = NULL;
+   SCIP_Real* matrix = NULL;
    SCIP_Real eigenvalue;
    SCIP_Real tol;
    int blocksize;
@@ -686,11 +781,12 @@ SCIP_RETCODE SCIPconsSdpCheckSdpCons(
    assert( ! consdata->rankone || strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(cons)), CONSHDLRRANK1_NAME) == 0 );
    blocksize = consdata->blocksize;
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &fullmatrix, blocksize * blocksize) ); /*lint !e647*/
+   /* LAPACK can work on the lower triangular part in packed storage, so we do not need to expand the matrix */
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix, (blocksize * (blocksize + 1)) / 2) ); /*lint !e647*/
 
-   SCIP_CALL( computeFullSdpMatrix(scip, consdata, sol, fullmatrix) );
+   SCIP_CALL( computeSdpMatrix(scip, consdata, sol, matrix) );
 
-   SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, fullmatrix, 1, &eigenvalue, NULL) );
+   SCIP_CALL( SCIPlapackComputeIthEigenvaluePacked(SCIPbuffer(scip), FALSE, blocksize, matrix, 1, &eigenvalue, NULL) );
 
    if ( conshdlrdata->sdpconshdlrdata->usedimacsfeastol )
    {
@@ -715,7 +811,7 @@ SCIP_RETCODE SCIPconsSdpCheckSdpCons(
    if ( sol != NULL )
       SCIPupdateSolConsViolation(scip, sol, -eigenvalue, (-eigenvalue) / (1.0 + consdata->maxrhsentry));
 
-   SCIPfreeBufferArray(scip, &fullmatrix);
+   SCIPfreeBufferArray(scip, &matrix);
 
    return SCIP_OKAY;
 }
@@ -732,7 +828,7 @@ SCIP_RETCODE isMatrixRankOne(
 {
    SCIP_CONSDATA* consdata;
    SCIP_Real* matrix = NULL;
-   SCIP_Real* fullmatrix = NULL;
+   SCIP_Real* matrixcopy = NULL;
    SCIP_Real eigenvalue;
    int blocksize;
    int i;
@@ -751,18 +847,17 @@ SCIP_RETCODE isMatrixRankOne(
    blocksize = consdata->blocksize;
    *isrankone = TRUE;
 
-   /* allocate memory to store full matrix */
+   /* allocate memory to store the lower triangular part of the matrix */
    SCIP_CALL( SCIPallocBufferArray(scip, &matrix, (blocksize * (blocksize+1))/2 ) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &fullmatrix, blocksize * blocksize ) );
 
    /* compute the matrix \f$ \sum_j A_j y_j - A_0 \f$ - we need an undestroyed version in matrix below */
    SCIP_CALL( computeSdpMatrix(scip, consdata, sol, matrix) );
 
-   /* expand it because LAPACK wants the full matrix instead of the lower triangular part */
-   SCIP_CALL( expandSymMatrix(blocksize, matrix, fullmatrix) );
+   /* LAPACK works on a copy of the lower triangular part in packed storage */
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &matrixcopy, matrix, (blocksize * (blocksize+1))/2 ) );
 
    /* compute the second largest eigenvalue */
-   SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, fullmatrix, blocksize - 1, &eigenvalue, NULL) );
+   SCIP_CALL( SCIPlapackComputeIthEigenvaluePacked(SCIPbuffer(scip), FALSE, blocksize, matrixcopy, blocksize - 1, &eigenvalue, NULL) );
 
    /* the matrix is rank 1 iff the second largest eigenvalue is zero (since the matrix is symmetric and psd) */
    if ( SCIPisFeasEQ(scip, eigenvalue, 0.0) )
@@ -808,7 +903,7 @@ SCIP_RETCODE isMatrixRankOne(
    if ( sol != NULL )
       SCIPupdateSolConsViolation(scip, sol, largestminev, (largestminev) / (1.0 + consdata->maxrhsentry));
 
-   SCIPfreeBufferArray(scip, &fullmatrix);
+   SCIPfreeBufferArray(scip, &matrixcopy);
    SCIPfreeBufferArray(scip, &matrix);
 
    return SCIP_OKAY;
@@ -1401,9 +1496,7 @@ SCIP_RETCODE addMultipleSparseCuts(
    assert( size <= blocksize );
 
    /* copy fullmatrix, since Lapack destroys it when computing eigenvalues! */
-   SCIP_CALL( SCIPallocBufferArray(scip, &fullmatrixcopy, blocksize * blocksize) );
-   for (i = 0; i < blocksize * blocksize; i++)
-      fullmatrixcopy[i] = fullmatrix[i];
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &fullmatrixcopy, fullmatrix, blocksize * blocksize) );
 
    /* compute the largest eigenvalue of A(y), the eigenvector is not needed */
    SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, fullmatrixcopy, blocksize, &maxeig, NULL) );
@@ -1528,8 +1621,7 @@ SCIP_RETCODE addMultipleSparseCuts(
             using the eigenvector to the smallest eigenvalue of the original matrix */
 
          /* copy fullmatrix, since Lapack destroys it when computing eigenvalues! */
-         for (i = 0; i < blocksize * blocksize; i++)
-            fullmatrixcopy[i] = fullmatrix[i];
+         BMScopyMemoryArray(fullmatrixcopy, fullmatrix, blocksize * blocksize);
 
          SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), TRUE, blocksize, fullmatrixcopy, 1, &mineig, minev) );
 
@@ -1546,8 +1638,7 @@ SCIP_RETCODE addMultipleSparseCuts(
          /* we need to modify the matrix again in order to use the truncated power method */
 
          /* copy fullmatrix, since Lapack destroys it when computing eigenvalues! */
-         for (i = 0; i < blocksize * blocksize; i++)
-            fullmatrixcopy[i] = fullmatrix[i];
+         BMScopyMemoryArray(fullmatrixcopy, fullmatrix, blocksize * blocksize);
 
          /* compute the largest eigenvalue of A(y), the eigenvector is not needed */
          SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, fullmatrixcopy, blocksize, &maxeig, NULL) );
@@ -1599,6 +1690,158 @@ SCIP_RETCODE addMultipleSparseCuts(
 }
 
 
+/** adds an eigenvector direction to the store of the constraint
+ *
+ *  The stored directions form an orthonormal basis of the space spanned by recent eigenvectors: the given vector is
+ *  orthogonalized against the stored directions (modified Gram-Schmidt). If a sufficiently large part remains, it is
+ *  normalized and stored; if the store is full, the oldest direction is overwritten.
+ */
+static
+SCIP_RETCODE storeEigenvector(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   int                   maxnstoredevs,      /**< maximal number of stored directions */
+   SCIP_Real*            eigenvector,        /**< eigenvector to store */
+   SCIP_Real*            vector              /**< temporary workspace (length blocksize) */
+   )
+{
+   SCIP_Real* storedev;
+   SCIP_Real origsqrnorm = 0.0;
+   SCIP_Real sqrnorm = 0.0;
+   SCIP_Real scalar;
+   int blocksize;
+   int i;
+   int j;
+
+   assert( consdata != NULL );
+   assert( maxnstoredevs > 0 );
+   assert( eigenvector != NULL );
+   assert( vector != NULL );
+
+   blocksize = consdata->blocksize;
+
+   /* allocate store on demand */
+   if ( consdata->storedevs == NULL )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->storedevs, maxnstoredevs * blocksize) );
+      consdata->maxnstoredevs = maxnstoredevs;
+      consdata->nstoredevs = 0;
+      consdata->storedevspos = 0;
+   }
+   assert( consdata->maxnstoredevs > 0 );
+
+   for (j = 0; j < blocksize; ++j)
+   {
+      vector[j] = eigenvector[j];
+      origsqrnorm += eigenvector[j] * eigenvector[j];
+   }
+
+   if ( origsqrnorm <= 0.0 )
+      return SCIP_OKAY;
+
+   /* orthogonalize against the stored directions */
+   for (i = 0; i < consdata->nstoredevs; ++i)
+   {
+      storedev = &(consdata->storedevs[i * blocksize]);
+
+      scalar = 0.0;
+      for (j = 0; j < blocksize; ++j)
+         scalar += storedev[j] * vector[j];
+
+      for (j = 0; j < blocksize; ++j)
+         vector[j] -= scalar * storedev[j];
+   }
+
+   for (j = 0; j < blocksize; ++j)
+      sqrnorm += vector[j] * vector[j];
+
+   /* skip the vector if it is (almost) contained in the span of the stored directions */
+   if ( sqrnorm <= 1e-6 * origsqrnorm )
+      return SCIP_OKAY;
+
+   /* determine position to store the direction */
+   if ( consdata->nstoredevs < consdata->maxnstoredevs )
+      storedev = &(consdata->storedevs[(consdata->nstoredevs++) * blocksize]);
+   else
+   {
+      storedev = &(consdata->storedevs[consdata->storedevspos * blocksize]);
+      consdata->storedevspos = (consdata->storedevspos + 1) % consdata->maxnstoredevs;
+   }
+
+   scalar = 1.0 / sqrt(sqrnorm);
+   for (j = 0; j < blocksize; ++j)
+      storedev[j] = scalar * vector[j];
+
+   return SCIP_OKAY;
+}
+
+/** separate current solution with cuts from the stored eigenvector directions that are violated by the solution matrix */
+static
+SCIP_RETCODE separateStoredEigenvectors(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   SCIP_Bool             enforce,            /**< whether we are in enforcing */
+   SCIP_SOL*             sol,                /**< primal solution that should be separated */
+   SCIP_Real*            fullmatrix,         /**< full matrix \f$ \sum_j A_j y_j - A_0 \f$ */
+   SCIP_Real             tol,                /**< tolerance for violation */
+   SCIP_Real*            vector,             /**< temporary workspace (length blocksize) */
+   SCIP_VAR**            vars,               /**< temporary workspace (length nvars) */
+   SCIP_Real*            vals,               /**< temporary workspace (length nvars) */
+   int*                  ngen,               /**< pointer to store the number of generated cuts/constraints */
+   SCIP_RESULT*          result              /**< pointer to store the result of the separation call */
+   )
+{
+   SCIP_Real* fullconstmatrix = NULL;
+   SCIP_Real* storedev;
+   SCIP_Bool success;
+   SCIP_Real scalar;
+   int blocksize;
+   int i;
+   int j;
+
+   assert( consdata != NULL );
+   assert( consdata->storedevs != NULL );
+   assert( consdata->nvars > 0 );
+   assert( fullmatrix != NULL );
+   assert( ngen != NULL );
+   assert( result != NULL );
+
+   blocksize = consdata->blocksize;
+
+   for (i = 0; i < consdata->nstoredevs && *result != SCIP_CUTOFF; ++i)
+   {
+      storedev = &(consdata->storedevs[i * blocksize]);
+
+      /* compute v^T (sum_j A_j y_j - A_0) v */
+      SCIP_CALL( SCIPlapackMatrixVectorMult(blocksize, blocksize, fullmatrix, storedev, vector) );
+
+      scalar = 0.0;
+      for (j = 0; j < blocksize; ++j)
+         scalar += storedev[j] * vector[j];
+
+      if ( scalar >= -tol )
+         continue;
+
+      SCIPdebugMsg(scip, "<%s>: stored eigenvector direction %d is violated by %.15g.\n", SCIPconsGetName(cons), i, -scalar);
+
+      if ( fullconstmatrix == NULL )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &fullconstmatrix, blocksize * blocksize) );
+         SCIP_CALL( SCIPconsSdpGetFullConstMatrix(scip, cons, fullconstmatrix) );
+      }
+
+      SCIP_CALL( produceCutFromEigenvector(scip, conshdlr, conshdlrdata, cons, consdata, enforce, sol,
+            blocksize, fullconstmatrix, storedev, vector, vars, vals, ngen, &success, result) );
+   }
+
+   SCIPfreeBufferArrayNull(scip, &fullconstmatrix);
+
+   return SCIP_OKAY;
+}
+
 /** separate current solution with a cut using the eigenvectors and -values of the solution matrix */
 static
 SCIP_RETCODE separateSol(
@@ -1618,7 +1861,8 @@ SCIP_RETCODE separateSol(
    SCIP_Real* eigenvectors;
    SCIP_Real* vector;
    SCIP_Real* fullmatrix;
-   SCIP_Real* fullmatrixcopy;
+   SCIP_Real* fullmatrixcopy = NULL;
+   SCIP_Real* eigmatrix;
    SCIP_Real* fullconstmatrix = NULL;
    SCIP_Real* eigenvalues;
    SCIP_Real tol;
@@ -1646,7 +1890,6 @@ SCIP_RETCODE separateSol(
    SCIP_CALL( SCIPallocBufferArray(scip, &vals, nvars) );
 
    SCIP_CALL( SCIPallocBufferArray(scip, &fullmatrix, blocksize * blocksize ) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &fullmatrixcopy, blocksize * blocksize ) );
    SCIP_CALL( SCIPallocBufferArray(scip, &eigenvectors, blocksize * blocksize) );
    SCIP_CALL( SCIPallocBufferArray(scip, &eigenvalues, blocksize) );
    SCIP_CALL( SCIPallocBufferArray(scip, &vector, blocksize) );
@@ -1654,10 +1897,6 @@ SCIP_RETCODE separateSol(
    /* compute the matrix \f$ \sum_j A_j y_j - A_0 \f$ */
    SCIP_CALL( computeFullSdpMatrix(scip, consdata, sol, fullmatrix) );
 
-   /* copy fullmatrix, since Lapack destroys it when computing eigenvalues! */
-   for (i = 0; i < blocksize * blocksize; i++)
-      fullmatrixcopy[i] = fullmatrix[i];
-
    /* determine tolerance */
    if ( conshdlrdata->sdpconshdlrdata->usedimacsfeastol )
    {
@@ -1672,11 +1911,45 @@ SCIP_RETCODE separateSol(
          tol = SCIPgetSepaMinEfficacy(scip);
    }
 
+   /* first check the eigenvector directions stored from earlier calls; if they produce a cut, we skip the eigenvalue
+    * computation */
+   if ( consdata->nstoredevs > 0 && consdata->nvars > 0 && conshdlrdata->sdpconshdlrdata->maxnstoredevs > 0 )
+   {
+      SCIP_CALL( separateStoredEigenvectors(scip, conshdlr, conshdlrdata, cons, consdata, enforce, sol, fullmatrix, tol,
+            vector, vars, vals, &ngen, result) );
+
+      if ( ngen > 0 || *result == SCIP_CUTOFF )
+      {
+         SCIPdebugMsg(scip, "<%s>: Separated cuts from stored eigenvectors = %d.\n", SCIPconsGetName(cons), ngen);
+         ++(conshdlrdata->sdpconshdlrdata->nstoredevcuts);
+
+         SCIPfreeBufferArray(scip, &vector);
+         SCIPfreeBufferArray(scip, &eigenvalues);
+         SCIPfreeBufferArray(scip, &eigenvectors);
+         SCIPfreeBufferArray(scip, &fullmatrix);
+
+         SCIPfreeBufferArray(scip, &vals);
+         SCIPfreeBufferArray(scip, &vars);
+
+         return SCIP_OKAY;
+      }
+   }
+
+   /* LAPACK destroys the matrix when computing eigenvalues; fullmatrix itself is only needed afterwards for multiple
+    * sparse cuts, so only then a copy is needed */
+   if ( conshdlrdata->sdpconshdlrdata->multiplesparsecuts )
+   {
+      SCIP_CALL( SCIPduplicateBufferArray(scip, &fullmatrixcopy, fullmatrix, blocksize * blocksize) );
+      eigmatrix = fullmatrixcopy;
+   }
+   else
+      eigmatrix = fullmatrix;
+
    /* compute eigenvector(s) */
    if ( conshdlrdata->sdpconshdlrdata->separateonecut || conshdlrdata->sdpconshdlrdata->multiplesparsecuts )
    {
       /* compute smallest eigenvalue */
-      retcode = SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), TRUE, blocksize, fullmatrixcopy, 1, eigenvalues, eigenvectors);
+      retcode = SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), TRUE, blocksize, eigmatrix, 1, eigenvalues, eigenvectors);
       if ( retcode == SCIP_OKAY )
       {
          if ( eigenvalues[0] < -tol )
@@ -1688,16 +1961,16 @@ SCIP_RETCODE separateSol(
    else
    {
       /* compute all eigenvectors for negative eigenvalues */
-      retcode = SCIPlapackComputeEigenvectorsNegative(SCIPbuffer(scip), blocksize, fullmatrixcopy, tol, &neigenvalues, eigenvalues, eigenvectors);
+      retcode = SCIPlapackComputeEigenvectorsNegative(SCIPbuffer(scip), blocksize, eigmatrix, tol, &neigenvalues, eigenvalues, eigenvectors);
    }
 
    /* treat possible error */
    if ( retcode != SCIP_OKAY )
    {
+      SCIPfreeBufferArrayNull(scip, &fullmatrixcopy);
       SCIPfreeBufferArray(scip, &vector);
       SCIPfreeBufferArray(scip, &eigenvalues);
       SCIPfreeBufferArray(scip, &eigenvectors);
-      SCIPfreeBufferArray(scip, &fullmatrixcopy);
       SCIPfreeBufferArray(scip, &fullmatrix);
 
       SCIPfreeBufferArray(scip, &vals);
@@ -1729,7 +2002,7 @@ SCIP_RETCODE separateSol(
    for (i = 0; i < neigenvalues && *result != SCIP_CUTOFF; ++i)
    {
       SCIP_Real* eigenvector;
-      SCIP_Bool success;
+      SCIP_Bool success = FALSE;
       int ncuts;
 
       /* get pointer to current eigenvector */
@@ -1741,10 +2014,7 @@ SCIP_RETCODE separateSol(
          SCIP_CALL( sparsifyCut(scip, conshdlr, conshdlrdata, cons, consdata, enforce, sol, blocksize, fullconstmatrix, eigenvector, vector, vars, vals, &ngen, &success, result) );
 
          if ( success )
-         {
             ++ngen;
-            continue;
-         }
       }
       else if ( conshdlrdata->sdpconshdlrdata->multiplesparsecuts )
       {
@@ -1756,7 +2026,6 @@ SCIP_RETCODE separateSol(
          {
             SCIPdebugMsg(scip, "Successfully added %d sparse eigenvector cuts.\n", ncuts);
             ngen += ncuts;
-            continue;
          }
       }
       else
@@ -1769,17 +2038,27 @@ SCIP_RETCODE separateSol(
          }
       }
 
-      /* produce cut/constraint */
-      SCIP_CALL( produceCutFromEigenvector(scip, conshdlr, conshdlrdata, cons, consdata, enforce, sol,
-            blocksize, fullconstmatrix, eigenvector, vector, vars, vals, &ngen, &success, result) );
+      /* produce cut/constraint from the full eigenvector if no sparse cut was generated */
+      if ( ! success )
+      {
+         SCIP_CALL( produceCutFromEigenvector(scip, conshdlr, conshdlrdata, cons, consdata, enforce, sol,
+               blocksize, fullconstmatrix, eigenvector, vector, vars, vals, &ngen, &success, result) );
+      }
+
+      /* remember direction for later separation calls; for sparse cuts, the full eigenvector is stored */
+      if ( success && conshdlrdata->sdpconshdlrdata->maxnstoredevs > 0 && ! conshdlrdata->sdpconshdlrdata->dropcaches )
+      {
+         SCIP_CALL( storeEigenvector(scip, consdata, conshdlrdata->sdpconshdlrdata->maxnstoredevs, eigenvector, vector) );
+         updateConsMemory(cons);
+      }
    }
    SCIPdebugMsg(scip, "<%s>: Separated cuts = %d.\n", SCIPconsGetName(cons), ngen);
 
    SCIPfreeBufferArrayNull(scip, &fullconstmatrix);
+   SCIPfreeBufferArrayNull(scip, &fullmatrixcopy);
    SCIPfreeBufferArray(scip, &vector);
    SCIPfreeBufferArray(scip, &eigenvalues);
    SCIPfreeBufferArray(scip, &eigenvectors);
-   SCIPfreeBufferArray(scip, &fullmatrixcopy);
    SCIPfreeBufferArray(scip, &fullmatrix);
 
    SCIPfreeBufferArray(scip, &vals);
@@ -1788,6 +2067,50 @@ SCIP_RETCODE separateSol(
    return SCIP_OKAY;
 }
 
+/** checks whether all matrices \f$ A_j \f$ of a constraint are psd
+ *
+ *  Only reads the constraint data and uses the given buffer memory, so that it can be called for different constraints
+ *  in parallel.
+ */
+static
+SCIP_RETCODE checkAllmatricespsd(
+   SCIP*                 scip,               /**< SCIP pointer */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory used for the computations */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_Real*            Aj,                 /**< workspace for matrices (length blocksize * blocksize) */
+   SCIP_Bool*            allmatricespsd      /**< pointer to store whether all matrices are psd */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   int blocksize;
+   int v;
+
+   assert( scip != NULL );
+   assert( bufmem != NULL );
+   assert( cons != NULL );
+   assert( Aj != NULL );
+   assert( allmatricespsd != NULL );
+
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+   blocksize = consdata->blocksize;
+
+   *allmatricespsd = TRUE;
+   for (v = 0; v < consdata->nvars && *allmatricespsd; ++v)
+   {
+      SCIP_Real eigenvalue;
+
+      SCIP_CALL( SCIPconsSdpGetFullAj(scip, cons, v, Aj) );
+
+      /* compute minimal eigenvalue */
+      SCIP_CALL( SCIPlapackComputeIthEigenvalue(bufmem, FALSE, blocksize, Aj, 1, &eigenvalue, NULL) );
+      if ( SCIPisNegative(scip, eigenvalue) )
+         *allmatricespsd = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** check whether all matrices are psd
  *
  *  Only needs to be called by rank-1 constraints to check whether all matrices are psd.
@@ -1801,7 +2124,6 @@ SCIP_RETCODE computeAllmatricespsd(
    SCIP_CONSDATA* consdata;
    SCIP_Real* Aj;
    int blocksize;
-   int v;
 
    assert( scip != NULL );
    assert( cons != NULL );
@@ -1820,18 +2142,7 @@ SCIP_RETCODE computeAllmatricespsd(
 
    SCIPdebugMsg(scip, "Computing allmatricespsd for constraint <%s>.\n", SCIPconsGetName(cons));
 
-   consdata->allmatricespsd = TRUE;
-   for (v = 0; v < consdata->nvars && consdata->allmatricespsd; ++v)
-   {
-      SCIP_Real eigenvalue;
-
-      SCIP_CALL( SCIPconsSdpGetFullAj(scip, cons, v, Aj) );
-
-      /* compute minimal eigenvalue */
-      SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, Aj, 1, &eigenvalue, NULL) );
-      if ( SCIPisNegative(scip, eigenvalue) )
-         consdata->allmatricespsd = FALSE;
-   }
+   SCIP_CALL( checkAllmatricespsd(scip, SCIPbuffer(scip), cons, Aj, &consdata->allmatricespsd) );
 
    SCIPfreeBufferArray(scip, &Aj);
 
@@ -1840,115 +2151,637 @@ SCIP_RETCODE computeAllmatricespsd(
    return SCIP_OKAY;
 }
 
-/** try to tighten matrices if all matrices are psd
+/** computes the eigenvalue information of one constraint needed in presolving
  *
- *  Try to scale matrices without changing feasible solutions. The details are explained in the presolving paper (see
- *  the top of the file).
+ *  For a constraint without variables, the maximal eigenvalue of the constant matrix is computed. If @p computepsd is
+ *  true and allmatricespsd has not been initialized, it is checked whether all matrices are psd.
  */
 static
-SCIP_RETCODE tightenMatrices(
-   SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_CONS**           conss,              /**< array of constraints to add cuts for */
-   int                   nconss,             /**< number of constraints to add cuts for */
+SCIP_RETCODE presolComputeConsEigenvalues(
+   SCIP*                 scip,               /**< SCIP pointer */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory used for the computations */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_Bool             computepsd,         /**< whether allmatricespsd should be computed */
+   SCIP_Real*            maxconsteigenval,   /**< pointer to store maximal eigenvalue of constant matrix (or SCIP_INVALID) */
+   SCIP_Bool*            allmatricespsd,     /**< pointer to store whether all matrices are psd */
+   SCIP_Bool*            computedpsd         /**< pointer to store whether allmatricespsd has been computed */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   SCIP_Real* matrix;
+   int blocksize;
+
+   assert( cons != NULL );
+   assert( maxconsteigenval != NULL );
+   assert( allmatricespsd != NULL );
+   assert( computedpsd != NULL );
+
+   *maxconsteigenval = SCIP_INVALID;
+   *allmatricespsd = FALSE;
+   *computedpsd = FALSE;
+
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+
+   if ( consdata->nvars > 0 && ( ! computepsd || consdata->initallmatricespsd ) )
+      return SCIP_OKAY;
+
+   blocksize = consdata->blocksize;
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &matrix, blocksize * blocksize) );
+
+   if ( consdata->nvars <= 0 )
+   {
+      SCIP_CALL( SCIPconsSdpGetFullConstMatrix(scip, cons, matrix) );
+      SCIP_CALL( SCIPlapackComputeIthEigenvalue(bufmem, FALSE, blocksize, matrix, blocksize, maxconsteigenval, NULL) );
+   }
+   else
+   {
+      SCIP_CALL( checkAllmatricespsd(scip, bufmem, cons, matrix, allmatricespsd) );
+      *computedpsd = TRUE;
+   }
+
+   BMSfreeBufferMemoryArray(bufmem, &matrix);
+
+   return SCIP_OKAY;
+}
+
+/** creates the buffer memories for the threads of a parallel loop in presolving
+ *
+ *  The buffer memory of SCIP is not thread safe, so every additional thread gets its own; the first thread uses the
+ *  buffer memory of SCIP. If a buffer memory cannot be created, SCIP_NOMEMORY is returned and @p nbufmems contains the
+ *  number of buffer memories that have to be freed with freeThreadBufmems().
+ */
+static
+SCIP_RETCODE createThreadBufmems(
+   SCIP*                 scip,               /**< SCIP pointer */
+   int                   nthreads,           /**< number of threads */
+   BMS_BUFMEM**          bufmems,            /**< array to store the buffer memories (length nthreads) */
+   int*                  nbufmems            /**< pointer to store the number of buffer memories */
+   )
+{
+   SCIP_Real arraygrowfac;
+   int arraygrowinit;
+
+   assert( scip != NULL );
+   assert( nthreads >= 1 );
+   assert( bufmems != NULL );
+   assert( nbufmems != NULL );
+
+   SCIP_CALL( SCIPgetRealParam(scip, "memory/arraygrowfac", &arraygrowfac) );
+   SCIP_CALL( SCIPgetIntParam(scip, "memory/arraygrowinit", &arraygrowinit) );
+
+   bufmems[0] = SCIPbuffer(scip);
+   for (*nbufmems = 1; *nbufmems < nthreads; ++(*nbufmems))
+   {
+      bufmems[*nbufmems] = BMScreateBufferMemory(arraygrowfac, arraygrowinit, FALSE);
+      if ( bufmems[*nbufmems] == NULL )
+      {
+         SCIPerrorMessage("Could not create buffer memory for thread %d.\n", *nbufmems);
+         return SCIP_NOMEMORY;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the buffer memories created by createThreadBufmems() */
+static
+void freeThreadBufmems(
+   BMS_BUFMEM**          bufmems,            /**< buffer memories */
+   int                   nbufmems            /**< number of buffer memories */
+   )
+{
+   int t;
+
+   assert( bufmems != NULL );
+
+   /* the first buffer memory is the one of SCIP */
+   for (t = nbufmems - 1; t >= 1; --t)
+      BMSdestroyBufferMemory(&bufmems[t]);
+}
+
+/** returns the number of the current thread within a parallel loop */
+static
+int getThreadNum(
+   void
+   )
+{
+#ifdef OMP
+   return omp_get_thread_num();
+#else
+   return 0;
+#endif
+}
+
+/** computes the eigenvalue information of all constraints needed in presolving, possibly in parallel
+ *
+ *  The computations for the different constraints only read the constraint data and write their results into arrays
+ *  indexed by the constraints. Each thread uses its own buffer memory. The results are afterwards stored in the
+ *  constraint data by the calling thread in the order of the constraints, so that the outcome does not depend on the
+ *  number of threads.
+ */
+static
+SCIP_RETCODE presolComputeEigenvalues(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_CONS**           conss,              /**< array of constraints */
+   int                   nconss,             /**< number of constraints */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_Bool             computepsd,         /**< whether allmatricespsd should be computed */
+   SCIP_Real*            maxconsteigenvals   /**< array to store maximal eigenvalues of the constant matrices of constraints
+                                              *   without variables (SCIP_INVALID for other constraints) */
+   )
+{
+   BMS_BUFMEM** bufmems;
+   SCIP_RETCODE* retcodes;
+   SCIP_RETCODE retcode;
+   SCIP_Bool* allmatricespsd;
+   SCIP_Bool* computedpsd;
+   int nbufmems = 0;
+   int c;
+
+   assert( scip != NULL );
+   assert( conss != NULL || nconss == 0 );
+   assert( nthreads >= 1 );
+   assert( maxconsteigenvals != NULL );
+
+   if ( nconss == 0 )
+      return SCIP_OKAY;
+
+   if ( nthreads > nconss )
+      nthreads = nconss;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &retcodes, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &allmatricespsd, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &computedpsd, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bufmems, nthreads) );
+
+   retcode = createThreadBufmems(scip, nthreads, bufmems, &nbufmems);
+
+   if ( retcode == SCIP_OKAY )
+   {
+      /* run BLAS/LAPACK single-threaded within the loop to avoid oversubscription; this also makes the results of each
+       * constraint independent of the number of threads, and since they are stored per constraint and used in the order
+       * of the constraints below, the scheduling does not influence the result */
+      SCIPlapackEnterParallelRegion();
+
+#ifdef OMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+      for (c = 0; c < nconss; ++c)
+      {
+         retcodes[c] = presolComputeConsEigenvalues(scip, bufmems[getThreadNum()], conss[c], computepsd, &maxconsteigenvals[c],
+            &allmatricespsd[c], &computedpsd[c]);
+      }
+
+      SCIPlapackLeaveParallelRegion();
+
+      /* store results in the order of the constraints; stop at the first error */
+      for (c = 0; c < nconss; ++c)
+      {
+         SCIP_CONSDATA* consdata;
+
+         if ( retcodes[c] != SCIP_OKAY )
+         {
+            retcode = retcodes[c];
+            break;
+         }
+
+         if ( computedpsd[c] )
+         {
+            consdata = SCIPconsGetData(conss[c]);
+            assert( consdata != NULL );
+
+            consdata->allmatricespsd = allmatricespsd[c];
+            consdata->initallmatricespsd = TRUE;
+         }
+      }
+   }
+
+   freeThreadBufmems(bufmems, nbufmems);
+
+   SCIPfreeBufferArray(scip, &bufmems);
+   SCIPfreeBufferArray(scip, &computedpsd);
+   SCIPfreeBufferArray(scip, &allmatricespsd);
+   SCIPfreeBufferArray(scip, &retcodes);
+
+   return retcode;
+}
+
+/** computes the tightening factors of the matrices of one constraint if all matrices are psd
+ *
+ *  Only reads the constraint data, so that it can be called for several constraints in parallel, see tightenMatrices().
+ */
+static
+SCIP_RETCODE tightenConsMatrices(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory used for the computations */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_Real*            factors             /**< array to store the tightening factor of each variable (length nvars;
+                                              *   SCIP_INVALID if the matrix is not tightened) */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   SCIP_Real* constmatrix;
+   int blocksize;
+   int nvars;
+   int i;
+
+   assert( scip != NULL );
+   assert( bufmem != NULL );
+   assert( cons != NULL );
+   assert( factors != NULL );
+
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+   assert( ! consdata->rankone || consdata->initallmatricespsd );
+
+   nvars = consdata->nvars;
+   for (i = 0; i < nvars; ++i)
+      factors[i] = SCIP_INVALID;
+
+   /* skip constraints in which not all matrices are psd */
+   if ( ! consdata->allmatricespsd )
+      return SCIP_OKAY;
+
+   /* make sure that all lower bounds are nonnegative */
+   for (i = 0; i < nvars; ++i)
+   {
+      if ( SCIPisNegative(scip, SCIPvarGetLbGlobal(consdata->vars[i])) )
+         return SCIP_OKAY;
+   }
+
+   SCIPdebugMsg(scip, "Trying to tighten matrices for constraint <%s>.\n", SCIPconsGetName(cons));
+
+   /* get matrices */
+   blocksize = consdata->blocksize;
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &constmatrix, blocksize * blocksize) );
+
+   SCIP_CALL( SCIPconsSdpGetFullConstMatrix(scip, cons, constmatrix) );
+
+   for (i = 0; i < nvars; ++i)
+   {
+      SCIP_Real objval;
+      SCIP_Real factor;
+      SCIP_Real lb;
+      SCIP_Real ub;
+
+      /* only treat binary variables */
+      if ( ! SCIPvarIsBinary(consdata->vars[i]) )
+         continue;
+
+      /* skip fixed variables (will be removed anyway */
+      lb = SCIPvarGetLbLocal(consdata->vars[i]);
+      ub = SCIPvarGetUbLocal(consdata->vars[i]);
+      if ( SCIPisEQ(scip, lb, ub) )
+         continue;
+
+      assert( SCIPisEQ(scip, lb, 0.0) );
+      assert( SCIPisEQ(scip, ub, 1.0) );
+
+      /* solve 1d SDP */
+      SCIP_CALL( SCIPsolveOneVarSDPDense(bufmem, 1.0, 0.0, 1.0, blocksize, constmatrix, consdata->nvarnonz[i], consdata->row[i], consdata->col[i], consdata->val[i],
+            SCIPinfinity(scip), SCIPfeastol(scip), &objval, &factor) );
+
+      if ( SCIPisInfinity(scip, objval) )
+         continue;
+
+      if ( factor == SCIP_INVALID ) /*lint !e777*/
+         continue;
+
+      if ( ! SCIPisFeasEQ(scip, factor, 1.0) )
+         factors[i] = factor;
+   }
+
+   BMSfreeBufferMemoryArray(bufmem, &constmatrix);
+
+   return SCIP_OKAY;
+}
+
+/** try to tighten matrices if all matrices are psd
+ *
+ *  Try to scale matrices without changing feasible solutions. The details are explained in the presolving paper (see
+ *  the top of the file).
+ *
+ *  The one-variable SDPs of the different constraints are solved in parallel with @p nthreads threads, see
+ *  tightenConsMatrices(). The matrices are scaled afterwards by the calling thread.
+ */
+static
+SCIP_RETCODE tightenMatrices(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< array of constraints to add cuts for */
+   int                   nconss,             /**< number of constraints to add cuts for */
+   int                   nthreads,           /**< number of threads to use */
    int*                  nchgcoefs           /**< pointer to store how many matrices were tightened */
    )
 {
+   BMS_BUFMEM** bufmems;
+   SCIP_RETCODE* retcodes;
+   SCIP_RETCODE retcode;
+   SCIP_Real* factors;
+   int* varbeg;
+   int nbufmems = 0;
    int c;
 
    assert( scip != NULL );
+   assert( conss != NULL || nconss == 0 );
+   assert( nthreads >= 1 );
    assert( nchgcoefs != NULL );
 
+   if ( nconss == 0 )
+      return SCIP_OKAY;
+
+   if ( nthreads > nconss )
+      nthreads = nconss;
+
+   /* compute allmatricespsd for rank-1 constraints and the position of the factors of each constraint */
+   SCIP_CALL( SCIPallocBufferArray(scip, &varbeg, nconss + 1) );
+   varbeg[0] = 0;
    for (c = 0; c < nconss; ++c)
    {
       SCIP_CONSDATA* consdata;
-      SCIP_Real* constmatrix;
-      int blocksize;
-      int nvars;
-      int i;
 
-      assert( conss != NULL );
       assert( conss[c] != NULL );
-
       consdata = SCIPconsGetData(conss[c]);
       assert( consdata != NULL );
       assert( consdata->rankone || strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), CONSHDLR_NAME) == 0 );
       assert( ! consdata->rankone || strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), CONSHDLRRANK1_NAME) == 0 );
 
-      /* compute allmatricespsd for rank-1 constraints */
       if ( consdata->rankone )
       {
          SCIP_CALL( computeAllmatricespsd(scip, conss[c]) );
       }
 
-      /* skip constraints in which not all matrices are psd */
-      if ( ! consdata->allmatricespsd )
-         continue;
+      varbeg[c + 1] = varbeg[c] + consdata->nvars;
+   }
 
-      /* make sure that all lower bounds are nonnegative */
-      nvars = consdata->nvars;
-      for (i = 0; i < nvars; ++i)
+   SCIP_CALL( SCIPallocBufferArray(scip, &factors, varbeg[nconss]) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &retcodes, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bufmems, nthreads) );
+
+   retcode = createThreadBufmems(scip, nthreads, bufmems, &nbufmems);
+
+   if ( retcode == SCIP_OKAY )
+   {
+      SCIPlapackEnterParallelRegion();
+
+#ifdef OMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+      for (c = 0; c < nconss; ++c)
+         retcodes[c] = tightenConsMatrices(scip, bufmems[getThreadNum()], conss[c], &factors[varbeg[c]]);
+
+      SCIPlapackLeaveParallelRegion();
+
+      /* scale the matrices in the order of the constraints; stop at the first error */
+      for (c = 0; c < nconss; ++c)
       {
-         if ( SCIPisNegative(scip, SCIPvarGetLbGlobal(consdata->vars[i])) )
+         SCIP_CONSDATA* consdata;
+         int i;
+
+         if ( retcodes[c] != SCIP_OKAY )
+         {
+            retcode = retcodes[c];
             break;
+         }
+
+         consdata = SCIPconsGetData(conss[c]);
+         assert( consdata != NULL );
+
+         for (i = 0; i < consdata->nvars; ++i)
+         {
+            SCIP_Real factor;
+            int j;
+
+            factor = factors[varbeg[c] + i];
+            if ( factor == SCIP_INVALID ) /*lint !e777*/
+               continue;
+
+            SCIPdebugMsg(scip, "Tightened coefficent matrix of variable <%s> with tightening factor %g.\n", SCIPvarGetName(consdata->vars[i]), factor);
+
+            /* tighten matrix */
+            for (j = 0; j < consdata->nvarnonz[i]; j++)
+               consdata->val[i][j] *= factor;
+
+            ++(*nchgcoefs);
+         }
       }
-      if ( i < nvars )
+   }
+
+   freeThreadBufmems(bufmems, nbufmems);
+
+   SCIPfreeBufferArray(scip, &bufmems);
+   SCIPfreeBufferArray(scip, &retcodes);
+   SCIPfreeBufferArray(scip, &factors);
+   SCIPfreeBufferArray(scip, &varbeg);
+
+   return retcode;
+}
+
+/** computes tighter lower bounds of the variables of one constraint if all matrices are psd
+ *
+ *  Only reads the constraint data and the bounds of the variables, so that it can be called for several constraints in
+ *  parallel, see tightenBounds().
+ */
+static
+SCIP_RETCODE tightenConsBounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory used for the computations */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_Bool             tightenboundscont,  /**< Should only continuous variables be tightened? */
+   SCIP_Real*            newlbs,             /**< array to store the new lower bound of each variable (length nvars;
+                                              *   SCIP_INVALID if the bound is not tightened) */
+   SCIP_Bool*            infeasible          /**< pointer to store whether infeasibility was detected */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   SCIP_Real* matrix = NULL;
+   SCIP_Real* constmatrix;
+   SCIP_Real factor;
+   SCIP_Bool havebinaryvar = FALSE;
+   int blocksize;
+   int nvars;
+   int i;
+
+   assert( scip != NULL );
+   assert( bufmem != NULL );
+   assert( cons != NULL );
+   assert( newlbs != NULL );
+   assert( infeasible != NULL );
+
+   *infeasible = FALSE;
+
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+   assert( ! consdata->rankone || consdata->initallmatricespsd );
+
+   nvars = consdata->nvars;
+   for (i = 0; i < nvars; ++i)
+      newlbs[i] = SCIP_INVALID;
+
+   /* skip constraints in which not all matrices are psd */
+   if ( ! consdata->allmatricespsd )
+      return SCIP_OKAY;
+
+   /* make sure that all upper bounds finite */
+   for (i = 0; i < nvars; ++i)
+   {
+      if ( SCIPisInfinity(scip, SCIPvarGetUbLocal(consdata->vars[i])) )
+         return SCIP_OKAY;
+
+      if ( SCIPvarIsBinary(consdata->vars[i]) )
+         havebinaryvar = TRUE;
+   }
+
+   SCIPdebugMsg(scip, "Trying to tighten bounds for constraint <%s>.\n", SCIPconsGetName(cons));
+
+   /* get matrices */
+   blocksize = consdata->blocksize;
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &constmatrix, blocksize * blocksize) );
+   if ( havebinaryvar )
+   {
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &matrix, blocksize * blocksize) );
+   }
+
+   for (i = 0; i < nvars; ++i)
+   {
+      SCIP_Real* sdpval;
+      SCIP_Real lb;
+      SCIP_Real ub;
+      SCIP_Real ubk;
+      SCIP_Real objval;
+      int* sdprow;
+      int* sdpcol;
+      int sdpnnonz;
+      int row;
+      int col;
+      int k;
+      int l;
+
+      /* possibly restrict tightening to continuous variables */
+      if ( tightenboundscont && SCIPvarIsIntegral(consdata->vars[i]) )
          continue;
 
-      SCIPdebugMsg(scip, "Trying to tighten matrices for constraint <%s>.\n", SCIPconsGetName(conss[c]));
+      /* skip fixed variables */
+      lb = SCIPvarGetLbLocal(consdata->vars[i]);
+      ub = SCIPvarGetUbLocal(consdata->vars[i]);
+      if ( SCIPisEQ(scip, lb, ub) )
+         continue;
 
-      /* get matrices */
-      blocksize = consdata->blocksize;
-      SCIP_CALL( SCIPallocBufferArray(scip, &constmatrix, blocksize * blocksize) );
+      /* skip infinite lower bound (cannot currently deal with this in SCIPsolveOneVarSDPDense()) */
+      assert( ! SCIPisInfinity(scip, ub) );
+      if ( SCIPisInfinity(scip, -lb) )
+         continue;
 
-      SCIP_CALL( SCIPconsSdpGetFullConstMatrix(scip, conss[c], constmatrix) );
+      /* get fresh copy of the constant matrix */
+      SCIP_CALL( SCIPconsSdpGetFullConstMatrix(scip, cons, constmatrix) );
 
-      for (i = 0; i < nvars; ++i)
+      /* loop over other variables */
+      for (k = 0; k < nvars; ++k)
       {
-         SCIP_Real objval;
-         SCIP_Real factor;
-         SCIP_Real lb;
-         SCIP_Real ub;
-
-         /* only treat binary variables */
-         if ( ! SCIPvarIsBinary(consdata->vars[i]) )
+         if ( k == i )
             continue;
 
-         /* skip fixed variables (will be removed anyway */
-         lb = SCIPvarGetLbLocal(consdata->vars[i]);
-         ub = SCIPvarGetUbLocal(consdata->vars[i]);
-         if ( SCIPisEQ(scip, lb, ub) )
-            continue;
+         ubk = SCIPvarGetUbLocal(consdata->vars[k]);
 
-         assert( SCIPisEQ(scip, lb, 0.0) );
-         assert( SCIPisEQ(scip, ub, 1.0) );
+         /* subtract matrix times upper bound from constant matrix (because of minus const. matrix) */
+         if ( ! SCIPisZero(scip, ubk) )
+         {
+            sdprow = consdata->row[k];
+            sdpcol = consdata->col[k];
+            sdpval = consdata->val[k];
+            sdpnnonz = consdata->nvarnonz[k];
+            for (l = 0; l < sdpnnonz; ++l)
+            {
+               row = sdprow[l];
+               col = sdpcol[l];
+               constmatrix[row * blocksize + col] -= sdpval[l] * ubk;
+               if ( row != col )
+                  constmatrix[col * blocksize + row] -= sdpval[l] * ubk;
+            }
+         }
+      }
 
-         /* solve 1d SDP */
-         SCIP_CALL( SCIPsolveOneVarSDPDense(SCIPbuffer(scip), 1.0, 0.0, 1.0, blocksize, constmatrix, consdata->nvarnonz[i], consdata->row[i], consdata->col[i], consdata->val[i],
-               SCIPinfinity(scip), SCIPfeastol(scip), &objval, &factor) );
+      /* special handling of binary variables */
+      if ( SCIPvarIsBinary(consdata->vars[i]) )
+      {
+         SCIP_Real eigenvalue;
 
-         if ( SCIPisInfinity(scip, objval) )
-            continue;
+         assert( matrix != NULL );
 
-         if ( factor == SCIP_INVALID ) /*lint !e777*/
+         /* first copy constant matrix (possibly needed later) */
+         for (l = 0; l < blocksize * blocksize; ++l)
+            matrix[l] = - constmatrix[l];
+
+         /* compute maximal eigenvalue; this corresponds to checking the lower bound because of minus sign; constmatrix is destroyed. */
+         SCIP_CALL( SCIPlapackComputeIthEigenvalue(bufmem, FALSE, blocksize, constmatrix, blocksize, &eigenvalue, NULL) );
+
+         /* take minus sign into account */
+         eigenvalue = -eigenvalue;
+
+         /* if the negative of the constant matrix is psd, then the lower bound (= 0) is feasible -> cannot tighten */
+         if ( SCIPisFeasGE(scip, eigenvalue, 0.0) )
             continue;
+         assert( SCIPisFeasNegative(scip, eigenvalue) );
 
-         if ( ! SCIPisFeasEQ(scip, factor, 1.0) )
+         /* otherwise, we check whether the upper bound is feasible */
+
+         /* add matrix i for evaluating upper bound */
+         sdprow = consdata->row[i];
+         sdpcol = consdata->col[i];
+         sdpval = consdata->val[i];
+         sdpnnonz = consdata->nvarnonz[i];
+         for (l = 0; l < sdpnnonz; ++l)
          {
-            int j;
+            row = sdprow[l];
+            col = sdpcol[l];
+            matrix[row * blocksize + col] += sdpval[l];
+            if ( row != col )
+               matrix[col * blocksize + row] += sdpval[l];
+         }
 
-            SCIPdebugMsg(scip, "Tightened coefficent matrix of variable <%s> with tightening factor %g.\n", SCIPvarGetName(consdata->vars[i]), factor);
+         /* compute minimal eigenvalue; matrix is destroyed */
+         SCIP_CALL( SCIPlapackComputeIthEigenvalue(bufmem, FALSE, blocksize, matrix, 1, &eigenvalue, NULL) );
 
-            /* tighten matrix */
-            for (j = 0; j < consdata->nvarnonz[i]; j++)
-               consdata->val[i][j] *= factor;
+         /* if matrix is not psd, we are infeasible */
+         if ( SCIPisFeasNegative(scip, eigenvalue) )
+         {
+            SCIPdebugMsg(scip, "Binary variable <%s> yields infeasibility.\n", SCIPvarGetName(consdata->vars[i]));
+            *infeasible = TRUE;
+            break;
+         }
 
-            ++(*nchgcoefs);
+         /* otherwise, we need at least the matrix for variable i to become feasible -> can tighten variable to 1 */
+         factor = 0.5;
+         SCIPdebugMsg(scip, "Tighten lower bound for binary variable <%s> to 1.\n", SCIPvarGetName(consdata->vars[i]));
+      }
+      else
+      {
+         /* solve 1d SDP */
+         SCIP_CALL( SCIPsolveOneVarSDPDense(bufmem, 1.0, lb, ub, blocksize, constmatrix, consdata->nvarnonz[i], consdata->row[i], consdata->col[i], consdata->val[i],
+               SCIPinfinity(scip), SCIPfeastol(scip), &objval, &factor) );
+
+         /* if problem is infeasible */
+         if ( SCIPisInfinity(scip, objval) )
+         {
+            SCIPdebugMsg(scip, "Variable <%s> yields infeasibility.\n", SCIPvarGetName(consdata->vars[i]));
+            *infeasible = TRUE;
+            break;
          }
+
+         if ( factor == SCIP_INVALID ) /*lint !e777*/
+            continue;
       }
 
-      SCIPfreeBufferArray(scip, &constmatrix);
+      if ( SCIPisGT(scip, factor, lb) )
+         newlbs[i] = factor;
    }
 
+   if ( matrix != NULL )
+   {
+      BMSfreeBufferMemoryArray(bufmem, &matrix);
+   }
+   BMSfreeBufferMemoryArray(bufmem, &constmatrix);
+
    return SCIP_OKAY;
 }
 
@@ -1956,21 +2789,37 @@ SCIP_RETCODE tightenMatrices(
  *
  *  Try to compute tighter variable bounds by solving one-variable SDPs. The details are explained in the presolving
  *  paper (see the top of the file).
+ *
+ *  The one-variable SDPs of the different constraints are solved in parallel with @p nthreads threads, see
+ *  tightenConsBounds(), using the bounds from the start of the call. The bounds are changed afterwards by the calling
+ *  thread in the order of the constraints, so that the outcome does not depend on the number of threads. A bound that
+ *  was tightened for one constraint is thus not used for the one-variable SDPs of other constraints within the same
+ *  call; the bounds computed for these are still valid.
  */
 static
 SCIP_RETCODE tightenBounds(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONS**           conss,              /**< array of constraints to add cuts for */
    int                   nconss,             /**< number of constraints to add cuts for */
+   int                   nthreads,           /**< number of threads to use */
    SCIP_Bool             tightenboundscont,  /**< Should only continuous variables be tightened? */
    int*                  nchgbds,            /**< pointer to store how many bounds were tightened */
    int*                  nintrnd,            /**< pointer to store how many tightened bounds of integer variables were rounded to be integral */
    SCIP_Bool*            infeasible          /**< pointer to store whether infeasibility was detected */
    )
 {
+   BMS_BUFMEM** bufmems;
+   SCIP_RETCODE* retcodes;
+   SCIP_RETCODE retcode;
+   SCIP_Real* newlbs;
+   SCIP_Bool* consinfeasible;
+   int* varbeg;
+   int nbufmems = 0;
    int c;
 
    assert( scip != NULL );
+   assert( conss != NULL || nconss == 0 );
+   assert( nthreads >= 1 );
    assert( nchgbds != NULL );
    assert( nintrnd != NULL );
    assert( infeasible != NULL );
@@ -1979,217 +2828,120 @@ SCIP_RETCODE tightenBounds(
    *nintrnd = 0;
    *infeasible = FALSE;
 
-   for (c = 0; c < nconss && !(*infeasible); ++c)
+   if ( nconss == 0 )
+      return SCIP_OKAY;
+
+   if ( nthreads > nconss )
+      nthreads = nconss;
+
+   /* compute allmatricespsd for rank-1 constraints and the position of the bounds of each constraint */
+   SCIP_CALL( SCIPallocBufferArray(scip, &varbeg, nconss + 1) );
+   varbeg[0] = 0;
+   for (c = 0; c < nconss; ++c)
    {
       SCIP_CONSDATA* consdata;
-      SCIP_Real* matrix = NULL;
-      SCIP_Real* constmatrix;
-      SCIP_Real factor;
-      SCIP_Bool havebinaryvar = FALSE;
-      int blocksize;
-      int nvars;
-      int i;
 
-      assert( conss != NULL );
       assert( conss[c] != NULL );
-
       consdata = SCIPconsGetData(conss[c]);
       assert( consdata != NULL );
       assert( consdata->rankone || strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), CONSHDLR_NAME) == 0 );
       assert( ! consdata->rankone || strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), CONSHDLRRANK1_NAME) == 0 );
 
-      /* compute allmatricespsd for rank-1 constraints */
       if ( consdata->rankone )
       {
          SCIP_CALL( computeAllmatricespsd(scip, conss[c]) );
       }
 
-      /* skip constraints in which not all matrices are psd */
-      if ( ! consdata->allmatricespsd )
-         continue;
+      varbeg[c + 1] = varbeg[c] + consdata->nvars;
+   }
 
-      /* make sure that all upper bounds finite */
-      nvars = consdata->nvars;
-      for (i = 0; i < nvars; ++i)
-      {
-         if ( SCIPisInfinity(scip, SCIPvarGetUbLocal(consdata->vars[i])) )
-            break;
+   SCIP_CALL( SCIPallocBufferArray(scip, &newlbs, varbeg[nconss]) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &consinfeasible, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &retcodes, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bufmems, nthreads) );
 
-         if ( SCIPvarIsBinary(consdata->vars[i]) )
-            havebinaryvar = TRUE;
-      }
-      if ( i < nvars )
-         continue;
+   retcode = createThreadBufmems(scip, nthreads, bufmems, &nbufmems);
 
-      SCIPdebugMsg(scip, "Trying to tighten bounds for constraint <%s>.\n", SCIPconsGetName(conss[c]));
+   if ( retcode == SCIP_OKAY )
+   {
+      SCIPlapackEnterParallelRegion();
 
-      /* get matrices */
-      blocksize = consdata->blocksize;
-      SCIP_CALL( SCIPallocBufferArray(scip, &constmatrix, blocksize * blocksize) );
-      if ( havebinaryvar )
+#ifdef OMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+      for (c = 0; c < nconss; ++c)
       {
-         SCIP_CALL( SCIPallocBufferArray(scip, &matrix, blocksize * blocksize) );
+         retcodes[c] = tightenConsBounds(scip, bufmems[getThreadNum()], conss[c], tightenboundscont, &newlbs[varbeg[c]],
+            &consinfeasible[c]);
       }
 
-      for (i = 0; i < nvars; ++i)
-      {
-         SCIP_Real* sdpval;
-         SCIP_Real lb;
-         SCIP_Real ub;
-         SCIP_Real ubk;
-         SCIP_Real objval;
-         int* sdprow;
-         int* sdpcol;
-         int sdpnnonz;
-         int row;
-         int col;
-         int k;
-         int l;
+      SCIPlapackLeaveParallelRegion();
 
-         /* possibly restrict tightening to continuous variables */
-         if ( tightenboundscont && SCIPvarIsIntegral(consdata->vars[i]) )
-            continue;
-
-         /* skip fixed variables */
-         lb = SCIPvarGetLbLocal(consdata->vars[i]);
-         ub = SCIPvarGetUbLocal(consdata->vars[i]);
-         if ( SCIPisEQ(scip, lb, ub) )
-            continue;
-
-         /* skip infinite lower bound (cannot currently deal with this in SCIPsolveOneVarSDPDense()) */
-         assert( ! SCIPisInfinity(scip, ub) );
-         if ( SCIPisInfinity(scip, -lb) )
-            continue;
-
-         /* get fresh copy of the constant matrix */
-         SCIP_CALL( SCIPconsSdpGetFullConstMatrix(scip, conss[c], constmatrix) );
-
-         /* loop over other variables */
-         for (k = 0; k < nvars; ++k)
-         {
-            if ( k == i )
-               continue;
-
-            ubk = SCIPvarGetUbLocal(consdata->vars[k]);
-
-            /* subtract matrix times upper bound from constant matrix (because of minus const. matrix) */
-            if ( ! SCIPisZero(scip, ubk) )
-            {
-               sdprow = consdata->row[k];
-               sdpcol = consdata->col[k];
-               sdpval = consdata->val[k];
-               sdpnnonz = consdata->nvarnonz[k];
-               for (l = 0; l < sdpnnonz; ++l)
-               {
-                  row = sdprow[l];
-                  col = sdpcol[l];
-                  constmatrix[row * blocksize + col] -= sdpval[l] * ubk;
-                  if ( row != col )
-                     constmatrix[col * blocksize + row] -= sdpval[l] * ubk;
-               }
-            }
-         }
+      /* change the bounds in the order of the constraints; stop at the first error or infeasibility */
+      for (c = 0; c < nconss && ! (*infeasible); ++c)
+      {
+         SCIP_CONSDATA* consdata;
+         int i;
 
-         /* special handling of binary variables */
-         if ( SCIPvarIsBinary(consdata->vars[i]) )
+         if ( retcodes[c] != SCIP_OKAY )
          {
-            SCIP_Real eigenvalue;
-
-            assert( matrix != NULL );
-
-            /* first copy constant matrix (possibly needed later) */
-            for (l = 0; l < blocksize * blocksize; ++l)
-               matrix[l] = - constmatrix[l];
-
-            /* compute maximal eigenvalue; this corresponds to checking the lower bound because of minus sign; constmatrix is destroyed. */
-            SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, constmatrix, blocksize, &eigenvalue, NULL) );
-
-            /* take minus sign into account */
-            eigenvalue = -eigenvalue;
-
-            /* if the negative of the constant matrix is psd, then the lower bound (= 0) is feasible -> cannot tighten */
-            if ( SCIPisFeasGE(scip, eigenvalue, 0.0) )
-               continue;
-            assert( SCIPisFeasNegative(scip, eigenvalue) );
-
-            /* otherwise, we check whether the upper bound is feasible */
-
-            /* add matrix i for evaluating upper bound */
-            sdprow = consdata->row[i];
-            sdpcol = consdata->col[i];
-            sdpval = consdata->val[i];
-            sdpnnonz = consdata->nvarnonz[i];
-            for (l = 0; l < sdpnnonz; ++l)
-            {
-               row = sdprow[l];
-               col = sdpcol[l];
-               matrix[row * blocksize + col] += sdpval[l];
-               if ( row != col )
-                  matrix[col * blocksize + row] += sdpval[l];
-            }
-
-            /* compute minimal eigenvalue; matrix is destroyed */
-            SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, matrix, 1, &eigenvalue, NULL) );
-
-            /* if matrix is not psd, we are infeasible */
-            if ( SCIPisFeasNegative(scip, eigenvalue) )
-            {
-               SCIPdebugMsg(scip, "Binary variable <%s> yields infeasibility.\n", SCIPvarGetName(consdata->vars[i]));
-               *infeasible = TRUE;
-               break;
-            }
-
-            /* otherwise, we need at least the matrix for variable i to become feasible -> can tighten variable to 1 */
-            factor = 0.5;
-            SCIPdebugMsg(scip, "Tighten lower bound for binary variable <%s> to 1.\n", SCIPvarGetName(consdata->vars[i]));
+            retcode = retcodes[c];
+            break;
          }
-         else
-         {
-            /* solve 1d SDP */
-            SCIP_CALL( SCIPsolveOneVarSDPDense(SCIPbuffer(scip), 1.0, lb, ub, blocksize, constmatrix, consdata->nvarnonz[i], consdata->row[i], consdata->col[i], consdata->val[i],
-                  SCIPinfinity(scip), SCIPfeastol(scip), &objval, &factor) );
-
-            /* if problem is infeasible */
-            if ( SCIPisInfinity(scip, objval) )
-            {
-               SCIPdebugMsg(scip, "Variable <%s> yields infeasibility.\n", SCIPvarGetName(consdata->vars[i]));
-               *infeasible = TRUE;
-               break;
-            }
 
-            if ( factor == SCIP_INVALID ) /*lint !e777*/
-               continue;
-         }
+         consdata = SCIPconsGetData(conss[c]);
+         assert( consdata != NULL );
 
-         if ( SCIPisGT(scip, factor, lb) )
+         for (i = 0; i < consdata->nvars; ++i)
          {
+            SCIP_Real newlb;
+            SCIP_Real lb;
             SCIP_Bool tightened;
 
-            SCIP_CALL( SCIPinferVarLbCons(scip, consdata->vars[i], factor, conss[c], -(i+1), FALSE, infeasible, &tightened) );
+            newlb = newlbs[varbeg[c] + i];
+            if ( newlb == SCIP_INVALID ) /*lint !e777*/
+               continue;
+
+            /* the bound might have been tightened for an earlier constraint */
+            lb = SCIPvarGetLbLocal(consdata->vars[i]);
+            if ( ! SCIPisGT(scip, newlb, lb) )
+               continue;
 
-            if ( *infeasible )
+            retcode = SCIPinferVarLbCons(scip, consdata->vars[i], newlb, conss[c], -(i+1), FALSE, infeasible, &tightened);
+            if ( retcode != SCIP_OKAY || *infeasible )
                break;
 
             if ( tightened )
             {
-               SCIPdebugMsg(scip, "%sTightened lower bound of variable <%s> from %g to %g.\n", SCIPinProbing(scip) ? "In probing: " : "", SCIPvarGetName(consdata->vars[i]), lb, factor);
+               SCIPdebugMsg(scip, "%sTightened lower bound of variable <%s> from %g to %g.\n", SCIPinProbing(scip) ? "In probing: " : "", SCIPvarGetName(consdata->vars[i]), lb, newlb);
                ++(*nchgbds);
 
                /*  if variable is integral, the bound change should automatically produce an integer bound */
-               if ( SCIPvarIsIntegral(consdata->vars[i]) && ! SCIPisFeasIntegral(scip, factor) )
+               if ( SCIPvarIsIntegral(consdata->vars[i]) && ! SCIPisFeasIntegral(scip, newlb) )
                {
                   assert( SCIPisFeasIntegral(scip, SCIPvarGetLbLocal(consdata->vars[i])) );
                   ++(*nintrnd);
                }
             }
          }
-      }
 
-      SCIPfreeBufferArrayNull(scip, &matrix);
-      SCIPfreeBufferArray(scip, &constmatrix);
+         if ( retcode != SCIP_OKAY )
+            break;
+
+         if ( consinfeasible[c] )
+            *infeasible = TRUE;
+      }
    }
 
-   return SCIP_OKAY;
+   freeThreadBufmems(bufmems, nbufmems);
+
+   SCIPfreeBufferArray(scip, &bufmems);
+   SCIPfreeBufferArray(scip, &retcodes);
+   SCIPfreeBufferArray(scip, &consinfeasible);
+   SCIPfreeBufferArray(scip, &newlbs);
+   SCIPfreeBufferArray(scip, &varbeg);
+
+   return retcode;
 }
 
 /** approximates the sdpcone using the fact that every diagonal entry must be non-negative, so it adds the LP-cut
@@ -4112,7 +4864,31 @@ SCIP_RETCODE checkVarsLocks(
 }
 #endif
 
-/** local function to perform (parts of) multiaggregation of a single variable within fixAndAggrVars */
+/** (multi-)aggregations of one constraint collected in fixAndAggrVars()
+ *
+ *  The nonzeros of each removed variable are kept as a source. Each aggregation adds a source, multiplied by a scalar, to
+ *  the matrix of another variable. All aggregations of a constraint are applied at once in applyAggregations().
+ */
+struct SDP_AggrData
+{
+   int**                 srcrow;             /**< row indices of the nonzeros of each source */
+   int**                 srccol;             /**< column indices of the nonzeros of each source */
+   SCIP_Real**           srcval;             /**< values of the nonzeros of each source */
+   int*                  srcnnonz;           /**< number of nonzeros of each source */
+   int                   nsrcs;              /**< number of sources */
+   SCIP_VAR**            aggrvars;           /**< variables to which a source is added */
+   SCIP_Real*            aggrscalars;        /**< scalars with which the sources are multiplied */
+   int*                  aggrsrcs;           /**< indices of the sources */
+   int                   naggrs;             /**< number of aggregations */
+   int                   aggrssize;          /**< size of the aggregation arrays */
+};
+typedef struct SDP_AggrData SDP_AGGRDATA;
+
+/** local function to remove a single (multi-)aggregated variable within fixAndAggrVars
+ *
+ *  The nonzeros of the variable are stored as a new source in @p aggrdata together with the aggregations to the
+ *  variables it is (multi-)aggregated to; the aggregations are only applied in applyAggregations().
+ */
 static
 SCIP_RETCODE multiaggrVar(
    SCIP*                 scip,               /**< SCIP pointer */
@@ -4126,7 +4902,7 @@ SCIP_RETCODE multiaggrVar(
    int*                  savedrow,           /**< array of rows for nonzeros that need to be added to the constant matrix */
    SCIP_Real*            savedval,           /**< array of values for nonzeros that need to be added to the constant matrix */
    int*                  nfixednonz,         /**< length of the arrays of saved nonzeros for the constant matrix */
-   int*                  vararraylength      /**< length of the variable array */
+   SDP_AGGRDATA*         aggrdata            /**< data to store the pending aggregations */
    )
 {
    SCIP_CONSDATA* consdata;
@@ -4135,8 +4911,7 @@ SCIP_RETCODE multiaggrVar(
    int* cols;
    int nvarnonz;
    int aggrind;
-   int aggrtargetlength;
-   int globalnvars;
+   int src;
    int i;
 
    assert( scip != NULL );
@@ -4147,6 +4922,7 @@ SCIP_RETCODE multiaggrVar(
    assert( savedrow != NULL );
    assert( savedval != NULL );
    assert( nfixednonz != NULL );
+   assert( aggrdata != NULL );
 
    consdata = SCIPconsGetData(cons);
    assert( consdata != NULL );
@@ -4156,14 +4932,17 @@ SCIP_RETCODE multiaggrVar(
    /* unlock variable */
    SCIP_CALL( unlockVar(scip, consdata, v) );
 
-   /* save matrix of variable v (will be freed later) */
+   /* save matrix of variable v as new source (will be freed later) */
    rows = consdata->row[v];
    cols = consdata->col[v];
    vals = consdata->val[v];
    nvarnonz = consdata->nvarnonz[v];
 
-   /* Sort matrix of variable v by nondecreasing row and then col to make merging below faster. */
-   SCIPsdpVarfixerSortRowCol(rows, cols, vals, nvarnonz);
+   src = aggrdata->nsrcs++;
+   aggrdata->srcrow[src] = rows;
+   aggrdata->srccol[src] = cols;
+   aggrdata->srcval[src] = vals;
+   aggrdata->srcnnonz[src] = nvarnonz;
 
    /* fill the empty spot of the (multi-)aggregated variable with the last variable of this constraint (since variables do not have to be sorted) */
    SCIP_CALL( SCIPreleaseVar(scip, &consdata->vars[v]) );
@@ -4175,108 +4954,273 @@ SCIP_RETCODE multiaggrVar(
    consdata->locks[v] = consdata->locks[consdata->nvars - 1];
    (consdata->nvars)--;
 
-   /* iterate over all variables that variable v was aggregated to and insert the corresponding nonzeros */
-   for (aggrind = 0; aggrind < naggrvars; aggrind++)
+   /* make sure that there is enough space for the new aggregations */
+   if ( aggrdata->naggrs + naggrvars > aggrdata->aggrssize )
    {
-      int aggrconsind = -1;
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, aggrdata->naggrs + naggrvars);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &aggrdata->aggrvars, aggrdata->aggrssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &aggrdata->aggrscalars, aggrdata->aggrssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &aggrdata->aggrsrcs, aggrdata->aggrssize, newsize) );
+      aggrdata->aggrssize = newsize;
+   }
 
+   /* remember that the nonzeros have to be added to all variables that variable v was aggregated to */
+   for (aggrind = 0; aggrind < naggrvars; aggrind++)
+   {
       assert( ! SCIPisZero(scip, scalars[aggrind]) );
 
-      /* check if the variable already exists in this block */
-      for (i = 0; i < consdata->nvars; i++)
+      aggrdata->aggrvars[aggrdata->naggrs] = aggrvars[aggrind];
+      aggrdata->aggrscalars[aggrdata->naggrs] = scalars[aggrind];
+      aggrdata->aggrsrcs[aggrdata->naggrs] = src;
+      ++aggrdata->naggrs;
+   }
+
+   /* if constant is not 0, insert entries for variable v into a long array of entries that is merged with constant matrix */
+   if ( ! SCIPisZero(scip, constant) )
+   {
+      for (i = 0; i < nvarnonz; i++)
       {
-         if ( consdata->vars[i] == aggrvars[aggrind] )
-         {
-            aggrconsind = i;
-            break;
-         }
+         savedcol[*nfixednonz] = cols[i];
+         savedrow[*nfixednonz] = rows[i];
+         savedval[*nfixednonz] = vals[i] * constant; /* multiply with constant, since this is added to the constant matrix */
+         (*nfixednonz)++;
       }
+   }
 
-      if ( aggrconsind > -1 )
-      {
-         /* if the variable to aggregate to is already part of this sdp-constraint, just add the nonzeros of the old variable to it */
+   return SCIP_OKAY;
+}
+
+/** local function to apply all (multi-)aggregations of a constraint collected by multiaggrVar() within fixAndAggrVars
+ *
+ *  The nonzeros of all sources are first appended (multiplied by the scalars) to the matrices of the variables they are
+ *  aggregated to; a hash map is used to find these variables in the constraint. Afterwards, each changed matrix is sorted
+ *  once and entries with the same row and column are combined. In this way, the running time is not quadratic in the
+ *  number of variables aggregated to the same variable.
+ */
+static
+SCIP_RETCODE applyAggregations(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_CONS*            cons,               /**< constraint to apply the aggregations for */
+   SDP_AGGRDATA*         aggrdata,           /**< data of the pending aggregations */
+   int*                  vararraylength      /**< length of the variable array */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   SCIP_HASHMAP* varmap;
+   SCIP_Real* fixedval = NULL;
+   int* fixedrow = NULL;
+   int* fixedcol = NULL;
+   int* aggrpos;
+   int* naddnonz;
+   int* oldnnonz;
+   int nfixednonz = 0;
+   int nvarsbefore;
+   int globalnvars;
+   int a;
+   int i;
+   int v;
+
+   assert( scip != NULL );
+   assert( cons != NULL );
+   assert( aggrdata != NULL );
+   assert( vararraylength != NULL );
+
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+
+   if ( aggrdata->naggrs == 0 )
+      return SCIP_OKAY;
 
-         /* resize the arrays to the maximally needed length */
-         aggrtargetlength = consdata->nvarnonz[aggrconsind] + nvarnonz;
-         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->row[aggrconsind]), consdata->nvarnonz[aggrconsind], aggrtargetlength) );
-         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->col[aggrconsind]), consdata->nvarnonz[aggrconsind], aggrtargetlength) );
-         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->val[aggrconsind]), consdata->nvarnonz[aggrconsind], aggrtargetlength) );
+   nvarsbefore = consdata->nvars;
 
-         /* merge: add scalar times matrix for variable v to aggregated matrix */
-         SCIP_CALL( SCIPsdpVarfixerMergeArrays(SCIPblkmem(scip), SCIPepsilon(scip), rows, cols, vals, nvarnonz, TRUE,
-               scalars[aggrind], consdata->row[aggrconsind], consdata->col[aggrconsind],
-               consdata->val[aggrconsind], &(consdata->nvarnonz[aggrconsind]), aggrtargetlength) );
+   /* map the variables of the constraint to their positions */
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), consdata->nvars + aggrdata->naggrs) );
+   for (v = 0; v < consdata->nvars; ++v)
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*) consdata->vars[v], v) );
+   }
+
+   /* determine the position of each variable to aggregate to; variables that are not yet part of the constraint are added */
+   SCIP_CALL( SCIPallocBufferArray(scip, &aggrpos, aggrdata->naggrs) );
+   for (a = 0; a < aggrdata->naggrs; ++a)
+   {
+      SCIP_VAR* aggrvar;
 
-         /* shrink them again if nonzeros could be combined */
-         assert( consdata->nvarnonz[aggrconsind] <= aggrtargetlength );
-         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->row[aggrconsind]), aggrtargetlength, consdata->nvarnonz[aggrconsind]) );
-         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->col[aggrconsind]), aggrtargetlength, consdata->nvarnonz[aggrconsind]) );
-         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->val[aggrconsind]), aggrtargetlength, consdata->nvarnonz[aggrconsind]) );
+      aggrvar = aggrdata->aggrvars[a];
 
-         SCIP_CALL( updateVarLocks(scip, cons, aggrconsind) );
+      /* variables that are fixed by their bounds are treated below */
+      if ( SCIPisEQ(scip, SCIPvarGetLbGlobal(aggrvar), SCIPvarGetUbGlobal(aggrvar)) )
+      {
+         aggrpos[a] = -1;
+         nfixednonz += aggrdata->srcnnonz[aggrdata->aggrsrcs[a]];
+         continue;
       }
-      else
+
+      if ( SCIPhashmapExists(varmap, (void*) aggrvar) )
       {
-         int cnt = 0;
+         aggrpos[a] = SCIPhashmapGetImageInt(varmap, (void*) aggrvar);
+         continue;
+      }
 
-         /* the variable has to be added to this constraint */
-         SCIPdebugMsg(scip, "adding variable %s to SDP constraint %s because of (multi-)aggregation\n", SCIPvarGetName(aggrvars[aggrind]), SCIPconsGetName(cons));
+      /* the variable has to be added to this constraint */
+      SCIPdebugMsg(scip, "adding variable %s to SDP constraint %s because of (multi-)aggregation\n", SCIPvarGetName(aggrvar), SCIPconsGetName(cons));
 
-         /* check if we have to enlarge the arrays */
-         if ( consdata->nvars == *vararraylength )
-         {
-            globalnvars = SCIPgetNVars(scip);
-
-            /* we don't want to enlarge this by one for every variable added, so we immediately set it to the maximum possible size */
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->col, *vararraylength, globalnvars) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->row, *vararraylength, globalnvars) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->val, *vararraylength, globalnvars) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->nvarnonz, *vararraylength, globalnvars) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->vars, *vararraylength, globalnvars) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->locks, *vararraylength, globalnvars) );
-            *vararraylength = globalnvars;
-         }
+      /* check if we have to enlarge the arrays */
+      if ( consdata->nvars == *vararraylength )
+      {
+         globalnvars = SCIPgetNVars(scip);
+
+         /* we don't want to enlarge this by one for every variable added, so we immediately set it to the maximum possible size */
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->col, *vararraylength, globalnvars) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->row, *vararraylength, globalnvars) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->val, *vararraylength, globalnvars) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->nvarnonz, *vararraylength, globalnvars) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->vars, *vararraylength, globalnvars) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->locks, *vararraylength, globalnvars) );
+         *vararraylength = globalnvars;
+      }
+      assert( consdata->nvars < *vararraylength );
+
+      /* we insert this variable at the last position, as the ordering doesn't matter */
+      SCIP_CALL( SCIPcaptureVar(scip, aggrvar) );
+      consdata->vars[consdata->nvars] = aggrvar;
+      consdata->col[consdata->nvars] = NULL;
+      consdata->row[consdata->nvars] = NULL;
+      consdata->val[consdata->nvars] = NULL;
+      consdata->nvarnonz[consdata->nvars] = 0;
+      consdata->locks[consdata->nvars] = -2;
+
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*) aggrvar, consdata->nvars) );
+      aggrpos[a] = consdata->nvars++;
+   }
+
+   /* count the number of nonzeros to add for each variable */
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &naddnonz, consdata->nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &oldnnonz, consdata->nvars) );
+   for (a = 0; a < aggrdata->naggrs; ++a)
+   {
+      if ( aggrpos[a] >= 0 )
+         naddnonz[aggrpos[a]] += aggrdata->srcnnonz[aggrdata->aggrsrcs[a]];
+   }
+
+   if ( nfixednonz > 0 )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &fixedrow, nfixednonz) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &fixedcol, nfixednonz) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &fixedval, nfixednonz) );
+      nfixednonz = 0;
+   }
+
+   /* enlarge the arrays of all changed variables at once */
+   for (v = 0; v < consdata->nvars; ++v)
+   {
+      oldnnonz[v] = consdata->nvarnonz[v];
+      if ( naddnonz[v] > 0 )
+      {
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->row[v]), oldnnonz[v], oldnnonz[v] + naddnonz[v]) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->col[v]), oldnnonz[v], oldnnonz[v] + naddnonz[v]) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->val[v]), oldnnonz[v], oldnnonz[v] + naddnonz[v]) );
+      }
+   }
+
+   /* append scalar times the nonzeros of the sources */
+   for (a = 0; a < aggrdata->naggrs; ++a)
+   {
+      SCIP_Real scalar;
+      int src;
+      int cnt;
 
-         /* we insert this variable at the last position, as the ordering doesn't matter */
-         SCIP_CALL( SCIPcaptureVar(scip, aggrvars[aggrind]) );
-         consdata->vars[consdata->nvars] = aggrvars[aggrind];
+      v = aggrpos[a];
+      src = aggrdata->aggrsrcs[a];
+      scalar = aggrdata->aggrscalars[a];
 
-         /* as there were no nonzeros thus far, we can just duplicate the saved arrays to get the nonzeros for the new variable */
-         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(consdata->col[consdata->nvars]), cols, nvarnonz) );
-         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(consdata->row[consdata->nvars]), rows, nvarnonz) );
+      /* for fixed variables, the nonzeros are added to the constant matrix */
+      if ( v < 0 )
+      {
+         scalar *= SCIPvarGetLbGlobal(aggrdata->aggrvars[a]);
+         if ( SCIPisZero(scip, scalar) )
+            continue;
 
-         /* we have to multiply all entries by scalar before inserting them */
-         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(consdata->val[consdata->nvars]), nvarnonz) );
-         for (i = 0; i < nvarnonz; i++)
+         assert( fixedrow != NULL && fixedcol != NULL && fixedval != NULL );
+         for (i = 0; i < aggrdata->srcnnonz[src]; ++i)
          {
-            /* if both scalar and savedval are small this might become too small */
-            if ( ! SCIPisZero(scip, scalars[aggrind] * vals[i]) )
-               consdata->val[consdata->nvars][cnt++] = scalars[aggrind] * vals[i];
+            fixedrow[nfixednonz] = aggrdata->srcrow[src][i];
+            fixedcol[nfixednonz] = aggrdata->srccol[src][i];
+            fixedval[nfixednonz] = scalar * aggrdata->srcval[src][i];
+            ++nfixednonz;
          }
-         consdata->nvarnonz[consdata->nvars] = cnt;
+         continue;
+      }
+
+      cnt = consdata->nvarnonz[v];
 
-         consdata->locks[consdata->nvars] = -2;
-         consdata->nvars++;
-         SCIP_CALL( updateVarLocks(scip, cons, consdata->nvars-1) );
+      for (i = 0; i < aggrdata->srcnnonz[src]; ++i)
+      {
+         consdata->row[v][cnt] = aggrdata->srcrow[src][i];
+         consdata->col[v][cnt] = aggrdata->srccol[src][i];
+         consdata->val[v][cnt] = scalar * aggrdata->srcval[src][i];
+         ++cnt;
       }
+      consdata->nvarnonz[v] = cnt;
    }
 
-   /* if constant is not 0, insert entries for variable v into a long array of entries that is merged with constant matrix */
-   if ( ! SCIPisZero(scip, constant) )
+   /* sort and combine the nonzeros of each changed variable once, then shrink the arrays again */
+   for (v = 0; v < consdata->nvars; ++v)
    {
-      for (i = 0; i < nvarnonz; i++)
+      if ( naddnonz[v] == 0 && v < nvarsbefore )
+         continue;
+
+      assert( consdata->nvarnonz[v] == oldnnonz[v] + naddnonz[v] );
+      SCIPsdpVarfixerSortAndCombine(SCIPepsilon(scip), consdata->row[v], consdata->col[v], consdata->val[v], &(consdata->nvarnonz[v]));
+
+      if ( naddnonz[v] > 0 )
       {
-         savedcol[*nfixednonz] = cols[i];
-         savedrow[*nfixednonz] = rows[i];
-         savedval[*nfixednonz] = vals[i] * constant; /* multiply with constant, since this is added to the constant matrix */
-         (*nfixednonz)++;
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->row[v]), oldnnonz[v] + naddnonz[v], consdata->nvarnonz[v]) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->col[v]), oldnnonz[v] + naddnonz[v], consdata->nvarnonz[v]) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->val[v]), oldnnonz[v] + naddnonz[v], consdata->nvarnonz[v]) );
       }
+
+      SCIP_CALL( updateVarLocks(scip, cons, v) );
+   }
+
+   /* insert the nonzeros for fixed variables into the constant arrays, as we have +A_i but -A_0 we mutliply them by -1 */
+   if ( nfixednonz > 0 )
+   {
+      int arraylength;
+
+      arraylength = consdata->constnnonz + nfixednonz;
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->constcol), consdata->constnnonz, arraylength) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->constrow), consdata->constnnonz, arraylength) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->constval), consdata->constnnonz, arraylength) );
+
+      SCIP_CALL( SCIPsdpVarfixerMergeArrays(SCIPblkmem(scip), SCIPepsilon(scip), fixedrow, fixedcol, fixedval, nfixednonz, FALSE, -1.0,
+            consdata->constrow, consdata->constcol, consdata->constval, &(consdata->constnnonz), arraylength) );
+      assert( consdata->constnnonz <= arraylength );
+
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->constcol), arraylength, consdata->constnnonz) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->constrow), arraylength, consdata->constnnonz) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(consdata->constval), arraylength, consdata->constnnonz) );
    }
 
-   /* free the memory for the entries of the aggregated variable */
-   SCIPfreeBlockMemoryArray(scip, &vals, nvarnonz);
-   SCIPfreeBlockMemoryArray(scip, &rows, nvarnonz);
-   SCIPfreeBlockMemoryArray(scip, &cols, nvarnonz);
+   SCIPfreeBufferArrayNull(scip, &fixedval);
+   SCIPfreeBufferArrayNull(scip, &fixedcol);
+   SCIPfreeBufferArrayNull(scip, &fixedrow);
+   SCIPfreeBufferArray(scip, &oldnnonz);
+   SCIPfreeBufferArray(scip, &naddnonz);
+   SCIPfreeBufferArray(scip, &aggrpos);
+   SCIPhashmapFree(&varmap);
+
+   /* free the memory for the entries of the aggregated variables */
+   for (i = 0; i < aggrdata->nsrcs; ++i)
+   {
+      SCIPfreeBlockMemoryArrayNull(scip, &aggrdata->srcval[i], aggrdata->srcnnonz[i]);
+      SCIPfreeBlockMemoryArrayNull(scip, &aggrdata->srcrow[i], aggrdata->srcnnonz[i]);
+      SCIPfreeBlockMemoryArrayNull(scip, &aggrdata->srccol[i], aggrdata->srcnnonz[i]);
+   }
+   aggrdata->nsrcs = 0;
+   aggrdata->naggrs = 0;
 
 #ifndef NDEBUG
    SCIP_CALL( checkVarsLocks(scip, cons) );
@@ -4296,6 +5240,7 @@ SCIP_RETCODE fixAndAggrVars(
    )
 {
    SCIP_CONSDATA* consdata;
+   SDP_AGGRDATA aggrdata;
    int i;
    int* savedcol;
    int* savedrow;
@@ -4322,6 +5267,12 @@ SCIP_RETCODE fixAndAggrVars(
 
    SCIPdebugMsg(scip, "Calling fixAndAggrVars with aggregate = %u.\n", aggregate);
 
+   aggrdata.aggrvars = NULL;
+   aggrdata.aggrscalars = NULL;
+   aggrdata.aggrsrcs = NULL;
+   aggrdata.naggrs = 0;
+   aggrdata.aggrssize = 0;
+
    for (c = 0; c < nconss; ++c)
    {
       int nfixednonz = 0;
@@ -4339,6 +5290,14 @@ SCIP_RETCODE fixAndAggrVars(
       SCIP_CALL( SCIPallocBufferArray(scip, &savedrow, consdata->nnonz) );
       SCIP_CALL( SCIPallocBufferArray(scip, &savedval, consdata->nnonz) );
 
+      /* allocate memory for the nonzeros of the (multi-)aggregated variables; at most all current variables are removed */
+      SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata.srcrow, consdata->nvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata.srccol, consdata->nvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata.srcval, consdata->nvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata.srcnnonz, consdata->nvars) );
+      aggrdata.nsrcs = 0;
+      aggrdata.naggrs = 0;
+
       vararraylength = consdata->nvars;
       globalnvars = SCIPgetNVars(scip);
 
@@ -4500,7 +5459,7 @@ SCIP_RETCODE fixAndAggrVars(
 
                /* add the nonzeros to the saved-arrays for the constant part, remove the nonzeros for the old variables and add them to the variables this variable
                 * was (multi-)aggregated to */
-               SCIP_CALL( multiaggrVar(scip, conss[c], v, aggrvars, scalars, naggrvars, constant, savedcol, savedrow, savedval, &nfixednonz, &vararraylength) );
+               SCIP_CALL( multiaggrVar(scip, conss[c], v, aggrvars, scalars, naggrvars, constant, savedcol, savedrow, savedval, &nfixednonz, &aggrdata) );
                v--; /* we need to check again if the variable we just shifted to this position also needs to be fixed */
             }
 
@@ -4515,11 +5474,19 @@ SCIP_RETCODE fixAndAggrVars(
 
             scalar = -1.0;
 
-            SCIP_CALL( multiaggrVar(scip, conss[c], v, &var, &scalar, 1, 1.0, savedcol, savedrow, savedval, &nfixednonz, &vararraylength) );
+            SCIP_CALL( multiaggrVar(scip, conss[c], v, &var, &scalar, 1, 1.0, savedcol, savedrow, savedval, &nfixednonz, &aggrdata) );
             v--; /* we need to check again if the variable we just shifted to this position also needs to be fixed */
          }
       }
 
+      /* add the nonzeros of the (multi-)aggregated variables to the variables they were aggregated to */
+      SCIP_CALL( applyAggregations(scip, conss[c], &aggrdata, &vararraylength) );
+
+      SCIPfreeBufferArray(scip, &aggrdata.srcnnonz);
+      SCIPfreeBufferArray(scip, &aggrdata.srcval);
+      SCIPfreeBufferArray(scip, &aggrdata.srccol);
+      SCIPfreeBufferArray(scip, &aggrdata.srcrow);
+
       /* shrink the variable arrays if they were enlarged too much (or more vars were removed than added) */
       assert( consdata->nvars <= vararraylength );
       if ( consdata->nvars < vararraylength )
@@ -4558,8 +5525,14 @@ SCIP_RETCODE fixAndAggrVars(
       consdata->nnonz = 0;
       for (v = 0; v < consdata->nvars; v++)
          consdata->nnonz += consdata->nvarnonz[v];
+
+      updateConsMemory(conss[c]);
    }
 
+   SCIPfreeBlockMemoryArrayNull(scip, &aggrdata.aggrsrcs, aggrdata.aggrssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &aggrdata.aggrscalars, aggrdata.aggrssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &aggrdata.aggrvars, aggrdata.aggrssize);
+
    return SCIP_OKAY;
 }
 
@@ -6307,47 +7280,291 @@ SCIP_DECL_QUADCONSUPGD(consQuadConsUpgdSdp)
          if ( idx2 > idx1 )
             SCIPswapInts(&idx1, &idx2);
 
-         linconsvals[cnt] = bilinterms[j].coef;
-         linconsvars[cnt] = conshdlrdata->sdpconshdlrdata->X[idx1][idx2];
-         assert( linconsvars[cnt] != NULL );
-         ++cnt;
+         linconsvals[cnt] = bilinterms[j].coef;
+         linconsvars[cnt] = conshdlrdata->sdpconshdlrdata->X[idx1][idx2];
+         assert( linconsvars[cnt] != NULL );
+         ++cnt;
+
+         SCIPdebugMsg(scip, "New variable %s corresponds to product of original variables %s and %s\n",
+            SCIPvarGetName(conshdlrdata->sdpconshdlrdata->X[idx1][idx2]), SCIPvarGetName(bilinterms[j].var1), SCIPvarGetName(bilinterms[j].var2));
+      }
+      assert( cnt <= nlinvarterms + 2 * nquadvarterms + nbilinterms );
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "lin_%s", SCIPconsGetName(cons));
+      SCIP_CALL( SCIPcreateConsLinear(scip, &lincons, name, cnt, linconsvars, linconsvals, SCIPgetLhsQuadratic(scip, cons), SCIPgetRhsQuadratic(scip, cons),
+            SCIPconsIsInitial(cons), SCIPconsIsSeparated(cons), SCIPconsIsEnforced(cons), SCIPconsIsChecked(cons), SCIPconsIsPropagated(cons), SCIPconsIsLocal(cons),
+            FALSE, SCIPconsIsDynamic(cons), SCIPconsIsRemovable(cons), FALSE) );
+
+#ifdef SCIP_MORE_DEBUG
+      SCIPinfoMessage(scip, NULL, "In upgrade of quadratic constraint the following linear constraint has been added:\n");
+      SCIP_CALL( SCIPprintCons(scip, lincons, NULL) );
+      SCIPinfoMessage(scip, NULL, "\n");
+#endif
+
+      /* fill in upgdconss - do not mention SDP constraint, since this has been added already */
+      upgdconss[0] = lincons;
+      *nupgdconss = 1;
+
+      SCIPfreeBufferArray(scip, &linconsvals);
+      SCIPfreeBufferArray(scip, &linconsvars);
+   }
+   else
+   {
+      /* todo: Check whether adding the linear constraints helps */
+      *nupgdconss = 0;          /* the original quadratic constraint should be kept in the problem */
+   }
+
+   /* turn off upgrading in order to avoid a possibly infinite loop */
+   conshdlrdata->sdpconshdlrdata->upgradequadconss = FALSE;
+
+   return SCIP_OKAY;
+}
+
+#endif
+
+/** powers of ten that are exactly representable as doubles (used by parseReal()) */
+static const SCIP_Real parsepowten[] = {
+   1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/** parses an integer value in place, skipping leading whitespace
+ *
+ *  Returns FALSE if no digit is found.
+ */
+static
+SCIP_Bool parseInt(
+   const char*           str,                /**< string to parse */
+   int*                  value,              /**< pointer to store the value */
+   const char**          endptr              /**< pointer to store the position after the value */
+   )
+{
+   SCIP_Bool negative = FALSE;
+   const char* pos = str;
+   int val = 0;
+
+   assert( str != NULL );
+   assert( value != NULL );
+   assert( endptr != NULL );
+
+   while ( isspace((unsigned char)*pos) )
+      ++pos;
+
+   if ( *pos == '-' )
+   {
+      negative = TRUE;
+      ++pos;
+   }
+   else if ( *pos == '+' )
+      ++pos;
+
+   if ( ! isdigit((unsigned char)*pos) )
+   {
+      *endptr = str;
+      return FALSE;
+   }
+
+   while ( isdigit((unsigned char)*pos) )
+   {
+      /* refuse values that do not fit into an int */
+      if ( val > (INT_MAX - 9) / 10 )
+      {
+         *endptr = str;
+         return FALSE;
+      }
+      val = 10 * val + (*pos - '0');
+      ++pos;
+   }
+
+   *value = negative ? -val : val;
+   *endptr = pos;
+
+   return TRUE;
+}
+
+/** parses a real value in place, skipping leading whitespace
+ *
+ *  Numbers with at most 15 significant digits and a decimal exponent of absolute value at most 22 are converted
+ *  directly, which is exact since both the mantissa and the power of ten are exactly representable. All other numbers
+ *  (including "inf" and "nan") are converted by strtod(). Returns FALSE if no number is found.
+ */
+static
+SCIP_Bool parseReal(
+   const char*           str,                /**< string to parse */
+   SCIP_Real*            value,              /**< pointer to store the value */
+   const char**          endptr              /**< pointer to store the position after the value */
+   )
+{
+   SCIP_Longint mantissa = 0;
+   SCIP_Bool negative = FALSE;
+   SCIP_Bool hasdigits = FALSE;
+   const char* pos = str;
+   int ndigits = 0;
+   int exponent = 0;
+
+   assert( str != NULL );
+   assert( value != NULL );
+   assert( endptr != NULL );
+
+   while ( isspace((unsigned char)*pos) )
+      ++pos;
+
+   if ( *pos == '-' )
+   {
+      negative = TRUE;
+      ++pos;
+   }
+   else if ( *pos == '+' )
+      ++pos;
+
+   /* integral part; leading zeros are not significant */
+   while ( isdigit((unsigned char)*pos) )
+   {
+      hasdigits = TRUE;
+      if ( mantissa > 0 || *pos != '0' )
+      {
+         if ( ++ndigits <= 15 )
+            mantissa = 10 * mantissa + (*pos - '0');
+      }
+      ++pos;
+   }
+
+   /* fractional part */
+   if ( *pos == '.' )
+   {
+      ++pos;
+      while ( isdigit((unsigned char)*pos) )
+      {
+         hasdigits = TRUE;
+         if ( mantissa > 0 || *pos != '0' )
+         {
+            if ( ++ndigits <= 15 )
+               mantissa = 10 * mantissa + (*pos - '0');
+         }
+         --exponent;
+         ++pos;
+      }
+   }
+
+   /* exponent (only if digits follow directly, as for strtod()) */
+   if ( hasdigits && (*pos == 'e' || *pos == 'E')
+      && (isdigit((unsigned char)pos[1]) || ((pos[1] == '-' || pos[1] == '+') && isdigit((unsigned char)pos[2]))) )
+   {
+      int exp;
+
+      if ( parseInt(pos + 1, &exp, &pos) )
+         exponent += exp;
+      else
+         ndigits = INT_MAX;  /* leave overlong exponents to strtod() */
+   }
+
+   if ( hasdigits && ndigits <= 15 && exponent >= -22 && exponent <= 22 )
+   {
+      if ( exponent >= 0 )
+         *value = (SCIP_Real) mantissa * parsepowten[exponent];
+      else
+         *value = (SCIP_Real) mantissa / parsepowten[-exponent];
+      if ( negative )
+         *value = -*value;
+      *endptr = pos;
+      return TRUE;
+   }
+
+   /* fall back to strtod() */
+   {
+      char* end;
+
+      *value = strtod(str, &end);
+      *endptr = end;
+      return end != str;
+   }
+}
+
+/** counts the nonzeros of the constant part and of the variables in the string of an SDP constraint
+ *
+ *  This is the first pass of consParseSdp(): every entry of a matrix starts with '(', and every variable is enclosed in
+ *  '<' and '>'. The counts of the variables are stored in @p nvarnonz, which needs to have length at least the number
+ *  of '<' characters in the string.
+ */
+static
+SCIP_Bool parseCountNonzeros(
+   const char*           str,                /**< string of the constraint */
+   int*                  constnnonz,         /**< pointer to store the number of nonzeros of the constant part */
+   int*                  nvars,              /**< pointer to store the number of variables */
+   int*                  nvarnonz            /**< array to store the number of nonzeros of each variable */
+   )
+{
+   const char* pos;
+
+   assert( str != NULL );
+   assert( constnnonz != NULL );
+   assert( nvars != NULL );
+   assert( nvarnonz != NULL );
+
+   *constnnonz = 0;
+   *nvars = 0;
 
-         SCIPdebugMsg(scip, "New variable %s corresponds to product of original variables %s and %s\n",
-            SCIPvarGetName(conshdlrdata->sdpconshdlrdata->X[idx1][idx2]), SCIPvarGetName(bilinterms[j].var1), SCIPvarGetName(bilinterms[j].var2));
+   for (pos = str; *pos != '\0'; ++pos)
+   {
+      if ( *pos == '(' )
+      {
+         if ( *nvars == 0 )
+            ++(*constnnonz);
+         else
+            ++nvarnonz[*nvars - 1];
       }
-      assert( cnt <= nlinvarterms + 2 * nquadvarterms + nbilinterms );
+      else if ( *pos == '<' )
+      {
+         /* skip the name, which may contain arbitrary characters */
+         pos = strchr(pos + 1, '>');
+         if ( pos == NULL )
+            return FALSE;
+         nvarnonz[(*nvars)++] = 0;
+      }
+   }
 
-      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "lin_%s", SCIPconsGetName(cons));
-      SCIP_CALL( SCIPcreateConsLinear(scip, &lincons, name, cnt, linconsvars, linconsvals, SCIPgetLhsQuadratic(scip, cons), SCIPgetRhsQuadratic(scip, cons),
-            SCIPconsIsInitial(cons), SCIPconsIsSeparated(cons), SCIPconsIsEnforced(cons), SCIPconsIsChecked(cons), SCIPconsIsPropagated(cons), SCIPconsIsLocal(cons),
-            FALSE, SCIPconsIsDynamic(cons), SCIPconsIsRemovable(cons), FALSE) );
+   return TRUE;
+}
 
-#ifdef SCIP_MORE_DEBUG
-      SCIPinfoMessage(scip, NULL, "In upgrade of quadratic constraint the following linear constraint has been added:\n");
-      SCIP_CALL( SCIPprintCons(scip, lincons, NULL) );
-      SCIPinfoMessage(scip, NULL, "\n");
-#endif
+/** parses the next matrix entry "(row,col):val" of an SDP constraint, stored in the lower triangular part */
+static
+SCIP_Bool parseMatrixEntry(
+   const char*           str,                /**< string starting with '(' */
+   int                   blocksize,          /**< size of the SDP block */
+   int*                  row,                /**< pointer to store the row */
+   int*                  col,                /**< pointer to store the column */
+   SCIP_Real*            val,                /**< pointer to store the value */
+   const char**          endptr              /**< pointer to store the position after the entry and a following ',' */
+   )
+{
+   const char* pos = str;
+   int i;
+   int j;
 
-      /* fill in upgdconss - do not mention SDP constraint, since this has been added already */
-      upgdconss[0] = lincons;
-      *nupgdconss = 1;
+   assert( *pos == '(' );
 
-      SCIPfreeBufferArray(scip, &linconsvals);
-      SCIPfreeBufferArray(scip, &linconsvars);
-   }
-   else
-   {
-      /* todo: Check whether adding the linear constraints helps */
-      *nupgdconss = 0;          /* the original quadratic constraint should be kept in the problem */
-   }
+   if ( ! parseInt(pos + 1, &i, &pos) || *pos != ',' )
+      return FALSE;
+   if ( ! parseInt(pos + 1, &j, &pos) || pos[0] != ')' || pos[1] != ':' )
+      return FALSE;
+   if ( ! parseReal(pos + 2, val, &pos) )
+      return FALSE;
 
-   /* turn off upgrading in order to avoid a possibly infinite loop */
-   conshdlrdata->sdpconshdlrdata->upgradequadconss = FALSE;
+   if ( i < 0 || j < 0 || i >= blocksize || j >= blocksize )
+      return FALSE;
 
-   return SCIP_OKAY;
-}
+   /* if we got an entry in the upper triangular part, switch the entries for lower triangular */
+   *row = MAX(i, j);
+   *col = MIN(i, j);
 
-#endif
+   if ( *pos == ',' )
+      ++pos;
+   while ( isspace((unsigned char)*pos) )
+      ++pos;
+   *endptr = pos;
+
+   return TRUE;
+}
 
 
 
@@ -6394,6 +7611,7 @@ SCIP_DECL_CONSINITPRE(consInitpreSdp)
    conshdlrdata->npropprobub = 0;
    conshdlrdata->npropprobtb = 0;
    conshdlrdata->npropprob3minor = 0;
+   conshdlrdata->nstoredevcuts = 0;
 
    /* create clocks */
    if ( conshdlrdata->sdpconshdlrdata->enableproptiming )
@@ -6428,7 +7646,10 @@ SCIP_DECL_CONSLOCK(consLockSdp)
    if ( consdata->rankone )
    {
       if ( consdata->locks == NULL )
+      {
          SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->locks, nvars) );
+         updateConsMemory(cons);
+      }
 
       for (v = 0; v < consdata->nvars; ++v)
       {
@@ -6446,6 +7667,7 @@ SCIP_DECL_CONSLOCK(consLockSdp)
       int blocksize;
 
       SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->locks, nvars) );
+      updateConsMemory(cons);
 
       blocksize = consdata->blocksize;
 
@@ -6580,6 +7802,7 @@ SCIP_DECL_CONSEXIT(consExitSdp)
          SCIPverbMessage(scip, SCIP_VERBLEVEL_FULL, 0, "Number propagations through upper bounds in probing:  %d\n", conshdlrdata->npropprobub);
          SCIPverbMessage(scip, SCIP_VERBLEVEL_FULL, 0, "Number of tightened bounds in propagation in probing: %d\n", conshdlrdata->npropprobtb);
          SCIPverbMessage(scip, SCIP_VERBLEVEL_FULL, 0, "Number of propagation through 3x3 minors in probing: %d\n", conshdlrdata->npropprob3minor);
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_FULL, 0, "Number of separation calls using stored eigenvectors: %d\n", conshdlrdata->nstoredevcuts);
       }
 
       /* reset counters */
@@ -6606,6 +7829,7 @@ SCIP_DECL_CONSEXIT(consExitSdp)
       conshdlrdata->npropprobub = 0;
       conshdlrdata->npropprobtb = 0;
       conshdlrdata->npropprob3minor = 0;
+      conshdlrdata->nstoredevcuts = 0;
    }
 
    /* reset parameter triedlinearconss */
@@ -6699,6 +7923,7 @@ SCIP_DECL_CONSINITSOL(consInitsolSdp)
    }
 
    conshdlrdata->relaxsdp = SCIPfindRelax(scip, "SDP");
+   conshdlrdata->sdpconshdlrdata->dropcaches = FALSE;
 
    /* make sure that quadratic constraints are added */
    if ( SCIPgetSubscipDepth(scip) == 0 && conshdlrdata->sdpconshdlrdata->quadconsrank1 )
@@ -6733,8 +7958,8 @@ SCIP_DECL_CONSPROP(consPropSdp)
 
    *result = SCIP_DIDNOTRUN;
 
-   /* if we want to propagate upper bounds */
-   if ( conshdlrdata->sdpconshdlrdata->propupperbounds )
+   /* if we want to propagate upper bounds (not possible if the propagation data has been freed) */
+   if ( conshdlrdata->sdpconshdlrdata->propupperbounds && ! conshdlrdata->sdpconshdlrdata->dropcaches )
    {
       *result = SCIP_DIDNOTFIND;
 
@@ -6805,7 +8030,7 @@ SCIP_DECL_CONSPROP(consPropSdp)
             SCIP_CALL( SCIPstartClock(scip, conshdlrdata->sdpconshdlrdata->proptbtime) );
          }
 
-         SCIP_CALL( tightenBounds(scip, conss, nconss, conshdlrdata->sdpconshdlrdata->tightenboundscont, &nprop, &nintrnd, &infeasible) );
+         SCIP_CALL( tightenBounds(scip, conss, nconss, 1, conshdlrdata->sdpconshdlrdata->tightenboundscont, &nprop, &nintrnd, &infeasible) );
 
          if ( conshdlrdata->sdpconshdlrdata->enableproptiming )
          {
@@ -6843,8 +8068,8 @@ SCIP_DECL_CONSPROP(consPropSdp)
       }
    }
 
-   /* if we want to propagate 3x3 minors and we are not in probing */
-   if ( conshdlrdata->sdpconshdlrdata->prop3minors )
+   /* if we want to propagate 3x3 minors and we are not in probing (not possible if the propagation data has been freed) */
+   if ( conshdlrdata->sdpconshdlrdata->prop3minors && ! conshdlrdata->sdpconshdlrdata->dropcaches )
    {
       if ( conshdlrdata->sdpconshdlrdata->prop3mprobing || ! SCIPinProbing(scip) )
       {
@@ -6933,6 +8158,9 @@ SCIP_DECL_CONSRESPROP(consRespropSdp)
    /* if inferinfo is >=, the bound change came from propagateUpperBounds() */
    if ( inferinfo >= 0 )
    {
+      /* the propagation data might have been freed in the meantime */
+      SCIP_CALL( constructMatrixvar(scip, cons, consdata) );
+
       s = inferinfo / consdata->blocksize;
       t = inferinfo % consdata->blocksize;
       assert( 0 <= s && s < consdata->blocksize );
@@ -6987,7 +8215,10 @@ static
 SCIP_DECL_CONSPRESOL(consPresolSdp)
 {/*lint --e{715}*/
    SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_Real* maxconsteigenvals;
+   SCIP_Bool computepsd;
    SCIP_Bool infeasible;
+   int nthreads = 1;
    int nprop = 0;
    int nintrnd = 0;
    int c;
@@ -7007,6 +8238,16 @@ SCIP_DECL_CONSPRESOL(consPresolSdp)
       SCIP_CALL( fixAndAggrVars(scip, conss, nconss, TRUE) );
    }
 
+   /* compute the eigenvalue information of all constraints; in the initial round, this includes checking whether all
+    * matrices are psd (needed for tightening matrices and bounds) */
+   computepsd = SCIPconshdlrGetNPresolCalls(conshdlr) == 0
+      && ( conshdlrdata->sdpconshdlrdata->tightenmatrices || conshdlrdata->sdpconshdlrdata->tightenbounds );
+#ifdef OMP
+   nthreads = conshdlrdata->sdpconshdlrdata->presolnthreads;
+#endif
+   SCIP_CALL( SCIPallocBufferArray(scip, &maxconsteigenvals, nconss) );
+   SCIP_CALL( presolComputeEigenvalues(scip, conss, nconss, nthreads, computepsd, maxconsteigenvals) );
+
    /* check for empty constraints */
    for (c = 0; c < nconss && *result != SCIP_CUTOFF; ++c)
    {
@@ -7019,14 +8260,10 @@ SCIP_DECL_CONSPRESOL(consPresolSdp)
       /* for empty constraint check whether constant matrix is not infeasible */
       if ( consdata->nvars <= 0 )
       {
-         SCIP_Real* constmatrix;
          SCIP_Real eigenvalue;
-         int blocksize;
 
-         blocksize = consdata->blocksize;
-         SCIP_CALL( SCIPallocBufferArray(scip, &constmatrix, blocksize * blocksize) );
-         SCIP_CALL( SCIPconsSdpGetFullConstMatrix(scip, conss[c], constmatrix) );
-         SCIP_CALL( SCIPlapackComputeIthEigenvalue(SCIPbuffer(scip), FALSE, blocksize, constmatrix, blocksize, &eigenvalue, NULL) );
+         eigenvalue = maxconsteigenvals[c];
+         assert( eigenvalue != SCIP_INVALID ); /*lint !e777*/
 
          /* if largest eigenvalue is positive then minus the constant matrix is not psd and we are infeasible */
          if ( SCIPisFeasPositive(scip, eigenvalue) )
@@ -7041,12 +8278,13 @@ SCIP_DECL_CONSPRESOL(consPresolSdp)
             ++(ndelconss);
             *result = SCIP_SUCCESS;
          }
-         SCIPfreeBufferArray(scip, &constmatrix);
       }
       else if ( *result == SCIP_DIDNOTRUN )
          *result = SCIP_DIDNOTFIND;
    }
 
+   SCIPfreeBufferArray(scip, &maxconsteigenvals);
+
    if ( *result == SCIP_CUTOFF )
       return SCIP_OKAY;
 
@@ -7104,7 +8342,7 @@ SCIP_DECL_CONSPRESOL(consPresolSdp)
       /* possibly compute tightening of matrices */
       if ( conshdlrdata->sdpconshdlrdata->tightenmatrices )
       {
-         SCIP_CALL( tightenMatrices(scip, conss, nconss, nchgcoefs) );
+         SCIP_CALL( tightenMatrices(scip, conss, nconss, nthreads, nchgcoefs) );
          if ( noldchgcoefs != *nchgcoefs )
          {
             SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "Tightened %d SDP coefficient matrices.\n", *nchgcoefs - noldchgcoefs);
@@ -7117,7 +8355,7 @@ SCIP_DECL_CONSPRESOL(consPresolSdp)
       {
          nprop = 0;
          nintrnd = 0;
-         SCIP_CALL( tightenBounds(scip, conss, nconss, conshdlrdata->sdpconshdlrdata->tightenboundscont, &nprop, &nintrnd, &infeasible) );
+         SCIP_CALL( tightenBounds(scip, conss, nconss, nthreads, conshdlrdata->sdpconshdlrdata->tightenboundscont, &nprop, &nintrnd, &infeasible) );
          if ( infeasible )
          {
             *result = SCIP_CUTOFF;
@@ -7287,9 +8525,13 @@ SCIP_DECL_CONSTRANS(consTransSdp)
    conshdlrdata = SCIPconshdlrGetData(conshdlr);
 
 #ifdef OMP
-   SCIPdebugMsg(scip, "Setting number of threads to %d via OpenMP in Openblas.\n", conshdlrdata->sdpconshdlrdata->nthreads);
-   omp_set_num_threads(conshdlrdata->sdpconshdlrdata->nthreads);
+   if ( conshdlrdata->sdpconshdlrdata->nthreads > 0 )
+   {
+      SCIPdebugMsg(scip, "Setting number of threads to %d via OpenMP in Openblas.\n", conshdlrdata->sdpconshdlrdata->nthreads);
+      omp_set_num_threads(conshdlrdata->sdpconshdlrdata->nthreads);
+   }
 #endif
+   SCIPlapackSetNThreads(conshdlrdata->sdpconshdlrdata->nthreads > 0 ? conshdlrdata->sdpconshdlrdata->nthreads : -1);
 
    SCIP_CALL( SCIPallocBlockMemory(scip, &targetdata) );
 
@@ -7305,6 +8547,7 @@ SCIP_DECL_CONSTRANS(consTransSdp)
    targetdata->tracebound = -2.0;
    targetdata->allmatricespsd = sourcedata->allmatricespsd;
    targetdata->initallmatricespsd = sourcedata->initallmatricespsd;
+   targetdata->sortednonz = sourcedata->sortednonz;
 
    SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(targetdata->nvarnonz), sourcedata->nvarnonz, sourcedata->nvars) );
 
@@ -7359,6 +8602,16 @@ SCIP_DECL_CONSTRANS(consTransSdp)
    /* copy maxevsubmat */
    SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(targetdata->maxevsubmat), sourcedata->maxevsubmat, 2) );
 
+   /* the store of eigenvectors is created on demand during separation */
+   targetdata->storedevs = NULL;
+   targetdata->maxnstoredevs = 0;
+   targetdata->nstoredevs = 0;
+   targetdata->storedevspos = 0;
+
+   /* the memory is counted after creating the constraint */
+   targetdata->memory = 0;
+   targetdata->propmemory = 0;
+
    /* copy addedquadcons */
    targetdata->addedquadcons = sourcedata->addedquadcons;
 
@@ -7376,6 +8629,7 @@ SCIP_DECL_CONSTRANS(consTransSdp)
          SCIPconsIsChecked(sourcecons), SCIPconsIsPropagated(sourcecons),  SCIPconsIsLocal(sourcecons),
          SCIPconsIsModifiable(sourcecons), SCIPconsIsDynamic(sourcecons), SCIPconsIsRemovable(sourcecons),
          SCIPconsIsStickingAtNode(sourcecons)) );
+   updateConsMemory(*targetcons);
 
    /* we need to compute the DIMACS tolerance (if required) at this point, because it is needed in CONSCHECK */
    if ( conshdlrdata->sdpconshdlrdata->usedimacsfeastol )
@@ -8185,6 +9439,7 @@ SCIP_DECL_CONSSEPALP(consSepalpSdp)
 static
 SCIP_DECL_CONSDELETE(consDeleteSdp)
 {/*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
    int i;
 
    assert( cons != NULL );
@@ -8192,9 +9447,18 @@ SCIP_DECL_CONSDELETE(consDeleteSdp)
 
    SCIPdebugMsg(scip, "deleting SDP constraint <%s>.\n", SCIPconsGetName(cons));
 
+   /* remove the memory of the constraint from the memory of the constraint handler */
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   conshdlrdata->consdatamem -= (*consdata)->memory;
+   conshdlrdata->propmem -= (*consdata)->propmemory;
+
    /* release memory for rank one constraint */
    SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->maxevsubmat, 2);
 
+   /* release store of eigenvectors */
+   SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->storedevs, (*consdata)->maxnstoredevs * (*consdata)->blocksize);
+
    for (i = 0; i < (*consdata)->nvars; i++)
    {
       SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->val[i], (*consdata)->nvarnonz[i]);
@@ -8356,6 +9620,7 @@ SCIP_DECL_CONSCOPY(consCopySdp)
       SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(targetdata->locks), sourcedata->locks, sourcedata->nvars) );
       targetdata->allmatricespsd = sourcedata->allmatricespsd;
       targetdata->initallmatricespsd = sourcedata->initallmatricespsd;
+      updateConsMemory(*cons);
    }
 
    SCIPfreeBufferArray(scip, &targetvars);
@@ -8504,32 +9769,63 @@ SCIP_DECL_CONSPRINT(consPrintSdp)
 #endif
 }
 
-/** parse an SDP constraint */
+/** parse an SDP constraint
+ *
+ *  The string is parsed in two passes: the first pass counts the variables and the nonzeros of each matrix, so that the
+ *  second pass can fill arrays of exactly the right size. Numbers are converted in place; the name of a variable is
+ *  copied into a buffer on the stack and looked up directly with SCIPfindVar(). Only negated variables "<~x>" are
+ *  parsed with SCIPparseVarName().
+ */
 static
 SCIP_DECL_CONSPARSE(consParseSdp)
 {  /*lint --e{715}*/
-   SCIP_Bool parsesuccess;
    SCIP_CONSDATA* consdata = NULL;
-   char* pos;
-   int currentsize;
+   char varname[SCIP_MAXSTRLEN];
+   const char* pos;
+   const char* nameend;
+   char* endptr;
+   int* nvarnonz;
+   int constnnonz;
+   int maxnvars;
    int nvars;
+   int rankoneint;
+   int blocksize;
    int i;
    int v;
-   int rankoneint;
 
    assert( scip != NULL );
    assert( str != NULL );
+   assert( success != NULL );
 
-   nvars = SCIPgetNVars(scip);
+   *success = FALSE;
 
-   assert( success != NULL );
-   *success = TRUE;
+   /* first pass: count variables and nonzeros; each variable starts with '<' */
+   maxnvars = 0;
+   for (pos = strchr(str, '<'); pos != NULL; pos = strchr(pos + 1, '<'))
+      ++maxnvars;
 
-   /* create constraint data */
+   SCIP_CALL( SCIPallocBufferArray(scip, &nvarnonz, MAX(maxnvars, 1)) );
+   if ( ! parseCountNonzeros(str, &constnnonz, &nvars, nvarnonz) )
+   {
+      SCIPerrorMessage("Syntax error in SDP constraint <%s>: unterminated variable name.\n", name);
+      SCIPfreeBufferArray(scip, &nvarnonz);
+      return SCIP_OKAY;
+   }
+
+   /* parse the blocksize */
+   if ( ! parseInt(str, &blocksize, &pos) || blocksize <= 0 )
+   {
+      SCIPerrorMessage("Syntax error in SDP constraint <%s>: expected blocksize.\n", name);
+      SCIPfreeBufferArray(scip, &nvarnonz);
+      return SCIP_OKAY;
+   }
+
+   /* create constraint data with arrays of exactly the right size */
    SCIP_CALL( SCIPallocBlockMemory(scip, &consdata) );
-   consdata->nvars = 0;
+   consdata->blocksize = blocksize;
+   consdata->nvars = nvars;
    consdata->nnonz = 0;
-   consdata->constnnonz = 0;
+   consdata->constnnonz = constnnonz;
    consdata->rankone = 0;
    consdata->addedquadcons = FALSE;
    consdata->locks = NULL;
@@ -8543,193 +9839,176 @@ SCIP_DECL_CONSPARSE(consParseSdp)
    consdata->allmatricespsd = FALSE;
    consdata->initallmatricespsd = FALSE;
 
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->nvarnonz, nvars) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->col, nvars) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->row, nvars) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->val, nvars) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->vars, nvars));
-
+   consdata->nvarnonz = NULL;
+   consdata->col = NULL;
+   consdata->row = NULL;
+   consdata->val = NULL;
+   consdata->vars = NULL;
    consdata->constcol = NULL;
    consdata->constrow = NULL;
    consdata->constval = NULL;
 
-   /* parse the blocksize */
-   parsesuccess = SCIPstrToIntValue(str, &(consdata->blocksize), &pos);
-   *success = *success && parsesuccess;
+   if ( nvars > 0 )
+   {
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &consdata->nvarnonz, nvarnonz, nvars) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->col, nvars) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->row, nvars) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->val, nvars) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->vars, nvars) );
+   }
+   for (v = 0; v < nvars; v++)
+   {
+      consdata->nnonz += nvarnonz[v];
+      consdata->col[v] = NULL;
+      consdata->row[v] = NULL;
+      consdata->val[v] = NULL;
+      if ( nvarnonz[v] > 0 )
+      {
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->col[v], nvarnonz[v]) );
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->row[v], nvarnonz[v]) );
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->val[v], nvarnonz[v]) );
+      }
+   }
+   if ( constnnonz > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->constcol, constnnonz) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->constrow, constnnonz) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->constval, constnnonz) );
+   }
+
+   /* second pass: fill the arrays */
 
    /* skip whitespace */
    while ( isspace((unsigned char)*pos) )
       pos++;
 
    /* parse the rank1-information */
-   if ( pos[0] == 'r' && pos[1] == 'a' && pos[2] == 'n' && pos[3] == 'k' && pos[4] == '-' && pos[5] == '1' && pos[6] == '?' )
+   if ( strncmp(pos, "rank-1?", 7) == 0 )
    {
-      pos += 8;                 /* we skip "rank1-? " */
-      parsesuccess = SCIPstrToIntValue(pos, &rankoneint, &pos);
+      if ( ! parseInt(pos + 7, &rankoneint, &pos) )
+         goto TERMINATE;
       consdata->rankone = (SCIP_Bool) rankoneint;
-      *success = *success && parsesuccess;
    }
 
    /* skip whitespace */
-   while( isspace((unsigned char)*pos) )
+   while ( isspace((unsigned char)*pos) )
       pos++;
 
-   /* check if there is a constant part */
-   if ( pos[0] == 'A' && pos[1] == '_' && pos[2] == '0' )
+   /* parse the constant part */
+   if ( strncmp(pos, "A_0:", 4) == 0 )
    {
-      pos += 5; /* we skip "A_0: " */
+      pos += 4;
+      while ( isspace((unsigned char)*pos) )
+         pos++;
+   }
 
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->constcol, PARSE_STARTSIZE) );
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->constrow, PARSE_STARTSIZE) );
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->constval, PARSE_STARTSIZE) );
+   for (i = 0; i < constnnonz; i++)
+   {
+      if ( *pos != '(' || ! parseMatrixEntry(pos, blocksize, &consdata->constrow[i], &consdata->constcol[i], &consdata->constval[i], &pos) )
+         goto TERMINATE;
+   }
 
-      currentsize = PARSE_STARTSIZE;
+   /* parse the non-constant part */
+   for (v = 0; v < nvars; v++)
+   {
+      if ( *pos != '<' )
+         goto TERMINATE;
 
-      /* as long as there is another entry for the constant part, parse it */
-      while (pos[0] == '(')
+      if ( pos[1] == '~' )
       {
-         pos++; /* remove the '(' */
-
-         /* check if we need to enlarge the arrays */
-         if ( consdata->constnnonz == currentsize )
-         {
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->constcol, currentsize, PARSE_SIZEFACTOR * currentsize) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->constrow, currentsize, PARSE_SIZEFACTOR * currentsize) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->constval, currentsize, PARSE_SIZEFACTOR * currentsize) );
-            currentsize *= PARSE_SIZEFACTOR;
-         }
-
-         parsesuccess = SCIPstrToIntValue(pos, &(consdata->constrow[consdata->constnnonz]), &pos);
-         *success = *success && parsesuccess;
-         assert( consdata->constrow[consdata->constnnonz] < consdata->blocksize );
-         pos++; /* remove the ',' */
-         parsesuccess = SCIPstrToIntValue(pos, &(consdata->constcol[consdata->constnnonz]), &pos);
-         *success = *success && parsesuccess;
-         assert( consdata->constcol[consdata->constnnonz] < consdata->blocksize );
-         pos += 2; /* remove the "):" */
-         parsesuccess = SCIPstrToRealValue(pos, &(consdata->constval[consdata->constnnonz]), &pos);
-         *success = *success && parsesuccess;
-         pos ++; /* remove the "," */
-
-         /* if we got an entry in the upper triangular part, switch the entries for lower triangular */
-         if ( consdata->constcol[consdata->constnnonz] > consdata->constrow[consdata->constnnonz] )
-         {
-            i = consdata->constcol[consdata->constnnonz];
-            consdata->constcol[consdata->constnnonz] = consdata->constrow[consdata->constnnonz];
-            consdata->constrow[consdata->constnnonz] = i;
-         }
-
-         consdata->constnnonz++;
-
-         /* skip whitespace */
-         while( isspace((unsigned char)*pos) )
-            pos++;
+         SCIP_CALL( SCIPparseVarName(scip, pos, &consdata->vars[v], &endptr) );
+         pos = endptr;
       }
+      else
+      {
+         /* the first pass ensured that the name is terminated */
+         nameend = strchr(pos + 1, '>');
+         assert( nameend != NULL );
+         if ( nameend - pos - 1 >= SCIP_MAXSTRLEN )
+            goto TERMINATE;
+
+         (void) memcpy(varname, pos + 1, (size_t) (nameend - pos - 1));
+         varname[nameend - pos - 1] = '\0';
+         consdata->vars[v] = SCIPfindVar(scip, varname);
+         pos = nameend + 1;
+      }
+      if ( consdata->vars[v] == NULL )
+         goto TERMINATE;
+      if ( *pos != ':' )
+         goto TERMINATE;
+      pos++;
+      while ( isspace((unsigned char)*pos) )
+         pos++;
 
-      /* resize the arrays to their final size */
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->constcol, currentsize, consdata->constnnonz) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->constrow, currentsize, consdata->constnnonz) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->constval, currentsize, consdata->constnnonz) );
+      for (i = 0; i < nvarnonz[v]; i++)
+      {
+         if ( *pos != '(' || ! parseMatrixEntry(pos, blocksize, &consdata->row[v][i], &consdata->col[v][i], &consdata->val[v][i], &pos) )
+            goto TERMINATE;
+      }
    }
 
-   /* skip whitespace */
-   while( isspace((unsigned char)*pos) )
-      pos++;
+   *success = TRUE;
 
-   /* parse the non-constant part */
+ TERMINATE:
+   SCIPfreeBufferArray(scip, &nvarnonz);
 
-   /* while there is another variable, parse it */
-   while ( pos[0] == '<' )
+   if ( ! *success )
    {
-      /* add the variable to consdata->vars and create the corresponding nonzero arrays */
-      SCIP_CALL( SCIPparseVarName(scip, pos, &(consdata->vars[consdata->nvars]), &pos) );
-      SCIP_CALL( SCIPcaptureVar(scip, consdata->vars[consdata->nvars]) );
-
-      consdata->nvarnonz[consdata->nvars] = 0;
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(consdata->col[consdata->nvars]), PARSE_STARTSIZE));
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(consdata->row[consdata->nvars]), PARSE_STARTSIZE));
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(consdata->val[consdata->nvars]), PARSE_STARTSIZE));
-      consdata->nvars++;
-      currentsize = PARSE_STARTSIZE;
-
-      pos += 2; /* remove the ": " */
+      SCIPerrorMessage("Syntax error or unknown variable in SDP constraint <%s> at <%.40s>.\n", name, pos);
 
-      /* while there is another entry, parse it */
-      while (pos[0] == '(')
+      for (v = 0; v < nvars; v++)
       {
-         pos++; /* remove the '(' */
-
-         /* check if we need to enlarge the arrays */
-         if ( consdata->nvarnonz[consdata->nvars - 1] == currentsize )
-         {
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->col[consdata->nvars - 1], currentsize, PARSE_SIZEFACTOR * currentsize) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->row[consdata->nvars - 1], currentsize, PARSE_SIZEFACTOR * currentsize) );
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->val[consdata->nvars - 1], currentsize, PARSE_SIZEFACTOR * currentsize) );
-            currentsize *= PARSE_SIZEFACTOR;
-         }
-
-         parsesuccess = SCIPstrToIntValue(pos, &(consdata->row[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]]), &pos);
-         *success = *success && parsesuccess;
-         assert( consdata->row[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]] < consdata->blocksize );
-         pos++; /* remove the ',' */
-         parsesuccess = SCIPstrToIntValue(pos, &(consdata->col[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]]), &pos);
-         *success = *success && parsesuccess;
-         assert( consdata->col[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]] < consdata->blocksize );
-         pos += 2; /* remove the "):" */
-         parsesuccess = SCIPstrToRealValue(pos, &(consdata->val[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]]), &pos);
-         *success = *success && parsesuccess;
-         if ( *pos != '\0' )
-            pos ++; /* remove the "," */
-
-         /* if we got an entry in the upper triangular part, switch the entries for lower triangular */
-         if ( consdata->col[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]] >
-               consdata->row[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]] )
-         {
-            i = consdata->col[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]];
-            consdata->col[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]] =
-                  consdata->row[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]];
-            consdata->row[consdata->nvars - 1][consdata->nvarnonz[consdata->nvars - 1]] = i;
-         }
-
-         consdata->nvarnonz[consdata->nvars - 1]++;
-
-         /* skip whitespace */
-         while( isspace((unsigned char)*pos) )
-            pos++;
+         SCIPfreeBlockMemoryArrayNull(scip, &consdata->val[v], consdata->nvarnonz[v]);
+         SCIPfreeBlockMemoryArrayNull(scip, &consdata->row[v], consdata->nvarnonz[v]);
+         SCIPfreeBlockMemoryArrayNull(scip, &consdata->col[v], consdata->nvarnonz[v]);
       }
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->constval, constnnonz);
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->constrow, constnnonz);
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->constcol, constnnonz);
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->vars, nvars);
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->val, nvars);
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->row, nvars);
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->col, nvars);
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->nvarnonz, nvars);
+      SCIPfreeBlockMemory(scip, &consdata);
 
-      /* resize the arrays to their final size */
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->col[consdata->nvars - 1], currentsize, consdata->nvarnonz[consdata->nvars - 1]) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->row[consdata->nvars - 1], currentsize, consdata->nvarnonz[consdata->nvars - 1]) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->val[consdata->nvars - 1], currentsize, consdata->nvarnonz[consdata->nvars - 1]) );
-
-      /* skip whitespace */
-      while ( isspace((unsigned char)*pos) )
-         pos++;
+      return SCIP_OKAY;
    }
 
-   /* resize the arrays to their final size */
-   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->nvarnonz, nvars, consdata->nvars) );
-   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->col, nvars, consdata->nvars) );
-   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->row, nvars, consdata->nvars) );
-   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->val, nvars, consdata->nvars) );
-   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->vars, nvars, consdata->nvars));
+   /* capture the variables */
+   for (v = 0; v < nvars; v++)
+   {
+      SCIP_CALL( SCIPcaptureVar(scip, consdata->vars[v]) );
+   }
 
-   /* compute sdpnnonz */
-   for (v = 0; v < consdata->nvars; v++)
-      consdata->nnonz += consdata->nvarnonz[v];
+   /* sort the nonzeros, which are given in arbitrary order */
+   for (v = 0; v < nvars; v++)
+      SCIPsdpVarfixerSortRowCol(consdata->row[v], consdata->col[v], consdata->val[v], consdata->nvarnonz[v]);
+   SCIPsdpVarfixerSortRowCol(consdata->constrow, consdata->constcol, consdata->constval, consdata->constnnonz);
+   consdata->sortednonz = consdataNonzSorted(consdata);
 
    /* set maxevsubmat */
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->maxevsubmat, 2) );
    consdata->maxevsubmat[0] = -1;
    consdata->maxevsubmat[1] = -1;
 
+   /* the store of eigenvectors is created on demand during separation */
+   consdata->storedevs = NULL;
+   consdata->maxnstoredevs = 0;
+   consdata->nstoredevs = 0;
+   consdata->storedevspos = 0;
+
+   /* the memory is counted after creating the constraint */
+   consdata->memory = 0;
+   consdata->propmemory = 0;
+
    /* create the constraint */
    SCIP_CALL( SCIPcreateCons(scip, cons, name, conshdlr, consdata, initial, separate, enforce, check, propagate, local, modifiable,
          dynamic, removable, stickingatnode) );
 
    /* compute maximum rhs entry for later use in the DIMACS Error Norm */
    SCIP_CALL( setMaxRhsEntry(*cons) );
+   updateConsMemory(*cons);
 
 #ifdef SCIP_MORE_DEBUG
    SCIP_CALL( SCIPprintCons(scip, *cons, NULL) );
@@ -8792,6 +10071,15 @@ SCIP_DECL_CONSGETNVARS(consGetNVarsSdp)
    return SCIP_OKAY;
 }
 
+/** callback to pass the deterministic mode on to the LAPACK interface once the parameter is changed */
+static
+SCIP_DECL_PARAMCHGD(paramChgdSdpDeterministic)
+{  /*lint --e{715}*/
+   SCIPlapackSetDeterministic(SCIPparamGetBool(param));
+
+   return SCIP_OKAY;
+}
+
 /** creates the handler for SDP constraints and includes it in SCIP */
 SCIP_RETCODE SCIPincludeConshdlrSdp(
    SCIP*                 scip                /**< SCIP data structure */
@@ -8819,6 +10107,12 @@ SCIP_RETCODE SCIPincludeConshdlrSdp(
    conshdlrdata->ncallspropub = 0;
    conshdlrdata->ncallsproptb = 0;
    conshdlrdata->ncallsprop3minor = 0;
+   conshdlrdata->nstoredevcuts = 0;
+   conshdlrdata->dropcaches = FALSE;
+   conshdlrdata->consdatamem = 0;
+   conshdlrdata->propmem = 0;
+   conshdlrdata->peakconsdatamem = 0;
+   conshdlrdata->peakpropmem = 0;
    conshdlrdata->propubtime = NULL;
    conshdlrdata->proptbtime = NULL;
    conshdlrdata->prop3minortime = NULL;
@@ -8871,11 +10165,19 @@ SCIP_RETCODE SCIPincludeConshdlrSdp(
    SCIP_CALL( SCIPsetConshdlrGetNVars(scip, conshdlr, consGetNVarsSdp) );
 
    /* add parameter */
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/SDP/threads", "number of threads used for OpenBLAS (-1: leave the number of threads of OpenBLAS unchanged)",
+         &(conshdlrdata->nthreads), TRUE, DEFAULT_NTHREADS, -1, INT_MAX, NULL, NULL) );
+
 #ifdef OMP
-   SCIP_CALL( SCIPaddIntParam(scip, "constraints/SDP/threads", "number of threads used for OpenBLAS",
-         &(conshdlrdata->nthreads), TRUE, DEFAULT_NTHREADS, 1, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/SDP/presolthreads",
+         "number of threads used for the eigenvalue computations and one-variable SDPs of the constraints in presolving (only available with OpenMP)",
+         &(conshdlrdata->presolnthreads), TRUE, DEFAULT_PRESOLNTHREADS, 1, INT_MAX, NULL, NULL) );
 #endif
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/SDP/deterministic",
+         "Should the results be independent of the number of threads (BLAS/LAPACK and the SDP solver run single-threaded)?",
+         &(conshdlrdata->deterministic), TRUE, DEFAULT_DETERMINISTIC, paramChgdSdpDeterministic, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip, "constraints/SDP/propupperbounds",
          "Should upper bounds be propagated?",
          &(conshdlrdata->propupperbounds), TRUE, DEFAULT_PROPUPPERBOUNDS, NULL, NULL) );
@@ -9036,6 +10338,10 @@ SCIP_RETCODE SCIPincludeConshdlrSdp(
          "Should small values in the constraints be removed?",
          &(conshdlrdata->removesmallval), TRUE, DEFAULT_REMOVESMALLVAL, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/SDP/maxnstoredevs",
+         "maximal number of eigenvector directions stored per constraint and checked before computing eigenvalues (0: off)",
+         &(conshdlrdata->maxnstoredevs), TRUE, DEFAULT_MAXNSTOREDEVS, 0, INT_MAX, NULL, NULL) );
+
    return SCIP_OKAY;
 }
 
@@ -9088,9 +10394,11 @@ SCIP_RETCODE SCIPincludeConshdlrSdpRank1(
    conshdlrdata->rank1approxheur = FALSE;
    conshdlrdata->generaterows = FALSE;
    conshdlrdata->generatecmir = FALSE;
-#ifdef OMP
    conshdlrdata->nthreads = 0;
+#ifdef OMP
+   conshdlrdata->presolnthreads = 0;
 #endif
+   conshdlrdata->deterministic = FALSE;
    conshdlrdata->usedimacsfeastol = FALSE;
    conshdlrdata->recomputesparseev = FALSE;
    conshdlrdata->recomputeinitial = FALSE;
@@ -9098,6 +10406,7 @@ SCIP_RETCODE SCIPincludeConshdlrSdpRank1(
    conshdlrdata->presollinconssparam = 0;
    conshdlrdata->additionalstats = FALSE;
    conshdlrdata->enableproptiming = FALSE;
+   conshdlrdata->maxnstoredevs = 0;
 
    /* parameters are retrieved through the SDP constraint handler */
    sdpconshdlr = SCIPfindConshdlr(scip, CONSHDLR_NAME);
@@ -9121,6 +10430,12 @@ SCIP_RETCODE SCIPincludeConshdlrSdpRank1(
    conshdlrdata->ncallspropub = 0;
    conshdlrdata->ncallsproptb = 0;
    conshdlrdata->ncallsprop3minor = 0;
+   conshdlrdata->nstoredevcuts = 0;
+   conshdlrdata->dropcaches = FALSE;
+   conshdlrdata->consdatamem = 0;
+   conshdlrdata->propmem = 0;
+   conshdlrdata->peakconsdatamem = 0;
+   conshdlrdata->peakpropmem = 0;
    conshdlrdata->propubtime = NULL;
    conshdlrdata->proptbtime = NULL;
    conshdlrdata->prop3minortime = NULL;
@@ -9407,8 +10722,7 @@ SCIP_RETCODE SCIPconsSdpGetFullAj(
 
    assert( j < consdata->nvars );
 
-   for (i = 0; i < blocksize * blocksize; i++)
-      Aj[i] = 0;
+   BMSclearMemoryArray(Aj, blocksize * blocksize);
 
    for (i = 0; i < consdata->nvarnonz[j]; i++)
    {
@@ -9694,6 +11008,8 @@ SCIP_RETCODE SCIPconsSdpComputeSparseSdpMatrix(
    consdata = SCIPconsGetData(cons);
    assert( consdata != NULL );
 
+   assert( ! consdata->sortednonz || consdataNonzSorted(consdata) );
+
    /* initialize nnonz/row/col/val with constant arrays */
    nnonz = consdata->constnnonz;
    if ( *length < nnonz )
@@ -9715,7 +11031,7 @@ SCIP_RETCODE SCIPconsSdpComputeSparseSdpMatrix(
    for (v = 0; v < consdata->nvars; v++)
    {
       SCIP_CALL( SCIPsdpVarfixerMergeArrays(SCIPblkmem(scip), SCIPepsilon(scip), consdata->row[v], consdata->col[v], consdata->val[v], consdata->nvarnonz[v],
-            FALSE, SCIPgetSolVal(scip, sol, consdata->vars[v]), row, col, val, &nnonz, *length) );
+            consdata->sortednonz, SCIPgetSolVal(scip, sol, consdata->vars[v]), row, col, val, &nnonz, *length) );
       if ( nnonz > *length )
       {
          *length = -1;
@@ -9782,6 +11098,173 @@ SCIP_Bool SCIPconsSdpAddedQuadCons(
    return consdata->addedquadcons;
 }
 
+/** returns the number of bytes used by the constraints of an SDP constraint handler and the maximal numbers since the
+ *  last call of SCIPconshdlrSdpResetPeakMemory()
+ *
+ *  The memory of the constraint data (matrices, locks, stored eigenvectors) and of the alternative view of the matrix
+ *  entries for propagation (matrixvar, matrixval, matrixconst) is reported separately. Both are updated whenever arrays
+ *  of a constraint are (re)allocated or freed and include original and transformed constraints. The sizes are computed
+ *  from the lengths of the arrays, so they do not include the overhead of the memory allocators.
+ */
+void SCIPconshdlrSdpGetMemory(
+   SCIP_CONSHDLR*        conshdlr,           /**< SDP or SDPrank1 constraint handler */
+   SCIP_Longint*         consdatamem,        /**< pointer to store the memory of the constraint data */
+   SCIP_Longint*         propmem,            /**< pointer to store the memory of the propagation data */
+   SCIP_Longint*         peakconsdatamem,    /**< pointer to store the maximal memory of the constraint data (or NULL) */
+   SCIP_Longint*         peakpropmem         /**< pointer to store the maximal memory of the propagation data (or NULL) */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( conshdlr != NULL );
+   assert( consdatamem != NULL );
+   assert( propmem != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   *consdatamem = conshdlrdata->consdatamem;
+   *propmem = conshdlrdata->propmem;
+   if ( peakconsdatamem != NULL )
+      *peakconsdatamem = conshdlrdata->peakconsdatamem;
+   if ( peakpropmem != NULL )
+      *peakpropmem = conshdlrdata->peakpropmem;
+}
+
+/** resets the maximal memory of the constraints of an SDP constraint handler to the current memory */
+void SCIPconshdlrSdpResetPeakMemory(
+   SCIP_CONSHDLR*        conshdlr            /**< SDP or SDPrank1 constraint handler */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( conshdlr != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   conshdlrdata->peakconsdatamem = conshdlrdata->consdatamem;
+   conshdlrdata->peakpropmem = conshdlrdata->propmem;
+}
+
+/** frees the propagation data (matrixvar, matrixval, matrixconst) and the stored eigenvectors of all constraints of an
+ *  SDP constraint handler
+ *
+ *  For the rest of the solving process, propagation of upper bounds and 3x3 minors (which need the propagation data) is
+ *  skipped and no eigenvectors are stored anymore. Resolving earlier propagations rebuilds the propagation data of the
+ *  respective constraint.
+ */
+SCIP_RETCODE SCIPconshdlrSdpFreeCaches(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< SDP or SDPrank1 constraint handler */
+   SCIP_Longint*         nfreedbytes         /**< pointer to store the number of freed bytes */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONS** conss;
+   int nconss;
+   int c;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+   assert( nfreedbytes != NULL );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   conshdlrdata->sdpconshdlrdata->dropcaches = TRUE;
+
+   *nfreedbytes = 0;
+   conss = SCIPconshdlrGetConss(conshdlr);
+   nconss = SCIPconshdlrGetNConss(conshdlr);
+
+   for (c = 0; c < nconss; ++c)
+   {
+      SCIP_CONSDATA* consdata;
+      SCIP_Longint oldmemory;
+      int nentries;
+
+      consdata = SCIPconsGetData(conss[c]);
+      assert( consdata != NULL );
+      oldmemory = consdata->memory + consdata->propmemory;
+
+      if ( consdata->matrixvar != NULL )
+      {
+         nentries = consdata->blocksize * (consdata->blocksize + 1) / 2;
+         SCIPfreeBlockMemoryArray(scip, &consdata->matrixconst, nentries);
+         SCIPfreeBlockMemoryArray(scip, &consdata->matrixval, nentries);
+         SCIPfreeBlockMemoryArray(scip, &consdata->matrixvar, nentries);
+         consdata->nsingle = 0;
+         consdata->propubpossible = TRUE;
+      }
+
+      if ( consdata->storedevs != NULL )
+      {
+         SCIPfreeBlockMemoryArray(scip, &consdata->storedevs, consdata->maxnstoredevs * consdata->blocksize);
+         consdata->maxnstoredevs = 0;
+         consdata->nstoredevs = 0;
+         consdata->storedevspos = 0;
+      }
+
+      updateConsMemory(conss[c]);
+      *nfreedbytes += oldmemory - consdata->memory - consdata->propmemory;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** removes the cuts of an SDP constraint handler from the global cut pool that were not used in the last separation
+ *  rounds (i.e., that have a positive age)
+ */
+SCIP_RETCODE SCIPconshdlrSdpRemoveAgedPoolCuts(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< SDP or SDPrank1 constraint handler */
+   int*                  ndelcuts            /**< pointer to store the number of removed cuts */
+   )
+{
+   SCIP_CUTPOOL* cutpool;
+   SCIP_CUT** cuts;
+   SCIP_ROW** rows;
+   int ncuts;
+   int nrows = 0;
+   int i;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+   assert( ndelcuts != NULL );
+
+   *ndelcuts = 0;
+
+   cutpool = SCIPgetGlobalCutpool(scip);
+   if ( cutpool == NULL )
+      return SCIP_OKAY;
+
+   cuts = SCIPcutpoolGetCuts(cutpool);
+   ncuts = SCIPcutpoolGetNCuts(cutpool);
+   if ( ncuts == 0 )
+      return SCIP_OKAY;
+
+   /* collect the rows first, since deleting cuts changes the cut array of the pool */
+   SCIP_CALL( SCIPallocBufferArray(scip, &rows, ncuts) );
+   for (i = 0; i < ncuts; ++i)
+   {
+      SCIP_ROW* row;
+
+      row = SCIPcutGetRow(cuts[i]);
+      if ( SCIProwGetOriginConshdlr(row) == conshdlr && SCIPcutGetAge(cuts[i]) > 0 )
+         rows[nrows++] = row;
+   }
+
+   for (i = 0; i < nrows; ++i)
+   {
+      SCIP_CALL( SCIPdelPoolCut(scip, rows[i]) );
+   }
+   *ndelcuts = nrows;
+
+   SCIPfreeBufferArray(scip, &rows);
+
+   return SCIP_OKAY;
+}
+
 /** creates an SDP-constraint
  *
  *  The matrices should be lower triangular.
@@ -9998,6 +11481,7 @@ SCIP_RETCODE SCIPcreateConsSdp(
       consdata->vars[i] = vars[i];
       SCIP_CALL( SCIPcaptureVar(scip, consdata->vars[i]) );
    }
+   consdata->sortednonz = consdataNonzSorted(consdata);
    SCIPdebugMsg(scip, "creating cons %s.\n", name);
 
    consdata->rankone = FALSE;
@@ -10007,6 +11491,16 @@ SCIP_RETCODE SCIPcreateConsSdp(
    consdata->maxevsubmat[0] = -1;
    consdata->maxevsubmat[1] = -1;
 
+   /* the store of eigenvectors is created on demand during separation */
+   consdata->storedevs = NULL;
+   consdata->maxnstoredevs = 0;
+   consdata->nstoredevs = 0;
+   consdata->storedevspos = 0;
+
+   /* the memory is counted after creating the constraint */
+   consdata->memory = 0;
+   consdata->propmemory = 0;
+
    /* quadratic 2x2-minor constraints added? */
    consdata->addedquadcons = FALSE;
 
@@ -10015,6 +11509,7 @@ SCIP_RETCODE SCIPcreateConsSdp(
 
    /* compute maximum rhs entry for later use in the DIMACS Error Norm */
    SCIP_CALL( setMaxRhsEntry(*cons) );
+   updateConsMemory(*cons);
 
    return SCIP_OKAY;
 }
@@ -10236,6 +11731,7 @@ SCIP_RETCODE SCIPcreateConsSdpRank1(
       consdata->vars[i] = vars[i];
       SCIP_CALL( SCIPcaptureVar(scip, consdata->vars[i]) );
    }
+   consdata->sortednonz = consdataNonzSorted(consdata);
    SCIPdebugMsg(scip, "creating cons %s (rank 1).\n", name);
    consdata->rankone = TRUE;
 
@@ -10244,6 +11740,16 @@ SCIP_RETCODE SCIPcreateConsSdpRank1(
    consdata->maxevsubmat[0] = -1;
    consdata->maxevsubmat[1] = -1;
 
+   /* the store of eigenvectors is created on demand during separation */
+   consdata->storedevs = NULL;
+   consdata->maxnstoredevs = 0;
+   consdata->nstoredevs = 0;
+   consdata->storedevspos = 0;
+
+   /* the memory is counted after creating the constraint */
+   consdata->memory = 0;
+   consdata->propmemory = 0;
+
    /* quadratic 2x2-minor constraints added? */
    consdata->addedquadcons = FALSE;
 
@@ -10252,6 +11758,7 @@ SCIP_RETCODE SCIPcreateConsSdpRank1(
 
    /* compute maximum rhs entry for later use in the DIMACS Error Norm */
    SCIP_CALL( setMaxRhsEntry(*cons) );
+   updateConsMemory(*cons);
 
    return SCIP_OKAY;
 }
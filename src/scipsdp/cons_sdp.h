@@ -282,6 +282,51 @@ SCIP_Bool SCIPconsSdpAddedQuadCons(
    SCIP_CONS*            cons                /**< the constraint for which it should be checked whether the quadratic 2x2-minor constraints are already added (in the rank1-case) */
    );
 
+/** returns the number of bytes used by the constraints of an SDP constraint handler and the maximal numbers since the
+ *  last call of SCIPconshdlrSdpResetPeakMemory()
+ *
+ *  The memory of the constraint data (matrices, locks, stored eigenvectors) and of the alternative view of the matrix
+ *  entries for propagation (matrixvar, matrixval, matrixconst) is reported separately. Both are updated whenever arrays
+ *  of a constraint are (re)allocated or freed.
+ */
+SCIP_EXPORT
+void SCIPconshdlrSdpGetMemory(
+   SCIP_CONSHDLR*        conshdlr,           /**< SDP or SDPrank1 constraint handler */
+   SCIP_Longint*         consdatamem,        /**< pointer to store the memory of the constraint data */
+   SCIP_Longint*         propmem,            /**< pointer to store the memory of the propagation data */
+   SCIP_Longint*         peakconsdatamem,    /**< pointer to store the maximal memory of the constraint data (or NULL) */
+   SCIP_Longint*         peakpropmem         /**< pointer to store the maximal memory of the propagation data (or NULL) */
+   );
+
+/** resets the maximal memory of the constraints of an SDP constraint handler to the current memory */
+SCIP_EXPORT
+void SCIPconshdlrSdpResetPeakMemory(
+   SCIP_CONSHDLR*        conshdlr            /**< SDP or SDPrank1 constraint handler */
+   );
+
+/** frees the propagation data (matrixvar, matrixval, matrixconst) and the stored eigenvectors of all constraints of an
+ *  SDP constraint handler
+ *
+ *  For the rest of the solving process, propagation of upper bounds and 3x3 minors is skipped and no eigenvectors are
+ *  stored anymore.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconshdlrSdpFreeCaches(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< SDP or SDPrank1 constraint handler */
+   SCIP_Longint*         nfreedbytes         /**< pointer to store the number of freed bytes */
+   );
+
+/** removes the cuts of an SDP constraint handler from the global cut pool that were not used in the last separation
+ *  rounds (i.e., that have a positive age)
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconshdlrSdpRemoveAgedPoolCuts(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< SDP or SDPrank1 constraint handler */
+   int*                  ndelcuts            /**< pointer to store the number of removed cuts */
+   );
+
 #ifdef __cplusplus
 }
 #endif
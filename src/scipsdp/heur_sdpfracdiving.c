@@ -69,6 +69,10 @@
 #define DEFAULT_MAXDIVEUBQUOTNOSOL  0.1 /**< maximal UBQUOT when no solution was found yet (0.0: no limit) */
 #define DEFAULT_MAXDIVEAVGQUOTNOSOL 0.0 /**< maximal AVGQUOT when no solution was found yet (0.0: no limit) */
 #define DEFAULT_BACKTRACK          TRUE /**< use one level of backtracking if infeasibility is encountered? */
+#define DEFAULT_MAXFIXINGS           32 /**< maximal number of variables fixed in one dive step before the SDP is resolved */
+#define DEFAULT_NEARINTEGRAL        0.1 /**< maximal distance to the nearest integer of additional variables fixed in a dive step */
+#define DEFAULT_BACKJUMP           TRUE /**< use the conflict cut of an infeasible SDP to backjump to the responsible fixing? */
+#define DEFAULT_MAXBACKJUMPS         10 /**< maximal number of backjumps in one dive */
 #define DEFAULT_RUNFORLP          FALSE /**< Should the diving heuristic be applied if we are solving LPs? */
 
 
@@ -85,10 +89,273 @@ struct SCIP_HeurData
    SCIP_Real             maxdiveubquotnosol; /**< maximal UBQUOT when no solution was found yet (0.0: no limit) */
    SCIP_Real             maxdiveavgquotnosol;/**< maximal AVGQUOT when no solution was found yet (0.0: no limit) */
    SCIP_Bool             backtrack;          /**< use one level of backtracking if infeasibility is encountered? */
+   int                   maxfixings;         /**< maximal number of variables fixed in one dive step before the SDP is resolved */
+   SCIP_Real             nearintegral;       /**< maximal distance to the nearest integer of additional variables fixed in a dive step */
+   SCIP_Bool             backjump;           /**< use the conflict cut of an infeasible SDP to backjump to the responsible fixing? */
+   int                   maxbackjumps;       /**< maximal number of backjumps in one dive */
    SCIP_Bool             runforlp;           /**< Should the diving heuristic be applied if we are solving LPs? */
    int                   nsuccess;           /**< number of runs that produced at least one feasible solution */
 };
 
+/** bound change applied during a dive */
+struct SDP_DiveFixing
+{
+   SCIP_VAR*             var;                /**< variable whose bound was changed */
+   SCIP_Real             bound;              /**< new bound */
+   SCIP_Bool             lower;              /**< Was the lower bound changed (otherwise the upper bound)? */
+   SCIP_Bool             forced;             /**< Is the bound change the flipped direction of an earlier one (then it is not flipped again)? */
+   int                   depth;              /**< probing depth at which the bound was changed */
+};
+typedef struct SDP_DiveFixing SDP_DIVEFIXING;
+
+
+/*
+ * Local methods
+ */
+
+/** changes a bound in probing and records the bound change */
+static
+SCIP_RETCODE addDiveFixing(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SDP_DIVEFIXING**      fixings,            /**< pointer to array of bound changes of the dive */
+   int*                  fixingssize,        /**< pointer to size of fixings array */
+   int*                  nfixings,           /**< pointer to number of bound changes of the dive */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Real             bound,              /**< new bound */
+   SCIP_Bool             lower,              /**< Should the lower bound be changed (otherwise the upper bound)? */
+   SCIP_Bool             forced              /**< Is the bound change the flipped direction of an earlier one? */
+   )
+{
+   assert( fixings != NULL );
+   assert( fixingssize != NULL );
+   assert( nfixings != NULL );
+   assert( var != NULL );
+
+   if ( lower )
+   {
+      SCIP_CALL( SCIPchgVarLbProbing(scip, var, bound) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPchgVarUbProbing(scip, var, bound) );
+   }
+
+   if ( *nfixings >= *fixingssize )
+   {
+      int newsize = SCIPcalcMemGrowSize(scip, *nfixings + 1);
+
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, fixings, *fixingssize, newsize) );
+      *fixingssize = newsize;
+   }
+   (*fixings)[*nfixings].var = var;
+   (*fixings)[*nfixings].bound = bound;
+   (*fixings)[*nfixings].lower = lower;
+   (*fixings)[*nfixings].forced = forced;
+   (*fixings)[*nfixings].depth = SCIPgetProbingDepth(scip);
+   ++(*nfixings);
+
+   return SCIP_OKAY;
+}
+
+/** finds the first bound change of the dive after which the conflict cut of the last (infeasible) SDP is violated
+ *
+ *  The maximal activity of the cut is computed w.r.t. the bounds at the start of the dive and updated with the bound
+ *  changes of the dive in their order; bound changes found by propagation are ignored. The first bound change that
+ *  makes the maximal activity smaller than the left hand side is responsible for the infeasibility.
+ */
+static
+SCIP_RETCODE findConflictFixing(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RELAX*           relaxsdp,           /**< SDP relaxator */
+   SDP_DIVEFIXING*       fixings,            /**< bound changes of the dive */
+   int                   nfixings,           /**< number of bound changes of the dive */
+   SCIP_Real*            startlb,            /**< lower bounds at the start of the dive, indexed by problem index */
+   SCIP_Real*            startub,            /**< upper bounds at the start of the dive, indexed by problem index */
+   int*                  conflictfixing      /**< pointer to store the index of the responsible bound change or -1 */
+   )
+{
+   SCIP_Real* conflictcut;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Real conflictcutlhs;
+   SCIP_Real maxact = 0.0;
+   SCIP_Bool success;
+   int ninfcontr = 0;
+   int nvars;
+   int idx;
+   int i;
+
+   assert( conflictfixing != NULL );
+
+   *conflictfixing = -1;
+
+   nvars = SCIPgetNVars(scip);
+   SCIP_CALL( SCIPallocBufferArray(scip, &conflictcut, nvars) );
+
+   SCIP_CALL( SCIPrelaxSdpComputeConflictCut(scip, relaxsdp, conflictcut, &conflictcutlhs, &success) );
+   if ( ! success )
+   {
+      SCIPfreeBufferArray(scip, &conflictcut);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &lbs, startlb, nvars) );
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &ubs, startub, nvars) );
+
+   /* compute maximal activity w.r.t. the bounds at the start of the dive */
+   for (i = 0; i < nvars; ++i)
+   {
+      if ( conflictcut[i] > 0.0 )
+      {
+         if ( SCIPisInfinity(scip, ubs[i]) )
+            ++ninfcontr;
+         else
+            maxact += conflictcut[i] * ubs[i];
+      }
+      else if ( conflictcut[i] < 0.0 )
+      {
+         if ( SCIPisInfinity(scip, -lbs[i]) )
+            ++ninfcontr;
+         else
+            maxact += conflictcut[i] * lbs[i];
+      }
+   }
+
+   for (i = 0; i < nfixings; ++i)
+   {
+      idx = SCIPvarGetProbindex(fixings[i].var);
+      assert( 0 <= idx && idx < nvars );
+
+      if ( fixings[i].lower )
+      {
+         if ( fixings[i].bound > lbs[idx] )
+         {
+            if ( conflictcut[idx] < 0.0 )
+            {
+               if ( SCIPisInfinity(scip, -lbs[idx]) )
+               {
+                  --ninfcontr;
+                  maxact += conflictcut[idx] * fixings[i].bound;
+               }
+               else
+                  maxact += conflictcut[idx] * (fixings[i].bound - lbs[idx]);
+            }
+            lbs[idx] = fixings[i].bound;
+         }
+      }
+      else
+      {
+         if ( fixings[i].bound < ubs[idx] )
+         {
+            if ( conflictcut[idx] > 0.0 )
+            {
+               if ( SCIPisInfinity(scip, ubs[idx]) )
+               {
+                  --ninfcontr;
+                  maxact += conflictcut[idx] * fixings[i].bound;
+               }
+               else
+                  maxact += conflictcut[idx] * (fixings[i].bound - ubs[idx]);
+            }
+            ubs[idx] = fixings[i].bound;
+         }
+      }
+
+      if ( ninfcontr == 0 && SCIPisFeasLT(scip, maxact, conflictcutlhs) )
+      {
+         *conflictfixing = i;
+         break;
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+   SCIPfreeBufferArray(scip, &conflictcut);
+
+   return SCIP_OKAY;
+}
+
+/** backjumps to the bound change responsible for the infeasibility of the last SDP and flips it
+ *
+ *  The dive returns to the probing depth of the responsible bound change, reapplies the bound changes of that depth
+ *  before it, and applies the opposite rounding of the responsible bound change. Bound changes that are already flipped
+ *  are not flipped again; in this case, no backjump is performed.
+ */
+static
+SCIP_RETCODE backjumpDive(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RELAX*           relaxsdp,           /**< SDP relaxator */
+   SDP_DIVEFIXING**      fixings,            /**< pointer to array of bound changes of the dive */
+   int*                  fixingssize,        /**< pointer to size of fixings array */
+   int*                  nfixings,           /**< pointer to number of bound changes of the dive */
+   SCIP_Real*            startlb,            /**< lower bounds at the start of the dive, indexed by problem index */
+   SCIP_Real*            startub,            /**< upper bounds at the start of the dive, indexed by problem index */
+   SCIP_Bool*            jumped,             /**< pointer to store whether a backjump was performed */
+   SCIP_Bool*            cutoff              /**< pointer to store whether propagation after the backjump detected a cutoff */
+   )
+{
+   SDP_DIVEFIXING conflict;
+   int conflictfixing;
+   int i;
+
+   assert( fixings != NULL );
+   assert( nfixings != NULL );
+   assert( jumped != NULL );
+   assert( cutoff != NULL );
+
+   *jumped = FALSE;
+
+   SCIP_CALL( findConflictFixing(scip, relaxsdp, *fixings, *nfixings, startlb, startub, &conflictfixing) );
+   if ( conflictfixing < 0 || (*fixings)[conflictfixing].forced )
+      return SCIP_OKAY;
+
+   conflict = (*fixings)[conflictfixing];
+   assert( conflict.depth >= 1 );
+
+   SCIPdebugMsg(scip, "Backjumping from probing depth %d to depth %d to flip bound change of <%s>.\n",
+      SCIPgetProbingDepth(scip), conflict.depth, SCIPvarGetName(conflict.var));
+
+   SCIP_CALL( SCIPbacktrackProbing(scip, conflict.depth - 1) );
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+   *jumped = TRUE;
+
+   /* reapply the bound changes of the same step that came before the responsible one */
+   i = conflictfixing;
+   while ( i > 0 && (*fixings)[i - 1].depth == conflict.depth )
+      --i;
+   *nfixings = i;
+   for (; i < conflictfixing; ++i)
+   {
+      SCIP_CALL( addDiveFixing(scip, fixings, fixingssize, nfixings, (*fixings)[i].var, (*fixings)[i].bound, (*fixings)[i].lower, (*fixings)[i].forced) );
+   }
+   assert( *nfixings == conflictfixing );
+
+   /* apply the opposite rounding, if it leaves a nonempty domain */
+   if ( conflict.lower )
+   {
+      if ( SCIPisFeasLT(scip, conflict.bound - 1.0, SCIPvarGetLbLocal(conflict.var)) )
+      {
+         *cutoff = TRUE;
+         return SCIP_OKAY;
+      }
+      SCIP_CALL( addDiveFixing(scip, fixings, fixingssize, nfixings, conflict.var, conflict.bound - 1.0, FALSE, TRUE) );
+   }
+   else
+   {
+      if ( SCIPisFeasGT(scip, conflict.bound + 1.0, SCIPvarGetUbLocal(conflict.var)) )
+      {
+         *cutoff = TRUE;
+         return SCIP_OKAY;
+      }
+      SCIP_CALL( addDiveFixing(scip, fixings, fixingssize, nfixings, conflict.var, conflict.bound + 1.0, TRUE, TRUE) );
+   }
+
+   SCIP_CALL( SCIPpropagateProbing(scip, 0, cutoff, NULL) );
+
+   return SCIP_OKAY;
+}
+
+
 /*
  * Callback methods
  */
@@ -189,6 +456,8 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
    SCIP_Bool roundup;
    SCIP_Bool backtracked;
    SCIP_Bool backtrack;
+   SCIP_Bool backjumped;
+   SCIP_Bool jumped;
    SCIP_Bool usesdp = TRUE;
    SCIP_Real* sdpcandssol;
    SCIP_Real* sdpcandsfrac;
@@ -203,6 +472,16 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
    SCIP_Real frac;
    SCIP_Real bestfrac;
    SCIP_SOL* relaxsol = NULL;
+   SDP_DIVEFIXING* fixings = NULL;
+   SCIP_Real* startlb;
+   SCIP_Real* startub;
+   SCIP_Real* batchdist;
+   int* batchcands;
+   int fixingssize = 0;
+   int nfixings = 0;
+   int nstepfixings;
+   int nbackjumps = 0;
+   int batchsize = 1;
    int freq = -1;
    int nvars;
    int nsdpcands;
@@ -357,8 +636,21 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
 
    *result = SCIP_DIDNOTFIND;
 
-   /* start diving */
+   /* remember the bounds at the start of the dive for backjumping */
+   SCIP_CALL( SCIPallocBufferArray(scip, &startlb, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &startub, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchdist, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchcands, nvars) );
+   for (v = 0; v < nvars; ++v)
+   {
+      assert( SCIPvarGetProbindex(vars[v]) == v );
+      startlb[v] = SCIPvarGetLbLocal(vars[v]);
+      startub[v] = SCIPvarGetUbLocal(vars[v]);
+   }
+
+   /* start diving; intermediate SDPs of the dive are only solved to low accuracy */
    SCIP_CALL( SCIPstartProbing(scip) );
+   SCIPrelaxSdpSetLowAccuracyProbing(relaxsdp, TRUE);
 
    /* enables collection of variable statistics during probing */
    SCIPenableVarHistory(scip);
@@ -518,58 +810,106 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
       var = sdpcands[bestcand];
 
       backtracked = FALSE;
+      backjumped = FALSE;
+      jumped = FALSE;
       do
       {
          backtrack = FALSE;
+         nstepfixings = 0;
 
-         /* If the variable is already fixed or if the solution value is outside the domain, numerical troubles may have
-          * occured or variable was fixed by propagation while backtracking => abort diving! */
-         if ( SCIPvarGetLbLocal(var) >= SCIPvarGetUbLocal(var) - 0.5 )
+         /* after a backjump, the flipped bound change has already been applied */
+         if ( ! jumped )
          {
-            SCIPdebugMsg(scip, "Selected variable <%s> already fixed to [%g,%g] (solval: %.9f), diving aborted \n",
-               SCIPvarGetName(var), SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var), sdpcandssol[bestcand]);
-            cutoff = TRUE;
-            break;
-         }
+            /* If the variable is already fixed or if the solution value is outside the domain, numerical troubles may have
+             * occured or variable was fixed by propagation while backtracking => abort diving! */
+            if ( SCIPvarGetLbLocal(var) >= SCIPvarGetUbLocal(var) - 0.5 )
+            {
+               SCIPdebugMsg(scip, "Selected variable <%s> already fixed to [%g,%g] (solval: %.9f), diving aborted \n",
+                  SCIPvarGetName(var), SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var), sdpcandssol[bestcand]);
+               cutoff = TRUE;
+               break;
+            }
 
-         if ( SCIPisFeasLT(scip, sdpcandssol[bestcand], SCIPvarGetLbLocal(var)) || SCIPisFeasGT(scip, sdpcandssol[bestcand], SCIPvarGetUbLocal(var)) )
-         {
-            SCIPdebugMsg(scip, "selected variable's <%s> solution value is outside the domain [%g,%g] (solval: %.9f), diving aborted\n",
-               SCIPvarGetName(var), SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var), sdpcandssol[bestcand]);
+            if ( SCIPisFeasLT(scip, sdpcandssol[bestcand], SCIPvarGetLbLocal(var)) || SCIPisFeasGT(scip, sdpcandssol[bestcand], SCIPvarGetUbLocal(var)) )
+            {
+               SCIPdebugMsg(scip, "selected variable's <%s> solution value is outside the domain [%g,%g] (solval: %.9f), diving aborted\n",
+                  SCIPvarGetName(var), SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var), sdpcandssol[bestcand]);
 #if 0
-            assert( backtracked ); /* this may happen if we didn't resolve after propagation, in that case we will also abort (or resolve now and start again?) */
+               assert( backtracked ); /* this may happen if we didn't resolve after propagation, in that case we will also abort (or resolve now and start again?) */
 #endif
-            break;
-         }
+               break;
+            }
 
-         /* apply rounding of best candidate */
-         if ( bestcandroundup != backtracked )
-         {
-            /* round variable up */
+            /* apply rounding of best candidate */
+            if ( bestcandroundup != backtracked )
+            {
+               /* round variable up */
 #ifdef SCIP_MORE_DEBUG
-            SCIPdebugMsg(scip, "  dive %d/%d: var <%s>, round=%u/%u, sol=%g, oldbounds=[%g,%g], newbounds=[%g,%g]\n",
-               divedepth, maxdivedepth, SCIPvarGetName(var), bestcandmayrounddown, bestcandmayroundup,
-               sdpcandssol[bestcand], SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var),
-               SCIPfeasCeil(scip, sdpcandssol[bestcand]), SCIPvarGetUbLocal(var));
+               SCIPdebugMsg(scip, "  dive %d/%d: var <%s>, round=%u/%u, sol=%g, oldbounds=[%g,%g], newbounds=[%g,%g]\n",
+                  divedepth, maxdivedepth, SCIPvarGetName(var), bestcandmayrounddown, bestcandmayroundup,
+                  sdpcandssol[bestcand], SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var),
+                  SCIPfeasCeil(scip, sdpcandssol[bestcand]), SCIPvarGetUbLocal(var));
 #endif
-            SCIP_CALL( SCIPchgVarLbProbing(scip, var, SCIPfeasCeil(scip, sdpcandssol[bestcand])) );
-            roundup = TRUE;
-         }
-         else
-         {
-            /* round variable down */
+               SCIP_CALL( addDiveFixing(scip, &fixings, &fixingssize, &nfixings, var, SCIPfeasCeil(scip, sdpcandssol[bestcand]), TRUE, backtracked) );
+               roundup = TRUE;
+            }
+            else
+            {
+               /* round variable down */
 #ifdef SCIP_MORE_DEBUG
-            SCIPdebugMsg(scip, "  dive %d/%d: var <%s>, round=%u/%u, sol=%g, oldbounds=[%g,%g], newbounds=[%g,%g]\n",
-               divedepth, maxdivedepth, SCIPvarGetName(var), bestcandmayrounddown, bestcandmayroundup,
-               sdpcandssol[bestcand], SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var),
-               SCIPvarGetLbLocal(var), SCIPfeasFloor(scip, sdpcandssol[bestcand]));
+               SCIPdebugMsg(scip, "  dive %d/%d: var <%s>, round=%u/%u, sol=%g, oldbounds=[%g,%g], newbounds=[%g,%g]\n",
+                  divedepth, maxdivedepth, SCIPvarGetName(var), bestcandmayrounddown, bestcandmayroundup,
+                  sdpcandssol[bestcand], SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var),
+                  SCIPvarGetLbLocal(var), SCIPfeasFloor(scip, sdpcandssol[bestcand]));
 #endif
-            SCIP_CALL( SCIPchgVarUbProbing(scip, var, SCIPfeasFloor(scip, sdpcandssol[bestcand])) );
-            roundup = FALSE;
+               SCIP_CALL( addDiveFixing(scip, &fixings, &fixingssize, &nfixings, var, SCIPfeasFloor(scip, sdpcandssol[bestcand]), FALSE, backtracked) );
+               roundup = FALSE;
+            }
+            ++nstepfixings;
+
+            /* apply domain propagation */
+            SCIP_CALL( SCIPpropagateProbing(scip, 0, &cutoff, NULL) );
+
+            /* fix further nearly integral candidates to their nearest integer, propagating after each fixing */
+            if ( ! cutoff && ! backtracked && batchsize > 1 )
+            {
+               int nbatchcands = 0;
+               int k;
+
+               for (c = 0; c < nsdpcands; ++c)
+               {
+                  frac = MIN(sdpcandsfrac[c], 1.0 - sdpcandsfrac[c]);
+                  if ( c != bestcand && frac <= heurdata->nearintegral )
+                  {
+                     batchdist[nbatchcands] = frac;
+                     batchcands[nbatchcands++] = c;
+                  }
+               }
+               SCIPsortRealInt(batchdist, batchcands, nbatchcands);
+
+               for (k = 0; k < nbatchcands && nstepfixings < batchsize && ! cutoff; ++k)
+               {
+                  SCIP_Real newbound;
+                  SCIP_Bool lower;
+
+                  c = batchcands[k];
+                  lower = sdpcandsfrac[c] > 0.5;
+                  newbound = lower ? SCIPfeasCeil(scip, sdpcandssol[c]) : SCIPfeasFloor(scip, sdpcandssol[c]);
+
+                  /* skip candidates whose domain was already changed by propagation */
+                  if ( SCIPisFeasLT(scip, newbound, SCIPvarGetLbLocal(sdpcands[c])) || SCIPisFeasGT(scip, newbound, SCIPvarGetUbLocal(sdpcands[c]))
+                     || SCIPvarGetLbLocal(sdpcands[c]) >= SCIPvarGetUbLocal(sdpcands[c]) - 0.5 )
+                     continue;
+
+                  SCIP_CALL( addDiveFixing(scip, &fixings, &fixingssize, &nfixings, sdpcands[c], newbound, lower, FALSE) );
+                  ++nstepfixings;
+
+                  SCIP_CALL( SCIPpropagateProbing(scip, 0, &cutoff, NULL) );
+               }
+            }
          }
+         jumped = FALSE;
 
-         /* apply domain propagation */
-         SCIP_CALL( SCIPpropagateProbing(scip, 0, &cutoff, NULL) );
          if ( ! cutoff )
          {
             /* resolve the diving SDP */
@@ -580,11 +920,17 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
             {
                SCIPdebugMsg(scip, "SDP fracdiving heuristic aborted, as we could not solve one of the diving SDPs.\n");
 
+               SCIPfreeBlockMemoryArrayNull(scip, &fixings, fixingssize);
+               SCIPfreeBufferArray(scip, &batchcands);
+               SCIPfreeBufferArray(scip, &batchdist);
+               SCIPfreeBufferArray(scip, &startub);
+               SCIPfreeBufferArray(scip, &startlb);
                SCIPfreeBufferArray(scip, &sdpcandsfrac);
                SCIPfreeBufferArray(scip, &sdpcandssol);
                SCIPfreeBufferArray(scip, &sdpcands);
 
                *result = SCIP_DIDNOTRUN;
+               SCIPrelaxSdpSetLowAccuracyProbing(relaxsdp, FALSE);
                SCIP_CALL( SCIPendProbing(scip) );
 
                /* reset frequency of relaxator */
@@ -599,14 +945,29 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
             cutoff = ! SCIPrelaxSdpIsFeasible(relaxsdp);
          }
 
-         /* perform backtracking if a cutoff was detected */
-         if ( cutoff && ! backtracked && heurdata->backtrack )
+         /* first try to backjump to the bound change responsible for the infeasibility */
+         if ( cutoff && heurdata->backjump && nbackjumps < heurdata->maxbackjumps )
+         {
+            SCIP_CALL( backjumpDive(scip, relaxsdp, &fixings, &fixingssize, &nfixings, startlb, startub, &jumped, &cutoff) );
+            if ( jumped )
+            {
+               ++nbackjumps;
+               backjumped = TRUE;
+               backtrack = TRUE;
+               continue;
+            }
+         }
+
+         /* otherwise perform backtracking if a cutoff was detected */
+         if ( cutoff && ! backtracked && ! backjumped && heurdata->backtrack )
          {
 #ifdef SCIP_MORE_DEBUG
             SCIPdebugMsg(scip, "  *** cutoff detected at level %d - backtracking\n", SCIPgetProbingDepth(scip));
 #endif
             SCIP_CALL( SCIPbacktrackProbing(scip, SCIPgetProbingDepth(scip)-1) );
             SCIP_CALL( SCIPnewProbingNode(scip) );
+            while ( nfixings > 0 && fixings[nfixings - 1].depth >= SCIPgetProbingDepth(scip) )
+               --nfixings;
             backtracked = TRUE;
             backtrack = TRUE;
          }
@@ -615,14 +976,20 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
       }
       while ( backtrack );
 
+      /* fix more variables in the next step if this step did not run into infeasibility */
+      if ( backtracked || backjumped )
+         batchsize = 1;
+      else
+         batchsize = MIN(2 * batchsize, heurdata->maxfixings);
+
       if ( ! cutoff )
       {
          /* get new objective value */
          oldobjval = objval;
          objval = SCIPgetRelaxSolObj(scip);
 
-         /* update pseudo cost values */
-         if ( SCIPisGT(scip, objval, oldobjval) )
+         /* update pseudo cost values (only if the objective change is caused by a single bound change) */
+         if ( nstepfixings == 1 && ! backjumped && SCIPisGT(scip, objval, oldobjval) )
          {
             if( roundup )
             {
@@ -659,6 +1026,28 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
 #endif
    }
 
+   SCIPrelaxSdpSetLowAccuracyProbing(relaxsdp, FALSE);
+
+   /* the last SDP of the dive has only been solved to low accuracy, so resolve it to full accuracy before creating a solution */
+   if ( nsdpcands == 0 && ! cutoff )
+   {
+      SCIP_CALL( SCIPsolveProbingRelax(scip, &cutoff) );
+
+      if ( ! cutoff && SCIPrelaxSdpSolvedProbing(relaxsdp) && SCIPrelaxSdpIsFeasible(relaxsdp) )
+      {
+         for (v = 0; v < nvars; ++v)
+         {
+            if ( SCIPvarIsIntegral(vars[v]) && ! SCIPisFeasIntegral(scip, SCIPgetRelaxSolVal(scip, vars[v])) )
+            {
+               ++nsdpcands;
+               break;
+            }
+         }
+      }
+      else
+         cutoff = TRUE;
+   }
+
    /* check if a solution has been found */
    if ( nsdpcands == 0 && ! cutoff )
    {
@@ -696,6 +1085,11 @@ SCIP_DECL_HEUREXEC(heurExecSdpFracdiving)
 
    SCIPdebugMsg(scip, "SDP fracdiving heuristic finished\n");
 
+   SCIPfreeBlockMemoryArrayNull(scip, &fixings, fixingssize);
+   SCIPfreeBufferArray(scip, &batchcands);
+   SCIPfreeBufferArray(scip, &batchdist);
+   SCIPfreeBufferArray(scip, &startub);
+   SCIPfreeBufferArray(scip, &startlb);
    SCIPfreeBufferArray(scip, &sdpcandsfrac);
    SCIPfreeBufferArray(scip, &sdpcandssol);
    SCIPfreeBufferArray(scip, &sdpcands);
@@ -768,6 +1162,26 @@ SCIP_RETCODE SCIPincludeHeurSdpFracdiving(
          "use one level of backtracking if infeasibility is encountered?",
          &heurdata->backtrack, FALSE, DEFAULT_BACKTRACK, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "heuristics/" HEUR_NAME "/maxfixings",
+         "maximal number of variables fixed in one dive step before the SDP is resolved (1: one variable per step)",
+         &heurdata->maxfixings, FALSE, DEFAULT_MAXFIXINGS, 1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip,
+         "heuristics/" HEUR_NAME "/nearintegral",
+         "maximal distance to the nearest integer of additional variables fixed in a dive step",
+         &heurdata->nearintegral, FALSE, DEFAULT_NEARINTEGRAL, 0.0, 0.5, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "heuristics/" HEUR_NAME "/backjump",
+         "use the conflict cut of an infeasible SDP to backjump to the responsible fixing?",
+         &heurdata->backjump, FALSE, DEFAULT_BACKJUMP, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "heuristics/" HEUR_NAME "/maxbackjumps",
+         "maximal number of backjumps in one dive",
+         &heurdata->maxbackjumps, FALSE, DEFAULT_MAXBACKJUMPS, 0, INT_MAX, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "heuristics/" HEUR_NAME "/runforlp",
          "Should the diving heuristic be applied if we are solving LPs?",
@@ -0,0 +1,753 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_sdphyperplane.c
+ * @brief  randomized hyperplane rounding heuristic for SDPs with max-cut structure
+ * @author SCIP-SDP developers
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+/* #define SCIP_DEBUG */
+
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+
+#include "heur_sdphyperplane.h"
+#include "cons_sdp.h"
+#include "sdpi/lapack_interface.h"
+
+/* turn off lint warnings for whole file: */
+/*lint --e{788,818}*/
+
+#ifndef M_PI
+#define M_PI 3.141592653589793238462643
+#endif
+
+#define HEUR_NAME             "sdphyperplane"
+#define HEUR_DESC             "randomized hyperplane rounding heuristic for SDPs with max-cut structure"
+#define HEUR_DISPCHAR         '/'
+#define HEUR_PRIORITY         -1001500
+#define HEUR_FREQ             10
+#define HEUR_FREQOFS          0
+#define HEUR_MAXDEPTH         -1
+#define HEUR_TIMING           SCIP_HEURTIMING_AFTERNODE
+#define HEUR_USESSUBSCIP      FALSE  /* does the heuristic use a secondary SCIP instance? */
+
+
+/*
+ * Default parameter settings
+ */
+
+#define DEFAULT_RANDSEED                 97  /**< default random seed */
+#define DEFAULT_NROUNDINGS               64  /**< number of random hyperplanes generated in each call */
+#define DEFAULT_MAXRANK                  -1  /**< maximal rank of the factorization of the SDP matrix (-1: no limit) */
+#define DEFAULT_MAXBLOCKSIZE            300  /**< maximal size of an SDP block to which the heuristic is applied */
+#define DEFAULT_LOCALSEARCH            TRUE  /**< Should the best rounding be improved by 1-opt local search? */
+
+/* locally defined heuristic data */
+struct SCIP_HeurData
+{
+   SCIP_SOL*             sol;                /**< working solution */
+   SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
+   int                   nroundings;         /**< number of random hyperplanes generated in each call */
+   int                   maxrank;            /**< maximal rank of the factorization of the SDP matrix (-1: no limit) */
+   int                   maxblocksize;       /**< maximal size of an SDP block to which the heuristic is applied */
+   SCIP_Bool             localsearch;        /**< Should the best rounding be improved by 1-opt local search? */
+};
+
+/** max-cut structure of an SDP block
+ *
+ *  The block has max-cut structure if each diagonal entry is a positive constant \f$d_i\f$ and each variable appears in
+ *  exactly one off-diagonal entry \f$(r,c)\f$ without other variables, such that the entry takes the values
+ *  \f$\pm\sqrt{d_r d_c}\f$ at feasible values of the variable. Since these values are nonzero, every off-diagonal
+ *  entry has to contain a variable, otherwise no rank one matrix fits the block. A sign vector \f$s\f$ then defines the rank one matrix
+ *  with entries \f$s_r s_c \sqrt{d_r d_c}\f$, i.e., a value for each variable.
+ */
+struct SDP_CutStructure
+{
+   int                   blocksize;          /**< size of the SDP block */
+   int                   nvars;              /**< number of variables in the block */
+   SCIP_VAR**            vars;               /**< variables in the block */
+   int*                  rows;               /**< row of the entry of each variable */
+   int*                  cols;               /**< column of the entry of each variable */
+   SCIP_Real*            valsame;            /**< value of each variable if the signs of row and column agree */
+   SCIP_Real*            valdiff;            /**< value of each variable if the signs of row and column differ */
+   SCIP_Real*            matrix;             /**< SDP matrix at the relaxation solution (blocksize * blocksize) */
+};
+typedef struct SDP_CutStructure SDP_CUTSTRUCTURE;
+
+
+/*
+ * Local methods
+ */
+
+/** checks whether an SDP constraint has max-cut structure and, if so, fills the structure and the SDP matrix at the relaxation solution */
+static
+SCIP_RETCODE getCutStructure(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< SDP constraint */
+   SDP_CUTSTRUCTURE*     cutstruct,          /**< structure to fill; arrays are allocated if the constraint has max-cut structure */
+   SCIP_Bool*            success             /**< pointer to store whether the constraint has max-cut structure */
+   )
+{
+   SCIP_VAR** consvars;
+   SCIP_Real** val;
+   SCIP_Real* constval;
+   SCIP_Real* diag;
+   int** col;
+   int** row;
+   int* nvarnonz;
+   int* constcol;
+   int* constrow;
+   int* posvar;
+   SCIP_Real diagprod;
+   SCIP_Real coef;
+   SCIP_Real offset;
+   int constnnonz;
+   int arraylength;
+   int blocksize;
+   int nconsvars;
+   int nnonz;
+   int r;
+   int c;
+   int i;
+   int v;
+
+   assert( cutstruct != NULL );
+   assert( success != NULL );
+
+   *success = FALSE;
+
+   nconsvars = SCIPconsSdpGetNVars(scip, cons);
+   blocksize = SCIPconsSdpGetBlocksize(scip, cons);
+   /* each off-diagonal entry of the lower triangle has to contain exactly one variable */
+   if ( blocksize < 2 || nconsvars != blocksize * (blocksize - 1) / 2 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPconsSdpGetNNonz(scip, cons, NULL, &constnnonz) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvars, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nvarnonz, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &col, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &row, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &val, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &constcol, MAX(constnnonz, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &constrow, MAX(constnnonz, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &constval, MAX(constnnonz, 1)) );
+
+   arraylength = nconsvars;
+   SCIP_CALL( SCIPconsSdpGetData(scip, cons, &nconsvars, &nnonz, &blocksize, &arraylength, nvarnonz, col, row, val, consvars,
+         &constnnonz, constcol, constrow, constval, NULL, NULL, NULL) );
+   assert( arraylength == nconsvars );
+
+   /* the SDP matrix is sum_j A_j y_j - A_0, so its constant part is -A_0 */
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutstruct->matrix, blocksize * blocksize) );
+   BMSclearMemoryArray(cutstruct->matrix, blocksize * blocksize);
+   for (i = 0; i < constnnonz; ++i)
+   {
+      cutstruct->matrix[constrow[i] * blocksize + constcol[i]] = -constval[i];
+      cutstruct->matrix[constcol[i] * blocksize + constrow[i]] = -constval[i];
+   }
+
+   /* all diagonal entries have to be positive constants */
+   SCIP_CALL( SCIPallocBufferArray(scip, &diag, blocksize) );
+   for (i = 0; i < blocksize; ++i)
+   {
+      diag[i] = cutstruct->matrix[i * blocksize + i];
+      if ( ! SCIPisPositive(scip, diag[i]) )
+         goto TERMINATE;
+   }
+
+   /* each variable has to appear in exactly one off-diagonal entry, each entry contains at most one variable; since
+    * there are as many variables as entries, every entry is covered if the loop below finishes */
+   SCIP_CALL( SCIPallocBufferArray(scip, &posvar, blocksize * (blocksize - 1) / 2) );
+   for (i = 0; i < blocksize * (blocksize - 1) / 2; ++i)
+      posvar[i] = -1;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutstruct->vars, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutstruct->rows, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutstruct->cols, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutstruct->valsame, nconsvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutstruct->valdiff, nconsvars) );
+
+   for (v = 0; v < nconsvars; ++v)
+   {
+      if ( nvarnonz[v] != 1 || row[v][0] == col[v][0] || SCIPisZero(scip, val[v][0]) )
+         break;
+
+      r = MAX(row[v][0], col[v][0]);
+      c = MIN(row[v][0], col[v][0]);
+      if ( posvar[r * (r - 1) / 2 + c] >= 0 )
+         break;
+      posvar[r * (r - 1) / 2 + c] = v;
+
+      /* entry (r,c) is coef * y + offset and has to be +/- sqrt(d_r d_c) */
+      coef = val[v][0];
+      offset = cutstruct->matrix[r * blocksize + c];
+      diagprod = sqrt(diag[r] * diag[c]);
+
+      cutstruct->vars[v] = consvars[v];
+      cutstruct->rows[v] = r;
+      cutstruct->cols[v] = c;
+      cutstruct->valsame[v] = (diagprod - offset) / coef;
+      cutstruct->valdiff[v] = (-diagprod - offset) / coef;
+
+      if ( SCIPisFeasLT(scip, MIN(cutstruct->valsame[v], cutstruct->valdiff[v]), SCIPvarGetLbLocal(consvars[v]))
+         || SCIPisFeasGT(scip, MAX(cutstruct->valsame[v], cutstruct->valdiff[v]), SCIPvarGetUbLocal(consvars[v])) )
+         break;
+
+      if ( SCIPvarIsIntegral(consvars[v]) )
+      {
+         if ( ! SCIPisFeasIntegral(scip, cutstruct->valsame[v]) || ! SCIPisFeasIntegral(scip, cutstruct->valdiff[v]) )
+            break;
+         cutstruct->valsame[v] = SCIPfeasRound(scip, cutstruct->valsame[v]);
+         cutstruct->valdiff[v] = SCIPfeasRound(scip, cutstruct->valdiff[v]);
+      }
+
+      /* add the variable to the SDP matrix at the relaxation solution */
+      cutstruct->matrix[r * blocksize + c] += coef * SCIPgetRelaxSolVal(scip, consvars[v]);
+      cutstruct->matrix[c * blocksize + r] = cutstruct->matrix[r * blocksize + c];
+   }
+
+   if ( v == nconsvars )
+   {
+      cutstruct->blocksize = blocksize;
+      cutstruct->nvars = nconsvars;
+      *success = TRUE;
+   }
+   else
+   {
+      SCIPfreeBufferArray(scip, &cutstruct->valdiff);
+      SCIPfreeBufferArray(scip, &cutstruct->valsame);
+      SCIPfreeBufferArray(scip, &cutstruct->cols);
+      SCIPfreeBufferArray(scip, &cutstruct->rows);
+      SCIPfreeBufferArray(scip, &cutstruct->vars);
+   }
+
+   SCIPfreeBufferArray(scip, &posvar);
+
+ TERMINATE:
+   SCIPfreeBufferArray(scip, &diag);
+   if ( ! *success )
+   {
+      SCIPfreeBufferArray(scip, &cutstruct->matrix);
+   }
+   SCIPfreeBufferArray(scip, &constval);
+   SCIPfreeBufferArray(scip, &constrow);
+   SCIPfreeBufferArray(scip, &constcol);
+   SCIPfreeBufferArray(scip, &val);
+   SCIPfreeBufferArray(scip, &row);
+   SCIPfreeBufferArray(scip, &col);
+   SCIPfreeBufferArray(scip, &nvarnonz);
+   SCIPfreeBufferArray(scip, &consvars);
+
+   return SCIP_OKAY;
+}
+
+/** computes the objective contribution of the variables of the block for a sign vector */
+static
+SCIP_Real getCutObj(
+   SDP_CUTSTRUCTURE*     cutstruct,          /**< max-cut structure of the block */
+   SCIP_Real*            signs               /**< sign vector (only the signs of the entries are used) */
+   )
+{
+   SCIP_Real obj = 0.0;
+   int v;
+
+   assert( cutstruct != NULL );
+   assert( signs != NULL );
+
+   for (v = 0; v < cutstruct->nvars; ++v)
+   {
+      if ( (signs[cutstruct->rows[v]] >= 0.0) == (signs[cutstruct->cols[v]] >= 0.0) )
+         obj += SCIPvarGetObj(cutstruct->vars[v]) * cutstruct->valsame[v];
+      else
+         obj += SCIPvarGetObj(cutstruct->vars[v]) * cutstruct->valdiff[v];
+   }
+
+   return obj;
+}
+
+/** improves a sign vector by flipping single signs as long as this decreases the objective */
+static
+SCIP_RETCODE improveCut(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SDP_CUTSTRUCTURE*     cutstruct,          /**< max-cut structure of the block */
+   SCIP_Real*            signs,              /**< sign vector to improve */
+   int*                  nflips              /**< pointer to store the number of flips */
+   )
+{
+   SCIP_Real* gain;
+   SCIP_Bool improved = TRUE;
+   SCIP_Real diff;
+   int* adjbeg;
+   int* adjvars;
+   int blocksize;
+   int r;
+   int c;
+   int i;
+   int k;
+   int v;
+
+   assert( cutstruct != NULL );
+   assert( signs != NULL );
+   assert( nflips != NULL );
+
+   blocksize = cutstruct->blocksize;
+   *nflips = 0;
+
+   /* collect the variables of each row of the block */
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &adjbeg, blocksize + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &adjvars, 2 * cutstruct->nvars) );
+   for (v = 0; v < cutstruct->nvars; ++v)
+   {
+      ++adjbeg[cutstruct->rows[v] + 1];
+      ++adjbeg[cutstruct->cols[v] + 1];
+   }
+   for (i = 0; i < blocksize; ++i)
+      adjbeg[i + 1] += adjbeg[i];
+   for (v = 0; v < cutstruct->nvars; ++v)
+   {
+      adjvars[adjbeg[cutstruct->rows[v]]++] = v;
+      adjvars[adjbeg[cutstruct->cols[v]]++] = v;
+   }
+   for (i = blocksize; i > 0; --i)
+      adjbeg[i] = adjbeg[i - 1];
+   adjbeg[0] = 0;
+
+   /* gain[i] is the change of the objective if sign i is flipped */
+   SCIP_CALL( SCIPallocBufferArray(scip, &gain, blocksize) );
+   for (i = 0; i < blocksize; ++i)
+   {
+      gain[i] = 0.0;
+      for (k = adjbeg[i]; k < adjbeg[i + 1]; ++k)
+      {
+         v = adjvars[k];
+         diff = SCIPvarGetObj(cutstruct->vars[v]) * (cutstruct->valdiff[v] - cutstruct->valsame[v]);
+         if ( (signs[cutstruct->rows[v]] >= 0.0) == (signs[cutstruct->cols[v]] >= 0.0) )
+            gain[i] += diff;
+         else
+            gain[i] -= diff;
+      }
+   }
+
+   while ( improved )
+   {
+      improved = FALSE;
+      for (i = 0; i < blocksize; ++i)
+      {
+         if ( ! SCIPisNegative(scip, gain[i]) )
+            continue;
+
+         /* flip sign i and update the gains of the neighbors */
+         signs[i] = signs[i] >= 0.0 ? -1.0 : 1.0;
+         gain[i] = -gain[i];
+         for (k = adjbeg[i]; k < adjbeg[i + 1]; ++k)
+         {
+            v = adjvars[k];
+            r = cutstruct->rows[v];
+            c = cutstruct->cols[v];
+            diff = SCIPvarGetObj(cutstruct->vars[v]) * (cutstruct->valdiff[v] - cutstruct->valsame[v]);
+
+            /* the entry of v changed from differ to agree or vice versa, which changes the gain of the other row twice */
+            if ( (signs[r] >= 0.0) == (signs[c] >= 0.0) )
+               gain[r == i ? c : r] += 2.0 * diff;
+            else
+               gain[r == i ? c : r] -= 2.0 * diff;
+         }
+         ++(*nflips);
+         improved = TRUE;
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &gain);
+   SCIPfreeBufferArray(scip, &adjvars);
+   SCIPfreeBufferArray(scip, &adjbeg);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods
+ */
+
+/** copy method for primal heuristic plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_HEURCOPY(heurCopySdphyperplane)
+{  /*lint --e{715}*/
+   assert( scip != NULL );
+   assert( heur != NULL );
+   assert( strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0 );
+
+   /* call inclusion method of primal heuristic */
+   SCIP_CALL( SCIPincludeHeurSdpHyperplane(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of primal heuristic to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_HEURFREE(heurFreeSdphyperplane)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert( heur != NULL );
+   assert( strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0 );
+   assert( scip != NULL );
+
+   /* free heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   SCIPfreeBlockMemory(scip, &heurdata);
+   SCIPheurSetData(heur, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** initialization method of primal heuristic (called after problem was transformed) */
+static
+SCIP_DECL_HEURINIT(heurInitSdphyperplane)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert( heur != NULL );
+   assert( strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0 );
+
+   /* get heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+
+   /* create working solution and random number generator */
+   SCIP_CALL( SCIPcreateSol(scip, &heurdata->sol, heur) );
+   SCIP_CALL( SCIPcreateRandom(scip, &(heurdata->randnumgen), SCIPinitializeRandomSeed(scip, DEFAULT_RANDSEED), TRUE) );
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method of primal heuristic (called before transformed problem is freed) */
+static
+SCIP_DECL_HEUREXIT(heurExitSdphyperplane)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert( heur != NULL );
+   assert( strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0 );
+
+   /* get heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+
+   /* free working solution and random number generator */
+   SCIP_CALL( SCIPfreeSol(scip, &heurdata->sol) );
+   SCIPfreeRandom(scip, &(heurdata->randnumgen));
+
+   return SCIP_OKAY;
+}
+
+/** execution method of primal heuristic */
+static
+SCIP_DECL_HEUREXEC(heurExecSdphyperplane)
+{  /*lint --e{715}*/
+   SDP_CUTSTRUCTURE cutstruct;
+   SCIP_HEURDATA* heurdata;
+   SCIP_CONSHDLR* conshdlrs[2];
+   SCIP_CONS* bestcons = NULL;
+   SCIP_VAR** vars;
+   SCIP_Real* eigenvalues;
+   SCIP_Real* eigenvectors;
+   SCIP_Real* factor;
+   SCIP_Real* hyperplanes;
+   SCIP_Real* signs;
+   SCIP_Real bestobj;
+   SCIP_Real obj;
+   SCIP_Real u1;
+   SCIP_Real u2;
+   SCIP_Bool success;
+   void** cands;
+   int* candsizes;
+   int ncands;
+   int bestrounding = -1;
+   int nroundings;
+   int blocksize;
+   int rank;
+   int nflips = 0;
+   int nvars;
+   int h;
+   int i;
+   int k;
+   int v;
+
+   assert( heur != NULL );
+   assert( strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0 );
+   assert( scip != NULL );
+   assert( result != NULL );
+
+   *result = SCIP_DELAYED;
+
+   /* do not call heuristic if node was already detected to be infeasible */
+   if ( nodeinfeasible )
+      return SCIP_OKAY;
+
+   *result = SCIP_DIDNOTRUN;
+
+   /* the heuristic needs the SDP relaxation solution */
+   if ( ! SCIPisRelaxSolValid(scip) )
+      return SCIP_OKAY;
+
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+
+   conshdlrs[0] = SCIPfindConshdlr(scip, "SDP");
+   conshdlrs[1] = SCIPfindConshdlr(scip, "SDPrank1");
+
+   /* collect SDP constraints of admissible size */
+   ncands = 0;
+   for (h = 0; h < 2; ++h)
+   {
+      if ( conshdlrs[h] != NULL )
+         ncands += SCIPconshdlrGetNConss(conshdlrs[h]);
+   }
+   if ( ncands == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &cands, ncands) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candsizes, ncands) );
+   ncands = 0;
+   for (h = 0; h < 2; ++h)
+   {
+      SCIP_CONS** conss;
+      int nconss;
+      int c;
+
+      if ( conshdlrs[h] == NULL )
+         continue;
+
+      conss = SCIPconshdlrGetConss(conshdlrs[h]);
+      nconss = SCIPconshdlrGetNConss(conshdlrs[h]);
+      for (c = 0; c < nconss; ++c)
+      {
+         blocksize = SCIPconsSdpGetBlocksize(scip, conss[c]);
+         if ( blocksize >= 2 && blocksize <= heurdata->maxblocksize )
+         {
+            cands[ncands] = (void*) conss[c];
+            candsizes[ncands++] = blocksize;
+         }
+      }
+   }
+
+   /* use the largest SDP block with max-cut structure */
+   SCIPsortDownIntPtr(candsizes, cands, ncands);
+   for (i = 0; i < ncands && bestcons == NULL; ++i)
+   {
+      SCIP_CALL( getCutStructure(scip, (SCIP_CONS*) cands[i], &cutstruct, &success) );
+      if ( success )
+         bestcons = (SCIP_CONS*) cands[i];
+   }
+
+   SCIPfreeBufferArray(scip, &candsizes);
+   SCIPfreeBufferArray(scip, &cands);
+
+   if ( bestcons == NULL )
+      return SCIP_OKAY;
+   blocksize = cutstruct.blocksize;
+
+   *result = SCIP_DIDNOTFIND;
+
+   SCIPdebugMsg(scip, "Node %" SCIP_LONGINT_FORMAT ": executing SDP hyperplane rounding heuristic on block <%s> of size %d.\n",
+      SCIPgetNNodes(scip), SCIPconsGetName(bestcons), blocksize);
+
+   /* factor the SDP matrix at the relaxation solution: row i of the factor is the vector of node i */
+   SCIP_CALL( SCIPallocBufferArray(scip, &eigenvalues, blocksize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &eigenvectors, blocksize * blocksize) );
+   SCIP_CALL( SCIPlapackComputeEigenvectorDecomposition(SCIPbuffer(scip), blocksize, cutstruct.matrix, eigenvalues, eigenvectors) );
+
+   /* use the eigenvectors of the largest positive eigenvalues (eigenvalues are sorted ascending) */
+   rank = 0;
+   while ( rank < blocksize && SCIPisPositive(scip, eigenvalues[blocksize - 1 - rank]) && (heurdata->maxrank < 0 || rank < heurdata->maxrank) )
+      ++rank;
+
+   if ( rank > 0 )
+   {
+      nroundings = heurdata->nroundings;
+
+      /* the factor is stored column-wise; column k is the k-th eigenvector scaled by the root of its eigenvalue */
+      SCIP_CALL( SCIPallocBufferArray(scip, &factor, blocksize * rank) );
+      for (k = 0; k < rank; ++k)
+      {
+         SCIP_Real scale;
+
+         scale = sqrt(eigenvalues[blocksize - 1 - k]);
+         for (i = 0; i < blocksize; ++i)
+            factor[k * blocksize + i] = scale * eigenvectors[(blocksize - 1 - k) * blocksize + i];
+      }
+
+      /* normal vectors of the random hyperplanes with Gaussian entries (Box-Muller) */
+      SCIP_CALL( SCIPallocBufferArray(scip, &hyperplanes, rank * nroundings) );
+      for (i = 0; i < rank * nroundings; i += 2)
+      {
+         u1 = SCIPrandomGetReal(heurdata->randnumgen, 1e-12, 1.0);
+         u2 = SCIPrandomGetReal(heurdata->randnumgen, 0.0, 2.0 * M_PI);
+         hyperplanes[i] = sqrt(-2.0 * log(u1)) * cos(u2);
+         if ( i + 1 < rank * nroundings )
+            hyperplanes[i + 1] = sqrt(-2.0 * log(u1)) * sin(u2);
+      }
+
+      /* compute all roundings at once: column h of signs contains the products of the node vectors with hyperplane h */
+      SCIP_CALL( SCIPallocBufferArray(scip, &signs, blocksize * nroundings) );
+      SCIP_CALL( SCIPlapackMatrixMatrixMult(blocksize, rank, factor, FALSE, rank, nroundings, hyperplanes, FALSE, signs) );
+
+      /* evaluate the roundings */
+      bestobj = SCIP_REAL_MAX;
+      for (h = 0; h < nroundings; ++h)
+      {
+         obj = getCutObj(&cutstruct, &signs[h * blocksize]);
+         if ( obj < bestobj )
+         {
+            bestobj = obj;
+            bestrounding = h;
+         }
+      }
+      assert( bestrounding >= 0 );
+
+      /* improve the best rounding */
+      if ( heurdata->localsearch )
+      {
+         SCIP_CALL( improveCut(scip, &cutstruct, &signs[bestrounding * blocksize], &nflips) );
+      }
+
+      SCIPdebugMsg(scip, "Best of %d roundings (rank %d) has objective contribution %g, local search flipped %d signs.\n",
+         nroundings, rank, bestobj, nflips);
+
+      /* create solution: start from the relaxation solution and set the variables of the block */
+      SCIP_CALL( SCIPlinkRelaxSol(scip, heurdata->sol) );
+      for (v = 0; v < cutstruct.nvars; ++v)
+      {
+         SCIP_Real* bestsigns = &signs[bestrounding * blocksize];
+
+         if ( (bestsigns[cutstruct.rows[v]] >= 0.0) == (bestsigns[cutstruct.cols[v]] >= 0.0) )
+         {
+            SCIP_CALL( SCIPsetSolVal(scip, heurdata->sol, cutstruct.vars[v], cutstruct.valsame[v]) );
+         }
+         else
+         {
+            SCIP_CALL( SCIPsetSolVal(scip, heurdata->sol, cutstruct.vars[v], cutstruct.valdiff[v]) );
+         }
+      }
+
+      /* round the remaining integral variables to their nearest values */
+      vars = SCIPgetVars(scip);
+      nvars = SCIPgetNVars(scip);
+      for (v = 0; v < nvars; ++v)
+      {
+         if ( SCIPvarIsIntegral(vars[v]) )
+         {
+            SCIP_CALL( SCIPsetSolVal(scip, heurdata->sol, vars[v], SCIPfeasRound(scip, SCIPgetSolVal(scip, heurdata->sol, vars[v]))) );
+         }
+      }
+
+      /* try to add solution to SCIP: check all constraints, including integrality */
+      SCIP_CALL( SCIPtrySol(scip, heurdata->sol, FALSE, FALSE, TRUE, TRUE, TRUE, &success) );
+      if ( success )
+      {
+         SCIPdebugMsg(scip, "Hyperplane rounding found a feasible solution.\n");
+         *result = SCIP_FOUNDSOL;
+      }
+
+      SCIPfreeBufferArray(scip, &signs);
+      SCIPfreeBufferArray(scip, &hyperplanes);
+      SCIPfreeBufferArray(scip, &factor);
+   }
+
+   SCIPfreeBufferArray(scip, &eigenvectors);
+   SCIPfreeBufferArray(scip, &eigenvalues);
+   SCIPfreeBufferArray(scip, &cutstruct.matrix);
+   SCIPfreeBufferArray(scip, &cutstruct.valdiff);
+   SCIPfreeBufferArray(scip, &cutstruct.valsame);
+   SCIPfreeBufferArray(scip, &cutstruct.cols);
+   SCIPfreeBufferArray(scip, &cutstruct.rows);
+   SCIPfreeBufferArray(scip, &cutstruct.vars);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * heuristic specific interface methods
+ */
+
+/** creates the randomized hyperplane rounding heuristic for SDPs and includes it in SCIP */
+SCIP_RETCODE SCIPincludeHeurSdpHyperplane(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR* heur;
+
+   /* create hyperplane rounding primal heuristic data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+
+   /* include primal heuristic */
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
+         HEUR_NAME, HEUR_DESC, HEUR_DISPCHAR, HEUR_PRIORITY, HEUR_FREQ, HEUR_FREQOFS,
+         HEUR_MAXDEPTH, HEUR_TIMING, HEUR_USESSUBSCIP, heurExecSdphyperplane, heurdata) );
+
+   assert( heur != NULL );
+
+   /* set non-NULL pointers to callback methods */
+   SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopySdphyperplane) );
+   SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeSdphyperplane) );
+   SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitSdphyperplane) );
+   SCIP_CALL( SCIPsetHeurExit(scip, heur, heurExitSdphyperplane) );
+
+   /* add hyperplane rounding heuristic parameters */
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "heuristics/" HEUR_NAME "/nroundings",
+         "number of random hyperplanes generated in each call",
+         &heurdata->nroundings, FALSE, DEFAULT_NROUNDINGS, 1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "heuristics/" HEUR_NAME "/maxrank",
+         "maximal rank of the factorization of the SDP matrix (-1: no limit)",
+         &heurdata->maxrank, FALSE, DEFAULT_MAXRANK, -1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "heuristics/" HEUR_NAME "/maxblocksize",
+         "maximal size of an SDP block to which the heuristic is applied",
+         &heurdata->maxblocksize, FALSE, DEFAULT_MAXBLOCKSIZE, 2, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "heuristics/" HEUR_NAME "/localsearch",
+         "Should the best rounding be improved by 1-opt local search?",
+         &heurdata->localsearch, FALSE, DEFAULT_LOCALSEARCH, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,65 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_sdphyperplane.h
+ * @ingroup PRIMALHEURISTICS
+ * @brief  randomized hyperplane rounding heuristic for SDPs with max-cut structure
+ * @author SCIP-SDP developers
+ *
+ * Goemans-Williamson style rounding heuristic. It looks for the largest SDP block in which all diagonal entries are
+ * positive constants and each variable appears in exactly one off-diagonal entry, such that the entry takes the values
+ * \f$\pm\sqrt{d_r d_c}\f$ for two feasible values of the variable; this is the case for the usual SDP relaxations of
+ * max-cut and related \f$\pm 1\f$ problems. The SDP matrix at the relaxation solution is factored via an eigenvector
+ * decomposition, the rows of the factor are projected onto random Gaussian directions, and the signs of the projections
+ * define candidate roundings. The best rounding is optionally improved by a 1-opt local search, the remaining integer
+ * variables are rounded, and the resulting solution is checked for feasibility.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_HEUR_SDPHYPERPLANE_H__
+#define __SCIP_HEUR_SDPHYPERPLANE_H__
+
+
+#include "scip/scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the randomized hyperplane rounding heuristic for SDPs and includes it in SCIP */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeHeurSdpHyperplane(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -8159,3 +8159,60 @@ int SCIPgetSdpSymmetryNGenerators(
    else
       return propdata->nperms;
 }
+
+/** returns the number of bytes used by the symmetry group information (generators, components, orbital fixing data) */
+SCIP_Longint SCIPgetSdpSymmetryMemory(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_PROP* prop;
+   SCIP_PROPDATA* propdata;
+   SCIP_Longint memory;
+
+   assert( scip != NULL );
+
+   prop = SCIPfindProp(scip, PROP_NAME);
+   if ( prop == NULL )
+      return 0;
+
+   propdata = SCIPpropGetData(prop);
+   assert( propdata != NULL );
+
+   if ( propdata->nperms <= 0 )
+      return 0;
+
+   /* permutation variables and generators */
+   memory = (SCIP_Longint) propdata->npermvars * (SCIP_Longint) sizeof(SCIP_VAR*);
+   if ( propdata->perms != NULL )
+   {
+      memory += (SCIP_Longint) propdata->nmaxperms * (SCIP_Longint) sizeof(int*);
+      memory += (SCIP_Longint) propdata->nperms * (SCIP_Longint) propdata->npermvars * (SCIP_Longint) sizeof(int);
+   }
+   if ( propdata->permstrans != NULL )
+   {
+      memory += (SCIP_Longint) propdata->npermvars * (SCIP_Longint) sizeof(int*);
+      memory += (SCIP_Longint) propdata->npermvars * (SCIP_Longint) propdata->nmaxperms * (SCIP_Longint) sizeof(int);
+   }
+   if ( propdata->permvarmap != NULL )
+      memory += (SCIP_Longint) SCIPhashmapGetNEntries(propdata->permvarmap) * (SCIP_Longint) (2 * sizeof(void*));
+   if ( propdata->isnonlinvar != NULL )
+      memory += (SCIP_Longint) propdata->npermvars * (SCIP_Longint) sizeof(SCIP_Bool);
+
+   /* components */
+   if ( propdata->ncomponents > 0 )
+   {
+      memory += (SCIP_Longint) propdata->ncomponents * (SCIP_Longint) sizeof(unsigned);
+      memory += (SCIP_Longint) (propdata->ncomponents + 1) * (SCIP_Longint) sizeof(int);
+      memory += (SCIP_Longint) (propdata->npermvars + propdata->nperms) * (SCIP_Longint) sizeof(int);
+   }
+
+   /* orbital fixing */
+   if ( propdata->bg0list != NULL )
+      memory += (SCIP_Longint) propdata->npermvars * (SCIP_Longint) (2 * sizeof(int) + 2 * sizeof(SCIP_Shortbool));
+   if ( propdata->permvarsevents != NULL )
+      memory += (SCIP_Longint) propdata->npermvars * (SCIP_Longint) sizeof(int);
+   if ( propdata->inactiveperms != NULL )
+      memory += (SCIP_Longint) propdata->nperms * (SCIP_Longint) sizeof(SCIP_Shortbool);
+
+   return memory;
+}
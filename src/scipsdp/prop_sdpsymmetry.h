@@ -83,6 +83,12 @@ int SCIPgetSdpSymmetryNGenerators(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns the number of bytes used by the symmetry group information (generators, components, orbital fixing data) */
+SCIP_EXPORT
+SCIP_Longint SCIPgetSdpSymmetryMemory(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -70,6 +70,7 @@
 
 #include "scipsdp/reader_cbf.h"
 #include "scipsdp/cons_sdp.h"
+#include "scipsdp/SdpLinebuffer.h"
 #include "scip/cons_linear.h"
 
 
@@ -88,6 +89,13 @@
 #define CBF_MAX_LINE  512       /* Last 3 chars reserved for '\r\n\0' */
 #define CBF_MAX_NAME  512
 
+#define CBF_COORD_CHUNKSIZE  65536   /**< number of lines of coordinate sections that are read and parsed at once */
+#define CBF_MAX_COORD_INTS   4       /**< maximal number of integers in a line of a coordinate section */
+
+#ifdef OMP
+#define DEFAULT_NTHREADS     1       /**< number of threads used for parsing coordinate sections */
+#endif
+
 /* used macros for reading names */
 #define MACRO_STR_EXPAND(tok) #tok
 #define MACRO_STR(tok) MACRO_STR_EXPAND(tok)
@@ -97,6 +105,7 @@
 struct SCIP_ReaderData
 {
    SCIP_Bool             removesmallval;     /**< Should small values in the constraints be removed? */
+   int                   nthreads;           /**< number of threads used for parsing coordinate sections */
 };
 
 
@@ -136,6 +145,9 @@ struct CBF_Data
    int                   constnnonz;         /**< number of nonzeros in const block */
    char*                 linebuffer;         /**< buffer for readling lines */
    char*                 namebuffer;         /**< buffer for reading names */
+   SdpLinebuffer*        coordlines;         /**< lines of the current chunk of a coordinate section */
+   int*                  coordints;          /**< integers of the current chunk of a coordinate section */
+   SCIP_Real*            coordvals;          /**< values of the current chunk of a coordinate section */
 };
 
 typedef struct CBF_Data CBF_DATA;
@@ -304,6 +316,10 @@ SCIP_RETCODE CBFfreeData(
       SCIPfreeBlockMemoryArrayNull(scip, &(data->createdpsdvars), data->npsdvars);
    }
 
+   SCIPfreeBlockMemoryArrayNull(scip, &data->coordvals, CBF_COORD_CHUNKSIZE);
+   SCIPfreeBlockMemoryArrayNull(scip, &data->coordints, CBF_MAX_COORD_INTS * CBF_COORD_CHUNKSIZE);
+   SCIPsdpLinebufferFree(scip, &data->coordlines);
+
    SCIPfreeBlockMemoryArrayNull(scip, &data->namebuffer, CBF_MAX_NAME);
    SCIPfreeBlockMemoryArrayNull(scip, &data->linebuffer, CBF_MAX_LINE);
 
@@ -348,6 +364,84 @@ SCIP_RETCODE CBFfgets(
    return SCIP_READERROR;
 }
 
+/** reads and parses the next chunk of lines of a coordinate section
+ *
+ *  Each line consists of @p nints integers followed by one value. The lines are read sequentially and then parsed,
+ *  possibly in parallel. The integers of line k of the chunk are stored in data->coordints[nints * k], ...,
+ *  data->coordints[nints * k + nints - 1] and the value in data->coordvals[k]. If a line could not be read or parsed, an
+ *  error is printed and @p success is set to FALSE; the CBF data is not freed.
+ */
+static
+SCIP_RETCODE CBFreadCoordChunk(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata,         /**< reader data */
+   CBF_DATA*             data,               /**< CBF data */
+   SCIP_FILE*            pfile,              /**< file to read from */
+   SCIP_Longint*         linecount,          /**< current linecount */
+   const char*           section,            /**< name of the section (for error messages) */
+   int                   nlines,             /**< number of lines to read (at most CBF_COORD_CHUNKSIZE) */
+   int                   nints,              /**< number of integers in each line (at most CBF_MAX_COORD_INTS) */
+   SCIP_Bool*            success             /**< pointer to store whether all lines could be read and parsed */
+   )
+{
+   int errorline = -1;
+   int k;
+
+   assert( readerdata != NULL );
+   assert( data != NULL );
+   assert( 0 < nlines && nlines <= CBF_COORD_CHUNKSIZE );
+   assert( 0 < nints && nints <= CBF_MAX_COORD_INTS );
+   assert( success != NULL );
+
+   *success = FALSE;
+
+   if ( data->coordlines == NULL )
+   {
+      SCIP_CALL( SCIPsdpLinebufferCreate(scip, &data->coordlines) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &data->coordints, CBF_MAX_COORD_INTS * CBF_COORD_CHUNKSIZE) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &data->coordvals, CBF_COORD_CHUNKSIZE) );
+   }
+
+   SCIPsdpLinebufferClear(data->coordlines);
+   for (k = 0; k < nlines; ++k)
+   {
+      if ( CBFfgets(scip, data, pfile, linecount, FALSE) != SCIP_OKAY )
+      {
+         SCIPerrorMessage("Could not read content of line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
+         return SCIP_OKAY;
+      }
+
+      /* with one thread, parse the line directly instead of copying it */
+      if ( readerdata->nthreads > 1 )
+      {
+         SCIP_CALL( SCIPsdpLinebufferAppend(scip, data->coordlines, data->linebuffer, *linecount) );
+      }
+      else
+      {
+         SCIP_Bool parsed;
+
+         SCIP_CALL( SCIPsdpLinebufferAppendParsed(scip, data->coordlines, data->linebuffer, *linecount, nints,
+               data->coordints, data->coordvals, &parsed) );
+         if ( ! parsed && errorline < 0 )
+            errorline = k;
+      }
+   }
+
+   if ( readerdata->nthreads > 1 )
+      errorline = SCIPsdpLinebufferParseCoords(data->coordlines, nints, data->coordints, data->coordvals, readerdata->nthreads);
+
+   if ( errorline >= 0 )
+   {
+      SCIPerrorMessage("Could not read entry of %s in line %" SCIP_LONGINT_FORMAT ".\n", section,
+         SCIPsdpLinebufferGetLinenumber(data->coordlines, errorline));
+      return SCIP_OKAY;
+   }
+
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
 /** reads objective sense from given CBF-file */
 static
 SCIP_RETCODE CBFreadObjsense(
@@ -1103,11 +1197,14 @@ SCIP_RETCODE CBFreadObjFcoord(
    SCIP_Longint*         linecount           /**< current linecount */
    )
 {  /*lint --e{818}*/
+   SCIP_Longint entryline;
    SCIP_Real val;
+   SCIP_Bool success;
    int nobjcoefs;
    int nzerocoef = 0;
    int nsmallcoef = 0;
    int i;
+   int k;
    int v;
    int row;
    int col;
@@ -1146,18 +1243,27 @@ SCIP_RETCODE CBFreadObjFcoord(
 
    for (i = 0; i < nobjcoefs; i++)
    {
-      SCIP_CALL( CBFfgets(scip, data, pfile, linecount, TRUE) );
-
-      if ( sscanf(data->linebuffer, "%i %i %i %lf", &v, &row, &col, &val) != 4 )
+      /* read and parse the next chunk of lines */
+      k = i % CBF_COORD_CHUNKSIZE;
+      if ( k == 0 )
       {
-         SCIPerrorMessage("Could not read entry of OBJFCOORD in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         SCIP_CALL( CBFfreeData(scip, pfile, data) );
-         return SCIP_READERROR;
+         SCIP_CALL( CBFreadCoordChunk(scip, readerdata, data, pfile, linecount, "OBJFCOORD", MIN(nobjcoefs - i, CBF_COORD_CHUNKSIZE), 3, &success) );
+         if ( ! success )
+         {
+            SCIP_CALL( CBFfreeData(scip, pfile, data) );
+            return SCIP_READERROR;
+         }
       }
 
+      v = data->coordints[3 * k];
+      row = data->coordints[3 * k + 1];
+      col = data->coordints[3 * k + 2];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+
       if ( v < 0 || v >= data->npsdvars )
       {
-         SCIPerrorMessage("Given objective coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d which does not exist!\n", *linecount, v);
+         SCIPerrorMessage("Given objective coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d which does not exist!\n", entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1165,7 +1271,7 @@ SCIP_RETCODE CBFreadObjFcoord(
       if ( row < 0 || row >= data->psdvarsizes[v] )
       {
          SCIPerrorMessage("Row index %d of given coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d in objective function is negative or larger than varsize %d!\n",
-            row, *linecount, v, data->psdvarsizes[v]);
+            row, entryline, v, data->psdvarsizes[v]);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1173,7 +1279,7 @@ SCIP_RETCODE CBFreadObjFcoord(
       if ( col < 0 || col >= data->psdvarsizes[v] )
       {
          SCIPerrorMessage("Column index %d of given coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d in objective function is negative or larger than varsize %d!\n",
-            col, *linecount, v, data->psdvarsizes[v]);
+            col, entryline, v, data->psdvarsizes[v]);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1181,7 +1287,7 @@ SCIP_RETCODE CBFreadObjFcoord(
       if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
       {
          SCIPerrorMessage("Given objective coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d is infinity, which is not allowed.\n",
-            *linecount, v);
+            entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR;
       }
@@ -1236,11 +1342,14 @@ SCIP_RETCODE CBFreadObjAcoord(
    SCIP_Longint*         linecount           /**< current linecount */
    )
 {  /*lint --e{818}*/
+   SCIP_Longint entryline;
    SCIP_Real val;
+   SCIP_Bool success;
    int nobjcoefs;
    int nzerocoef = 0;
    int nsmallcoef = 0;
    int i;
+   int k;
    int v;
 
    assert( scip != NULL );
@@ -1277,17 +1386,25 @@ SCIP_RETCODE CBFreadObjAcoord(
 
    for (i = 0; i < nobjcoefs; i++)
    {
-      SCIP_CALL( CBFfgets(scip, data, pfile, linecount, TRUE) );
-      if ( sscanf(data->linebuffer, "%i %lf", &v, &val) != 2 )
+      /* read and parse the next chunk of lines */
+      k = i % CBF_COORD_CHUNKSIZE;
+      if ( k == 0 )
       {
-         SCIPerrorMessage("Could not read entry of OBJACOORD in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         SCIP_CALL( CBFfreeData(scip, pfile, data) );
-         return SCIP_READERROR;
+         SCIP_CALL( CBFreadCoordChunk(scip, readerdata, data, pfile, linecount, "OBJACOORD", MIN(nobjcoefs - i, CBF_COORD_CHUNKSIZE), 1, &success) );
+         if ( ! success )
+         {
+            SCIP_CALL( CBFfreeData(scip, pfile, data) );
+            return SCIP_READERROR;
+         }
       }
 
+      v = data->coordints[k];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+
       if ( v < 0 || v >= data->nvars )
       {
-         SCIPerrorMessage("Given objective coefficient in line %" SCIP_LONGINT_FORMAT " for scalar variable %d which does not exist!\n", *linecount, v);
+         SCIPerrorMessage("Given objective coefficient in line %" SCIP_LONGINT_FORMAT " for scalar variable %d which does not exist!\n", entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1295,7 +1412,7 @@ SCIP_RETCODE CBFreadObjAcoord(
       if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
       {
          SCIPerrorMessage("Given objective coefficient in line %" SCIP_LONGINT_FORMAT " for scalar variable %d is infinity, which is not allowed.\n",
-            *linecount, v);
+            entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR;
       }
@@ -1338,12 +1455,15 @@ SCIP_RETCODE CBFreadFcoord(
    SCIP_Longint*         linecount           /**< current linecount */
    )
 {  /*lint --e{818}*/
+   SCIP_Longint entryline;
    SCIP_Real val;
+   SCIP_Bool success;
    int nzerocoef = 0;
    int nsmallcoef = 0;
    int ncoefs;
    int c;
    int i;
+   int k;
    int v;
    int row;
    int col;
@@ -1390,25 +1510,35 @@ SCIP_RETCODE CBFreadFcoord(
 
    for (i = 0; i < ncoefs; i++)
    {
-      SCIP_CALL( CBFfgets(scip, data, pfile, linecount, TRUE) );
-
-      if ( sscanf(data->linebuffer, "%i %i %i %i %lf", &c, &v, &row, &col, &val) != 5 )
+      /* read and parse the next chunk of lines */
+      k = i % CBF_COORD_CHUNKSIZE;
+      if ( k == 0 )
       {
-         SCIPerrorMessage("Could not read entry of FCOORD in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         SCIP_CALL( CBFfreeData(scip, pfile, data) );
-         return SCIP_READERROR;
+         SCIP_CALL( CBFreadCoordChunk(scip, readerdata, data, pfile, linecount, "FCOORD", MIN(ncoefs - i, CBF_COORD_CHUNKSIZE), 4, &success) );
+         if ( ! success )
+         {
+            SCIP_CALL( CBFfreeData(scip, pfile, data) );
+            return SCIP_READERROR;
+         }
       }
 
+      c = data->coordints[4 * k];
+      v = data->coordints[4 * k + 1];
+      row = data->coordints[4 * k + 2];
+      col = data->coordints[4 * k + 3];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+
       if ( c < 0 || c >= data->nconss )
       {
-         SCIPerrorMessage("Given matrix variable coefficient in line %" SCIP_LONGINT_FORMAT " for constraint %d which does not exist!\n", *linecount, c);
+         SCIPerrorMessage("Given matrix variable coefficient in line %" SCIP_LONGINT_FORMAT " for constraint %d which does not exist!\n", entryline, c);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
 
       if ( v < 0 || v >= data->npsdvars )
       {
-         SCIPerrorMessage("Given coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d which does not exist!\n", *linecount, v);
+         SCIPerrorMessage("Given coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d which does not exist!\n", entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1416,7 +1546,7 @@ SCIP_RETCODE CBFreadFcoord(
       if ( row < 0 || row >= data->psdvarsizes[v] )
       {
          SCIPerrorMessage("Row index %d of given coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d in scalar constraint %d is negative or larger than varsize %d!\n",
-            row, *linecount, v, c, data->psdvarsizes[v]);
+            row, entryline, v, c, data->psdvarsizes[v]);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1424,7 +1554,7 @@ SCIP_RETCODE CBFreadFcoord(
       if ( col < 0 || col >= data->psdvarsizes[v] )
       {
          SCIPerrorMessage("Column index %d of given coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d in scalar constraint %d is negative or larger than varsize %d!\n",
-            col, *linecount, v, c, data->psdvarsizes[v]);
+            col, entryline, v, c, data->psdvarsizes[v]);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1432,7 +1562,7 @@ SCIP_RETCODE CBFreadFcoord(
       if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
       {
          SCIPerrorMessage("Given coefficient in line %" SCIP_LONGINT_FORMAT " for matrix variable %d is infinity, which is not allowed.\n",
-            *linecount, v);
+            entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR;
       }
@@ -1485,12 +1615,15 @@ SCIP_RETCODE CBFreadAcoord(
    SCIP_Longint*         linecount           /**< current linecount */
    )
 {  /*lint --e{818}*/
+   SCIP_Longint entryline;
    SCIP_Real val;
+   SCIP_Bool success;
    int nzerocoef = 0;
    int nsmallcoef = 0;
    int ncoefs;
    int c;
    int i;
+   int k;
    int v;
 
    assert( scip != NULL );
@@ -1535,24 +1668,33 @@ SCIP_RETCODE CBFreadAcoord(
 
    for (i = 0; i < ncoefs; i++)
    {
-      SCIP_CALL( CBFfgets(scip, data, pfile, linecount, TRUE) );
-      if ( sscanf(data->linebuffer, "%i %i %lf", &c, &v, &val) != 3 )
+      /* read and parse the next chunk of lines */
+      k = i % CBF_COORD_CHUNKSIZE;
+      if ( k == 0 )
       {
-         SCIPerrorMessage("Could not read entry of ACOORD in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         SCIP_CALL( CBFfreeData(scip, pfile, data) );
-         return SCIP_READERROR;
+         SCIP_CALL( CBFreadCoordChunk(scip, readerdata, data, pfile, linecount, "ACOORD", MIN(ncoefs - i, CBF_COORD_CHUNKSIZE), 2, &success) );
+         if ( ! success )
+         {
+            SCIP_CALL( CBFfreeData(scip, pfile, data) );
+            return SCIP_READERROR;
+         }
       }
 
+      c = data->coordints[2 * k];
+      v = data->coordints[2 * k + 1];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+
       if ( c < 0 || c >= data->nconss )
       {
-         SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for constraint %d which does not exist!\n", *linecount, c);
+         SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for constraint %d which does not exist!\n", entryline, c);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
 
       if ( v < 0 || v >= data->nvars )
       {
-         SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d which does not exist!\n", *linecount, v);
+         SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d which does not exist!\n", entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1560,7 +1702,7 @@ SCIP_RETCODE CBFreadAcoord(
       if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
       {
          SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d is infinity, which is not allowed.\n",
-            *linecount, v);
+            entryline, v);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR;
       }
@@ -1603,12 +1745,15 @@ SCIP_RETCODE CBFreadBcoord(
    SCIP_Longint*         linecount           /**< current linecount */
    )
 {  /*lint --e{818}*/
+   SCIP_Longint entryline;
    SCIP_Real val;
+   SCIP_Bool success;
    int nzerocoef = 0;
    int nsmallcoef = 0;
    int nsides;
    int c;
    int i;
+   int k;
 
    assert( scip != NULL );
    assert( data != NULL );
@@ -1644,18 +1789,25 @@ SCIP_RETCODE CBFreadBcoord(
 
    for (i = 0; i < nsides; i++)
    {
-      SCIP_CALL( CBFfgets(scip, data, pfile, linecount, TRUE) );
-
-      if ( sscanf(data->linebuffer, "%i %lf", &c, &val) != 2 )
+      /* read and parse the next chunk of lines */
+      k = i % CBF_COORD_CHUNKSIZE;
+      if ( k == 0 )
       {
-         SCIPerrorMessage("Could not read entry of BCOORD in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         SCIP_CALL( CBFfreeData(scip, pfile, data) );
-         return SCIP_READERROR;
+         SCIP_CALL( CBFreadCoordChunk(scip, readerdata, data, pfile, linecount, "BCOORD", MIN(nsides - i, CBF_COORD_CHUNKSIZE), 1, &success) );
+         if ( ! success )
+         {
+            SCIP_CALL( CBFfreeData(scip, pfile, data) );
+            return SCIP_READERROR;
+         }
       }
 
+      c = data->coordints[k];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+
       if ( c < 0 || c >= data->nconss )
       {
-         SCIPerrorMessage("Given constant part in line %" SCIP_LONGINT_FORMAT " for scalar constraint %d which does not exist!\n", *linecount, c);
+         SCIPerrorMessage("Given constant part in line %" SCIP_LONGINT_FORMAT " for scalar constraint %d which does not exist!\n", entryline, c);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1663,7 +1815,7 @@ SCIP_RETCODE CBFreadBcoord(
       if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
       {
          SCIPerrorMessage("Given constant part in line %" SCIP_LONGINT_FORMAT " of scalar constraint %d is infinity, which is not allowed.\n",
-            *linecount, c);
+            entryline, c);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -1717,10 +1869,13 @@ SCIP_RETCODE CBFreadHcoord(
    SCIP_Longint*         linecount           /**< current linecount */
    )
 {
+   SCIP_Longint entryline;
    SCIP_Real val;
+   SCIP_Bool success;
    int** sdpvar;
    int nnonz;
    int i;
+   int k;
    int b;
    int v;
    int row;
@@ -1811,44 +1966,52 @@ SCIP_RETCODE CBFreadHcoord(
 
    for (i = 0; i < nnonz; i++)
    {
-      SCIP_CALL( CBFfgets(scip, data, pfile, linecount, TRUE) );
-
-      if ( sscanf(data->linebuffer, "%i %i %i %i %lf", &b, &v, &row, &col, &val) != 5 )
+      /* read and parse the next chunk of lines */
+      k = i % CBF_COORD_CHUNKSIZE;
+      if ( k == 0 )
       {
-         SCIPerrorMessage("Could not read entry of HCOORD in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         goto TERMINATE;
+         SCIP_CALL( CBFreadCoordChunk(scip, readerdata, data, pfile, linecount, "HCOORD", MIN(nnonz - i, CBF_COORD_CHUNKSIZE), 4, &success) );
+         if ( ! success )
+            goto TERMINATE;
       }
 
+      b = data->coordints[4 * k];
+      v = data->coordints[4 * k + 1];
+      row = data->coordints[4 * k + 2];
+      col = data->coordints[4 * k + 3];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+
       if ( b < 0 || b >= ncbfsdpblocks )
       {
-         SCIPerrorMessage("Given SDP-coefficient in line %" SCIP_LONGINT_FORMAT " for SDP-constraint %d which does not exist!\n", *linecount, b);
+         SCIPerrorMessage("Given SDP-coefficient in line %" SCIP_LONGINT_FORMAT " for SDP-constraint %d which does not exist!\n", entryline, b);
          goto TERMINATE;
       }
 
       if ( v < 0 || v >= data->nvars )
       {
-         SCIPerrorMessage("Given SDP-coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d which does not exist!\n", *linecount, v);
+         SCIPerrorMessage("Given SDP-coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d which does not exist!\n", entryline, v);
          goto TERMINATE;
       }
 
       if ( row < 0 || row >= data->sdpblocksizes[b] )
       {
          SCIPerrorMessage("Row index %d of given SDP coefficient in line %" SCIP_LONGINT_FORMAT " is negative or larger than blocksize %d!\n",
-            row, *linecount, data->sdpblocksizes[b]);
+            row, entryline, data->sdpblocksizes[b]);
          goto TERMINATE;
       }
 
       if ( col < 0 || col >= data->sdpblocksizes[b] )
       {
          SCIPerrorMessage("Column index %d of given SDP coefficient in line %" SCIP_LONGINT_FORMAT " is negative or larger than blocksize %d!\n",
-            col, *linecount, data->sdpblocksizes[b]);
+            col, entryline, data->sdpblocksizes[b]);
          goto TERMINATE;
       }
 
       if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
       {
          SCIPerrorMessage("Given SDP-coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d is infinity, which is not allowed.\n",
-            *linecount, v);
+            entryline, v);
          goto TERMINATE;
       }
 
@@ -2028,12 +2191,15 @@ SCIP_RETCODE CBFreadDcoord(
    SCIP_Longint*         linecount           /**< current linecount */
    )
 {
+   SCIP_Longint entryline;
    SCIP_Real val;
+   SCIP_Bool success;
    int nzerocoef = 0;
    int nsmallcoef = 0;
    int constnnonz;
    int b;
    int i;
+   int k;
    int row;
    int col;
 
@@ -2097,17 +2263,27 @@ SCIP_RETCODE CBFreadDcoord(
 
    for (i = 0; i < constnnonz; i++)
    {
-      SCIP_CALL( CBFfgets(scip, data, pfile, linecount, TRUE) );
-      if ( sscanf(data->linebuffer, "%i %i %i %lf", &b, &row, &col, &val) != 4 )
+      /* read and parse the next chunk of lines */
+      k = i % CBF_COORD_CHUNKSIZE;
+      if ( k == 0 )
       {
-         SCIPerrorMessage("Could not read entry of DCOORD in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         SCIP_CALL( CBFfreeData(scip, pfile, data) );
-         return SCIP_READERROR;
+         SCIP_CALL( CBFreadCoordChunk(scip, readerdata, data, pfile, linecount, "DCOORD", MIN(constnnonz - i, CBF_COORD_CHUNKSIZE), 3, &success) );
+         if ( ! success )
+         {
+            SCIP_CALL( CBFfreeData(scip, pfile, data) );
+            return SCIP_READERROR;
+         }
       }
 
+      b = data->coordints[3 * k];
+      row = data->coordints[3 * k + 1];
+      col = data->coordints[3 * k + 2];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+
       if ( b < 0 || b >= data->nsdpblocks )
       {
-         SCIPerrorMessage("Given constant entry in line %" SCIP_LONGINT_FORMAT " for SDP-constraint %d which does not exist!\n", *linecount, b);
+         SCIPerrorMessage("Given constant entry in line %" SCIP_LONGINT_FORMAT " for SDP-constraint %d which does not exist!\n", entryline, b);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -2115,7 +2291,7 @@ SCIP_RETCODE CBFreadDcoord(
       if ( row < 0 || row >= data->sdpblocksizes[b] )
       {
          SCIPerrorMessage("Row index %d of given constant SDP-entry in line %" SCIP_LONGINT_FORMAT " is negative or larger than blocksize %d!\n",
-            row, *linecount, data->sdpblocksizes[b]);
+            row, entryline, data->sdpblocksizes[b]);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -2123,7 +2299,7 @@ SCIP_RETCODE CBFreadDcoord(
       if ( col < 0 || col >= data->sdpblocksizes[b] )
       {
          SCIPerrorMessage("Column index %d of given constant SDP-entry in line %" SCIP_LONGINT_FORMAT " is negative or larger than blocksize %d!\n",
-            col, *linecount, data->sdpblocksizes[b]);
+            col, entryline, data->sdpblocksizes[b]);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -2131,7 +2307,7 @@ SCIP_RETCODE CBFreadDcoord(
       if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
       {
          SCIPerrorMessage("Given constant entry in line %" SCIP_LONGINT_FORMAT " for SDP constraint %d is infinity, which is not allowed.\n",
-            *linecount, b);
+            entryline, b);
          SCIP_CALL( CBFfreeData(scip, pfile, data) );
          return SCIP_READERROR; /*lint !e527*/
       }
@@ -2248,6 +2424,10 @@ SCIP_DECL_READERREAD(readerReadCbf)
    data->sdpconstcol = NULL;
    data->sdpconstval = NULL;
 
+   data->coordlines = NULL;
+   data->coordints = NULL;
+   data->coordvals = NULL;
+
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &data->linebuffer, CBF_MAX_LINE) );
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &data->namebuffer, CBF_MAX_NAME) );
 
@@ -3203,5 +3383,14 @@ SCIP_RETCODE SCIPincludeReaderCbf(
    SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteCbf) );
    SCIP_CALL( SCIPsetReaderFree(scip, reader, readerFreeCbf) );
 
+   /* add parameters */
+#ifdef OMP
+   SCIP_CALL( SCIPaddIntParam(scip, "reading/" READER_NAME "/threads",
+         "number of threads used for parsing coordinate sections",
+         &readerdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, INT_MAX, NULL, NULL) );
+#else
+   readerdata->nthreads = 1;
+#endif
+
    return SCIP_OKAY;
 }
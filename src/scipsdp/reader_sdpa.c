@@ -47,6 +47,7 @@
 
 #include "scipsdp/reader_sdpa.h"
 #include "scipsdp/cons_sdp.h"
+#include "scipsdp/SdpLinebuffer.h"
 #include "scip/cons_linear.h"
 #include "scip/cons_indicator.h" /* for SCIPcreateConsIndicatorLinCons */
 
@@ -55,11 +56,17 @@
 #define READER_EXTENSION        "dat-s"
 
 #define SDPA_MIN_BUFFERLEN 65536   /* minimal size of buffer */
+#define SDPA_COORD_CHUNKSIZE 65536 /**< number of lines of block entries that are read and parsed at once */
+
+#ifdef OMP
+#define DEFAULT_NTHREADS       1   /**< number of threads used for parsing block entries */
+#endif
 
 /** SDPA reading data */
 struct SCIP_ReaderData
 {
    SCIP_Bool             removesmallval;     /**< Should small values in the constraints be removed? */
+   int                   nthreads;           /**< number of threads used for parsing block entries */
 };
 
 
@@ -94,6 +101,9 @@ struct SDPA_Data
    int                   idxlinconsblock;    /**< the index of the linear constraint block */
    char*                 buffer;             /**< input buffer */
    int                   bufferlen;          /**< length of buffer */
+   SdpLinebuffer*        coordlines;         /**< lines of the current chunk of block entries */
+   int*                  coordints;          /**< indices (variable, block, row, column) of the current chunk of block entries */
+   SCIP_Real*            coordvals;          /**< values of the current chunk of block entries */
 };
 
 typedef struct SDPA_Data SDPA_DATA;
@@ -438,6 +448,10 @@ SCIP_RETCODE SDPAfreeData(
    SCIPfreeBlockMemoryArrayNull(scip, &data->buffer, data->bufferlen);
    data->bufferlen = 0;
 
+   SCIPfreeBlockMemoryArrayNull(scip, &data->coordvals, SDPA_COORD_CHUNKSIZE);
+   SCIPfreeBlockMemoryArrayNull(scip, &data->coordints, 4 * SDPA_COORD_CHUNKSIZE);
+   SCIPsdpLinebufferFree(scip, &data->coordlines);
+
    if ( data->nsdpblocks > 0 )
    {
       assert( data->nvars > 0 );
@@ -834,6 +848,84 @@ SCIP_RETCODE SDPAreadObjVals(
 }
 
 
+/** reads and parses the next chunk of block entries
+ *
+ *  On entry, data->buffer contains the next line if @p lineread is TRUE. Lines are collected until the chunk is full, the
+ *  end of the file is reached, or the integer or rank-1 section starts; the line following the chunk remains in
+ *  data->buffer. The collected lines are then parsed, possibly in parallel. The indices (variable, block, row, column)
+ *  of entry k are stored in data->coordints[4 * k], ..., data->coordints[4 * k + 3] and its value in data->coordvals[k].
+ */
+static
+SCIP_RETCODE SDPAreadCoordChunk(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata,         /**< reader data */
+   SCIP_FILE*            file,               /**< file to read from */
+   SCIP_Longint*         linecount,          /**< current linecount */
+   SDPA_DATA*            data,               /**< data pointer to save the results in */
+   SCIP_Bool*            lineread,           /**< pointer to whether data->buffer contains a line (updated) */
+   int*                  nentries,           /**< pointer to store the number of entries in the chunk */
+   SCIP_Bool*            success             /**< pointer to store whether all entries could be parsed */
+   )
+{
+   int errorline = -1;
+
+   assert( readerdata != NULL );
+   assert( data != NULL );
+   assert( lineread != NULL );
+   assert( nentries != NULL );
+   assert( success != NULL );
+
+   *nentries = 0;
+   *success = TRUE;
+
+   if ( data->coordlines == NULL )
+   {
+      SCIP_CALL( SCIPsdpLinebufferCreate(scip, &data->coordlines) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &data->coordints, 4 * SDPA_COORD_CHUNKSIZE) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &data->coordvals, SDPA_COORD_CHUNKSIZE) );
+   }
+
+   SCIPsdpLinebufferClear(data->coordlines);
+   while ( *lineread && SCIPsdpLinebufferGetNLines(data->coordlines) < SDPA_COORD_CHUNKSIZE )
+   {
+      if ( strncmp(data->buffer, "*INTEGER", 8) == 0 || strncmp(data->buffer, "*RANK1", 5) == 0 )
+         break;
+
+      /* with one thread, parse the line directly instead of copying it */
+      if ( readerdata->nthreads > 1 )
+      {
+         SCIP_CALL( SCIPsdpLinebufferAppend(scip, data->coordlines, data->buffer, *linecount) );
+      }
+      else
+      {
+         SCIP_Bool parsed;
+
+         SCIP_CALL( SCIPsdpLinebufferAppendParsed(scip, data->coordlines, data->buffer, *linecount, 4,
+               data->coordints, data->coordvals, &parsed) );
+         if ( ! parsed && errorline < 0 )
+            errorline = SCIPsdpLinebufferGetNLines(data->coordlines) - 1;
+      }
+      SCIP_CALL( readNextLine(scip, file, &data->buffer, &data->bufferlen, linecount, lineread) );
+   }
+
+   *nentries = SCIPsdpLinebufferGetNLines(data->coordlines);
+   if ( *nentries == 0 )
+      return SCIP_OKAY;
+
+   if ( readerdata->nthreads > 1 )
+      errorline = SCIPsdpLinebufferParseCoords(data->coordlines, 4, data->coordints, data->coordvals, readerdata->nthreads);
+
+   if ( errorline >= 0 )
+   {
+      SCIPerrorMessage("Could not read block entry in line %" SCIP_LONGINT_FORMAT ".\n",
+         SCIPsdpLinebufferGetLinenumber(data->coordlines, errorline));
+      *success = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
+
+
 /** reads the SDP-constraint blocks and the linear constraint block */
 static
 SCIP_RETCODE SDPAreadBlocks(
@@ -847,9 +939,11 @@ SCIP_RETCODE SDPAreadBlocks(
    SCIP_VAR* indvar = 0;
    SCIP_Real** sdpval_local = NULL;          /* array of all values of SDP nonzeros for each SDP block */
    SCIP_Real** sdpconstval_local = NULL;
+   SCIP_Longint entryline;
    SCIP_Real val;
    SCIP_Bool infeasible;
    SCIP_Bool success;
+   SCIP_Bool parsed;
    int** sdprow_local = NULL;                /* array of all row indices for each SDP block */
    int** sdpcol_local = NULL;                /* array of all column indices for each SDP block */
    int** sdpconstrow_local = NULL;           /* pointers to row-indices for each block */
@@ -866,6 +960,8 @@ SCIP_RETCODE SDPAreadBlocks(
    int emptylinconsblocks = 0;
    int nindcons = 0;
    int blockidxoffset = 0;
+   int nentries = 0;
+   int k = 0;
    int row;
    int col;
    int b;                                    /* current block */
@@ -965,17 +1061,27 @@ SCIP_RETCODE SDPAreadBlocks(
       goto TERMINATE;
    }
 
-   while ( success )
+   while ( TRUE )
    {
-      if ( strncmp(data->buffer, "*INTEGER", 8) == 0 || strncmp(data->buffer, "*RANK1", 5) == 0 )
-         break;
-
-      if ( sscanf(data->buffer, "%i %i %i %i %lf", &v, &b, &row, &col, &val) != 5 )
+      /* read and parse the next chunk of entries */
+      if ( k == nentries )
       {
-         SCIPerrorMessage("Could not read block entry in line %" SCIP_LONGINT_FORMAT ".\n", *linecount);
-         goto TERMINATE;
+         SCIP_CALL( SDPAreadCoordChunk(scip, readerdata, file, linecount, data, &success, &nentries, &parsed) );
+         if ( ! parsed )
+            goto TERMINATE;
+         if ( nentries == 0 )
+            break;
+         k = 0;
       }
 
+      v = data->coordints[4 * k];
+      b = data->coordints[4 * k + 1];
+      row = data->coordints[4 * k + 2];
+      col = data->coordints[4 * k + 3];
+      val = data->coordvals[k];
+      entryline = SCIPsdpLinebufferGetLinenumber(data->coordlines, k);
+      ++k;
+
       /* switch from SDPA counting (starting from 1) to SCIP counting (starting from 0) */
       --v;
       --b;
@@ -998,14 +1104,14 @@ SCIP_RETCODE SDPAreadBlocks(
          if ( v < - 1 || v >= data->nvars )
          {
             SCIPerrorMessage("Given coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d which does not exist!\n",
-               *linecount, v+1);
+               entryline, v+1);
             goto TERMINATE;
          }
 
          if ( b < 0 || b >= data->nsdpblocks )
          {
             SCIPerrorMessage("Given coefficient in line %" SCIP_LONGINT_FORMAT " for SDP block %d which does not exist!\n",
-               *linecount, b + 1 + blockidxoffset);
+               entryline, b + 1 + blockidxoffset);
             goto TERMINATE;
          }
          assert( 0 <= b && b < data->nsdpblocks );
@@ -1013,14 +1119,14 @@ SCIP_RETCODE SDPAreadBlocks(
          if ( row < 0 || row >= data->sdpblocksizes[b] )
          {
             SCIPerrorMessage("Row index %d of given coefficient in line %" SCIP_LONGINT_FORMAT " is negative or larger than blocksize %d!\n",
-               row +1, *linecount, data->sdpblocksizes[b]);
+               row +1, entryline, data->sdpblocksizes[b]);
             goto TERMINATE;
          }
 
          if ( col < 0 || col >= data->sdpblocksizes[b] )
          {
             SCIPerrorMessage("Column index %d of given coefficient in line %" SCIP_LONGINT_FORMAT " is negative or larger than blocksize %d!\n",
-               col + 1, *linecount, data->sdpblocksizes[b]);
+               col + 1, entryline, data->sdpblocksizes[b]);
             goto TERMINATE;
          }
 
@@ -1046,7 +1152,7 @@ SCIP_RETCODE SDPAreadBlocks(
                if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
                {
                   SCIPerrorMessage("Given coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d is infinity, which is not allowed.\n",
-                     *linecount, v+1);
+                     entryline, v+1);
                   goto TERMINATE;
                }
 
@@ -1106,7 +1212,7 @@ SCIP_RETCODE SDPAreadBlocks(
                if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
                {
                   SCIPerrorMessage("Given constant part in line %" SCIP_LONGINT_FORMAT " of block %d is infinity, which is not allowed.\n",
-                     *linecount, b+1);
+                     entryline, b+1);
                   goto TERMINATE;
                }
 
@@ -1148,7 +1254,7 @@ SCIP_RETCODE SDPAreadBlocks(
          if ( v >= data->nvars )
          {
             SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d which does not exist!\n",
-               *linecount, v + 1);
+               entryline, v + 1);
             goto TERMINATE;
          }
 
@@ -1156,7 +1262,7 @@ SCIP_RETCODE SDPAreadBlocks(
          if ( row != col )
          {
             SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " is not located on the diagonal!\n",
-               *linecount);
+               entryline);
             goto TERMINATE;
          }
 
@@ -1165,7 +1271,7 @@ SCIP_RETCODE SDPAreadBlocks(
          if ( row < 0 || row >= data->nlinconss )
          {
             SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for linear constraint %d which does not exist!\n",
-               *linecount, row + 1);
+               entryline, row + 1);
             goto TERMINATE;
          }
 
@@ -1175,7 +1281,7 @@ SCIP_RETCODE SDPAreadBlocks(
             if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val) )
             {
                SCIPerrorMessage("Given linear coefficient in line %" SCIP_LONGINT_FORMAT " for variable %d is infinity, which is not allowed.\n",
-                  *linecount, v+1);
+                  entryline, v+1);
                goto TERMINATE;
             }
 
@@ -1254,7 +1360,7 @@ SCIP_RETCODE SDPAreadBlocks(
                if ( SCIPisInfinity(scip, val) ||  SCIPisInfinity(scip, -val))
                {
                   SCIPerrorMessage("Given constant part in line %" SCIP_LONGINT_FORMAT " of block %d is infinity, which is not allowed.\n",
-                     *linecount, b+1);
+                     entryline, b+1);
                   goto TERMINATE;
                }
 
@@ -1276,8 +1382,6 @@ SCIP_RETCODE SDPAreadBlocks(
             }
          }
       }
-
-      SCIP_CALL( readNextLine(scip, file, &data->buffer, &data->bufferlen, linecount, &success) );
    }
 
    /* reset LP block offset */
@@ -1734,6 +1838,9 @@ SCIP_DECL_READERREAD(readerReadSdpa)
    data->sdpmemsize = NULL;
    data->sdpconstmemsize = NULL;
    data->buffer = NULL;
+   data->coordlines = NULL;
+   data->coordints = NULL;
+   data->coordvals = NULL;
 
    readerdata = SCIPreaderGetData(reader);
    assert( readerdata != NULL );
@@ -2344,5 +2451,14 @@ SCIP_RETCODE SCIPincludeReaderSdpa(
    SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteSdpa) );
    SCIP_CALL( SCIPsetReaderFree(scip, reader, readerFreeSdpa) );
 
+   /* add parameters */
+#ifdef OMP
+   SCIP_CALL( SCIPaddIntParam(scip, "reading/" READER_NAME "/threads",
+         "number of threads used for parsing block entries",
+         &readerdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, INT_MAX, NULL, NULL) );
+#else
+   readerdata->nthreads = 1;
+#endif
+
    return SCIP_OKAY;
 }
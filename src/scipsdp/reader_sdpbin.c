@@ -0,0 +1,1064 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_sdpbin.c
+ * @brief  file reader and writer for mixed-integer semidefinite programs in a binary format
+ * @author SCIP-SDP developers
+ *
+ * A file consists of the following sections; all numbers are stored as int or SCIP_Real in the byte order of the
+ * writing machine and each array is stored contiguously, so that it is read by a single call of SCIPfread().
+ *
+ * - the magic string "SCIPSDPB" (8 characters),
+ * - an int array with the version number, a byte order marker, sizeof(int), sizeof(SCIP_Real), the objective sense,
+ *   the number of variables, linear constraints, SDP constraints and linear nonzeros, and the total length of the names,
+ * - a SCIP_Real array with the objective offset and the value of infinity of the writing SCIP instance,
+ * - the names of the variables, linear constraints and SDP constraints (in this order), each terminated by '\\0',
+ * - the objective coefficients, lower bounds and upper bounds (SCIP_Real) and the types (int) of the variables,
+ * - the left and right hand sides and the flags of the linear constraints, the begin of each constraint in the nonzero
+ *   arrays (with one additional entry for the end), and the variable indices and values of the nonzeros,
+ * - for each SDP constraint its blocksize, whether it is rank 1, its number of variables, nonzeros and constant nonzeros,
+ *   and its flags,
+ * - for each SDP constraint the variable indices, the number of nonzeros of each variable, the rows, columns and values
+ *   of all nonzeros (ordered by variable), and the rows, columns and values of the constant nonzeros.
+ *
+ * The SDP constraints are created with SCIPcreateConsSdp() or SCIPcreateConsSdpRank1() without removing duplicates, so
+ * the nonzeros are copied in the order of the file. The reader only checks that all indices are in range.
+ *
+ * The flags of a constraint (initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable,
+ * stickingatnode) are stored as a bitmask of SDPBIN_FLAG_*, so that writing and reading a problem keeps them. Only
+ * original problems can be written.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <string.h>                      /* for strcmp, strlen */
+
+#include "scipsdp/reader_sdpbin.h"
+#include "scipsdp/cons_sdp.h"
+#include "scip/cons_linear.h"
+
+
+#define READER_NAME             "sdpbinreader"
+#define READER_DESC             "file reader and writer for MISDPs in binary format"
+#define READER_EXTENSION        "sdpbin"
+
+#define SDPBIN_MAGIC            "SCIPSDPB"   /**< magic string at the beginning of a file */
+#define SDPBIN_MAGICLEN         8            /**< length of the magic string */
+#define SDPBIN_VERSION          1            /**< version number of the format */
+#define SDPBIN_BYTEORDER        0x01020304   /**< marker to detect a different byte order */
+
+/* positions in the int array of the file header */
+#define SDPBIN_INFO_VERSION     0            /**< version number */
+#define SDPBIN_INFO_BYTEORDER   1            /**< byte order marker */
+#define SDPBIN_INFO_INTSIZE     2            /**< sizeof(int) */
+#define SDPBIN_INFO_REALSIZE    3            /**< sizeof(SCIP_Real) */
+#define SDPBIN_INFO_OBJSENSE    4            /**< objective sense (1: minimize, -1: maximize) */
+#define SDPBIN_INFO_NVARS       5            /**< number of variables */
+#define SDPBIN_INFO_NLINCONSS   6            /**< number of linear constraints */
+#define SDPBIN_INFO_NSDPCONSS   7            /**< number of SDP constraints */
+#define SDPBIN_INFO_NLINNONZ    8            /**< number of nonzeros of linear constraints */
+#define SDPBIN_INFO_NAMELEN     9            /**< total length of all names (including terminating zeros) */
+#define SDPBIN_NINFO            10           /**< length of the int array of the file header */
+
+/* positions in the SCIP_Real array of the file header */
+#define SDPBIN_REAL_OBJOFFSET   0            /**< objective offset */
+#define SDPBIN_REAL_INFINITY    1            /**< value of infinity of the writing SCIP instance */
+#define SDPBIN_NREALS           2            /**< length of the SCIP_Real array of the file header */
+
+/* positions in the int array describing an SDP constraint */
+#define SDPBIN_SDP_BLOCKSIZE    0            /**< size of the SDP block */
+#define SDPBIN_SDP_RANKONE      1            /**< whether the constraint is rank 1 */
+#define SDPBIN_SDP_NVARS        2            /**< number of variables */
+#define SDPBIN_SDP_NNONZ        3            /**< number of nonzeros */
+#define SDPBIN_SDP_CONSTNNONZ   4            /**< number of constant nonzeros */
+#define SDPBIN_SDP_FLAGS        5            /**< flags of the constraint */
+#define SDPBIN_NSDPINFO         6            /**< length of the int array of an SDP constraint */
+
+/* bits of the flags of a constraint */
+#define SDPBIN_FLAG_INITIAL     0x001        /**< should the LP relaxation of the constraint be in the initial LP? */
+#define SDPBIN_FLAG_SEPARATE    0x002        /**< should the constraint be separated during LP processing? */
+#define SDPBIN_FLAG_ENFORCE     0x004        /**< should the constraint be enforced during node processing? */
+#define SDPBIN_FLAG_CHECK       0x008        /**< should the constraint be checked for feasibility? */
+#define SDPBIN_FLAG_PROPAGATE   0x010        /**< should the constraint be propagated during node processing? */
+#define SDPBIN_FLAG_LOCAL       0x020        /**< is the constraint only valid locally? */
+#define SDPBIN_FLAG_MODIFIABLE  0x040        /**< is the constraint modifiable (subject to column generation)? */
+#define SDPBIN_FLAG_DYNAMIC     0x080        /**< is the constraint subject to aging? */
+#define SDPBIN_FLAG_REMOVABLE   0x100        /**< should the relaxation be removed from the LP due to aging or cleanup? */
+#define SDPBIN_FLAG_STICKING    0x200        /**< should the constraint always be kept at the node where it was added? */
+#define SDPBIN_FLAG_ALL         0x3ff        /**< all flags */
+
+
+/*
+ * Local methods
+ */
+
+/** reads an array from the file, returns whether it could be read completely */
+static
+SCIP_Bool readArray(
+   SCIP_FILE*            file,               /**< file to read from */
+   void*                 ptr,                /**< array to store the data in */
+   size_t                size,               /**< size of one element */
+   int                   n                   /**< number of elements */
+   )
+{
+   assert( file != NULL );
+   assert( n >= 0 );
+
+   if ( n == 0 )
+      return TRUE;
+
+   assert( ptr != NULL );
+
+   return SCIPfread(ptr, size, (size_t) n, file) == (size_t) n;
+}
+
+/** writes an array to the file */
+static
+SCIP_RETCODE writeArray(
+   FILE*                 file,               /**< file to write to */
+   const void*           ptr,                /**< array to write */
+   size_t                size,               /**< size of one element */
+   int                   n                   /**< number of elements */
+   )
+{
+   assert( file != NULL );
+   assert( n >= 0 );
+
+   if ( n == 0 )
+      return SCIP_OKAY;
+
+   assert( ptr != NULL );
+
+   if ( fwrite(ptr, size, (size_t) n, file) != (size_t) n )
+   {
+      SCIPerrorMessage("Could not write to file.\n");
+      return SCIP_WRITEERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** checks whether all entries of an index array are in the range [0, ub) */
+static
+SCIP_Bool indicesInRange(
+   const int*            ind,                /**< array of indices */
+   int                   n,                  /**< length of array */
+   int                   ub                  /**< upper bound on indices (exclusive) */
+   )
+{
+   int i;
+
+   for (i = 0; i < n; ++i)
+   {
+      if ( ind[i] < 0 || ind[i] >= ub )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** checks whether all variables of a constraint are variables of the problem to write, which have their position in
+ *  the variable array of the problem as problem index
+ *
+ *  Negated variables, for example, have no problem index and cannot be written.
+ */
+static
+SCIP_Bool varsWritable(
+   SCIP_VAR**            consvars,           /**< variables of the constraint */
+   int                   nconsvars,          /**< number of variables of the constraint */
+   SCIP_VAR**            vars,               /**< variables of the problem */
+   int                   nvars               /**< number of variables of the problem */
+   )
+{
+   int idx;
+   int v;
+
+   assert( consvars != NULL || nconsvars == 0 );
+
+   for (v = 0; v < nconsvars; ++v)
+   {
+      idx = SCIPvarGetProbindex(consvars[v]);
+      if ( idx < 0 || idx >= nvars || vars[idx] != consvars[v] )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** converts a bound of the file to a bound of SCIP */
+static
+SCIP_Real convertBound(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             bound,              /**< bound as stored in the file */
+   SCIP_Real             fileinfinity        /**< value of infinity of the file */
+   )
+{
+   if ( bound >= fileinfinity )
+      return SCIPinfinity(scip);
+   if ( bound <= -fileinfinity )
+      return -SCIPinfinity(scip);
+   return bound;
+}
+
+/** returns the number of names in the name array, i.e., the number of terminating zeros */
+static
+int countNames(
+   const char*           names,              /**< array of names */
+   int                   namelen             /**< total length of the names */
+   )
+{
+   int nnames = 0;
+   int i;
+
+   for (i = 0; i < namelen; ++i)
+   {
+      if ( names[i] == '\0' )
+         ++nnames;
+   }
+
+   return nnames;
+}
+
+/** returns the next name of the name array and moves the position behind its terminating zero */
+static
+const char* getNextName(
+   const char*           names,              /**< array of names */
+   int                   namelen,            /**< total length of the names */
+   int*                  pos                 /**< position of the next name (updated) */
+   )
+{
+   const char* name;
+
+   assert( pos != NULL );
+   assert( 0 <= *pos && *pos < namelen );
+
+   name = names + *pos;
+   *pos += (int) strlen(name) + 1;
+   assert( *pos <= namelen );
+
+   return name;
+}
+
+
+/*
+ * Callback methods of reader
+ */
+
+/** copy method for reader plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_READERCOPY(readerCopySdpbin)
+{  /*lint --e{715,818}*/
+   assert( scip != NULL );
+
+   SCIP_CALL( SCIPincludeReaderSdpbin(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** returns the flags of a constraint as a bitmask of SDPBIN_FLAG_* */
+static
+int getConsFlags(
+   SCIP_CONS*            cons                /**< constraint */
+   )
+{
+   int flags = 0;
+
+   assert( cons != NULL );
+
+   if ( SCIPconsIsInitial(cons) )
+      flags |= SDPBIN_FLAG_INITIAL;
+   if ( SCIPconsIsSeparated(cons) )
+      flags |= SDPBIN_FLAG_SEPARATE;
+   if ( SCIPconsIsEnforced(cons) )
+      flags |= SDPBIN_FLAG_ENFORCE;
+   if ( SCIPconsIsChecked(cons) )
+      flags |= SDPBIN_FLAG_CHECK;
+   if ( SCIPconsIsPropagated(cons) )
+      flags |= SDPBIN_FLAG_PROPAGATE;
+   if ( SCIPconsIsLocal(cons) )
+      flags |= SDPBIN_FLAG_LOCAL;
+   if ( SCIPconsIsModifiable(cons) )
+      flags |= SDPBIN_FLAG_MODIFIABLE;
+   if ( SCIPconsIsDynamic(cons) )
+      flags |= SDPBIN_FLAG_DYNAMIC;
+   if ( SCIPconsIsRemovable(cons) )
+      flags |= SDPBIN_FLAG_REMOVABLE;
+   if ( SCIPconsIsStickingAtNode(cons) )
+      flags |= SDPBIN_FLAG_STICKING;
+
+   return flags;
+}
+
+/** sets the flags of a constraint given as a bitmask of SDPBIN_FLAG_* */
+static
+SCIP_RETCODE setConsFlags(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint */
+   int                   flags               /**< bitmask of SDPBIN_FLAG_* */
+   )
+{
+   assert( scip != NULL );
+   assert( cons != NULL );
+   assert( (flags & ~SDPBIN_FLAG_ALL) == 0 );
+
+   SCIP_CALL( SCIPsetConsInitial(scip, cons, (flags & SDPBIN_FLAG_INITIAL) != 0) );
+   SCIP_CALL( SCIPsetConsSeparated(scip, cons, (flags & SDPBIN_FLAG_SEPARATE) != 0) );
+   SCIP_CALL( SCIPsetConsEnforced(scip, cons, (flags & SDPBIN_FLAG_ENFORCE) != 0) );
+   SCIP_CALL( SCIPsetConsChecked(scip, cons, (flags & SDPBIN_FLAG_CHECK) != 0) );
+   SCIP_CALL( SCIPsetConsPropagated(scip, cons, (flags & SDPBIN_FLAG_PROPAGATE) != 0) );
+   SCIP_CALL( SCIPsetConsLocal(scip, cons, (flags & SDPBIN_FLAG_LOCAL) != 0) );
+   SCIP_CALL( SCIPsetConsModifiable(scip, cons, (flags & SDPBIN_FLAG_MODIFIABLE) != 0) );
+   SCIP_CALL( SCIPsetConsDynamic(scip, cons, (flags & SDPBIN_FLAG_DYNAMIC) != 0) );
+   SCIP_CALL( SCIPsetConsRemovable(scip, cons, (flags & SDPBIN_FLAG_REMOVABLE) != 0) );
+   SCIP_CALL( SCIPsetConsStickingAtNode(scip, cons, (flags & SDPBIN_FLAG_STICKING) != 0) );
+
+   return SCIP_OKAY;
+}
+
+/** problem reading method of reader */
+static
+SCIP_DECL_READERREAD(readerReadSdpbin)
+{  /*lint --e{715,818}*/
+   SCIP_FILE* scipfile;
+   SCIP_VAR** createdvars = NULL;
+   SCIP_VAR** linvars = NULL;
+   SCIP_VAR** sdpvars = NULL;
+   SCIP_Real headerreals[SDPBIN_NREALS];
+   SCIP_Real* obj = NULL;
+   SCIP_Real* lb = NULL;
+   SCIP_Real* ub = NULL;
+   SCIP_Real* lhs = NULL;
+   SCIP_Real* rhs = NULL;
+   SCIP_Real* linval = NULL;
+   SCIP_Real* sdpvalblock = NULL;
+   SCIP_Real* sdpconstval = NULL;
+   SCIP_Real** sdpval = NULL;
+   SCIP_Bool success = FALSE;
+   char magic[SDPBIN_MAGICLEN];
+   char* names = NULL;
+   int headerints[SDPBIN_NINFO];
+   int* vartype = NULL;
+   int* linflags = NULL;
+   int* linbeg = NULL;
+   int* linind = NULL;
+   int* sdpinfo = NULL;
+   int* sdpvarind = NULL;
+   int* sdpnvarnonz = NULL;
+   int* sdprowblock = NULL;
+   int* sdpcolblock = NULL;
+   int* sdpconstrow = NULL;
+   int* sdpconstcol = NULL;
+   int** sdprow = NULL;
+   int** sdpcol = NULL;
+   int nvars = 0;
+   int nlinconss = 0;
+   int nsdpconss = 0;
+   int nlinnonz = 0;
+   int namelen = 0;
+   int namepos = 0;
+   int maxsdpnvars = 0;
+   int maxsdpnnonz = 0;
+   int maxsdpconstnnonz = 0;
+   int ncreatedvars = 0;
+   int c;
+   int v;
+
+   assert( result != NULL );
+
+   *result = SCIP_DIDNOTRUN;
+
+   SCIPdebugMsg(scip, "Reading file %s ...\n", filename);
+
+   scipfile = SCIPfopen(filename, "rb");
+
+   if ( ! scipfile )
+      return SCIP_READERROR;
+
+   /* read and check header */
+   if ( ! readArray(scipfile, magic, sizeof(char), SDPBIN_MAGICLEN) || strncmp(magic, SDPBIN_MAGIC, SDPBIN_MAGICLEN) != 0 )
+   {
+      SCIPerrorMessage("File <%s> is not in binary SCIP-SDP format.\n", filename);
+      goto TERMINATE;
+   }
+
+   if ( ! readArray(scipfile, headerints, sizeof(int), SDPBIN_NINFO) || ! readArray(scipfile, headerreals, sizeof(SCIP_Real), SDPBIN_NREALS) )
+   {
+      SCIPerrorMessage("Unexpected end of file in header of <%s>.\n", filename);
+      goto TERMINATE;
+   }
+
+   if ( headerints[SDPBIN_INFO_BYTEORDER] != SDPBIN_BYTEORDER || headerints[SDPBIN_INFO_INTSIZE] != (int) sizeof(int)
+      || headerints[SDPBIN_INFO_REALSIZE] != (int) sizeof(SCIP_Real) )
+   {
+      SCIPerrorMessage("File <%s> was written on a machine with different byte order or number sizes.\n", filename);
+      goto TERMINATE;
+   }
+
+   if ( headerints[SDPBIN_INFO_VERSION] != SDPBIN_VERSION )
+   {
+      SCIPerrorMessage("Version %d of file <%s> is not supported (expected version %d).\n", headerints[SDPBIN_INFO_VERSION],
+         filename, SDPBIN_VERSION);
+      goto TERMINATE;
+   }
+
+   nvars = headerints[SDPBIN_INFO_NVARS];
+   nlinconss = headerints[SDPBIN_INFO_NLINCONSS];
+   nsdpconss = headerints[SDPBIN_INFO_NSDPCONSS];
+   nlinnonz = headerints[SDPBIN_INFO_NLINNONZ];
+   namelen = headerints[SDPBIN_INFO_NAMELEN];
+
+   if ( nvars < 0 || nlinconss < 0 || nsdpconss < 0 || nlinnonz < 0 || namelen < nvars + nlinconss + nsdpconss
+      || (headerints[SDPBIN_INFO_OBJSENSE] != 1 && headerints[SDPBIN_INFO_OBJSENSE] != -1) )
+   {
+      SCIPerrorMessage("Invalid header in file <%s>.\n", filename);
+      goto TERMINATE;
+   }
+
+   /* read names */
+   SCIP_CALL( SCIPallocBufferArray(scip, &names, namelen) );
+   if ( ! readArray(scipfile, names, sizeof(char), namelen) || (namelen > 0 && names[namelen - 1] != '\0')
+      || countNames(names, namelen) != nvars + nlinconss + nsdpconss )
+   {
+      SCIPerrorMessage("Could not read names in file <%s>.\n", filename);
+      goto TERMINATE;
+   }
+
+   /* read variables */
+   SCIP_CALL( SCIPallocBufferArray(scip, &obj, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lb, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ub, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vartype, nvars) );
+
+   if ( ! readArray(scipfile, obj, sizeof(SCIP_Real), nvars) || ! readArray(scipfile, lb, sizeof(SCIP_Real), nvars)
+      || ! readArray(scipfile, ub, sizeof(SCIP_Real), nvars) || ! readArray(scipfile, vartype, sizeof(int), nvars) )
+   {
+      SCIPerrorMessage("Could not read variables in file <%s>.\n", filename);
+      goto TERMINATE;
+   }
+
+   /* read linear constraints */
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhs, nlinconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhs, nlinconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &linflags, nlinconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &linbeg, nlinconss + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &linind, nlinnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &linval, nlinnonz) );
+
+   if ( ! readArray(scipfile, lhs, sizeof(SCIP_Real), nlinconss) || ! readArray(scipfile, rhs, sizeof(SCIP_Real), nlinconss)
+      || ! readArray(scipfile, linflags, sizeof(int), nlinconss) || ! readArray(scipfile, linbeg, sizeof(int), nlinconss + 1) || ! readArray(scipfile, linind, sizeof(int), nlinnonz)
+      || ! readArray(scipfile, linval, sizeof(SCIP_Real), nlinnonz) )
+   {
+      SCIPerrorMessage("Could not read linear constraints in file <%s>.\n", filename);
+      goto TERMINATE;
+   }
+
+   if ( linbeg[0] != 0 || linbeg[nlinconss] != nlinnonz || ! indicesInRange(linind, nlinnonz, nvars) )
+   {
+      SCIPerrorMessage("Invalid linear constraints in file <%s>.\n", filename);
+      goto TERMINATE;
+   }
+
+   for (c = 0; c < nlinconss; ++c)
+   {
+      if ( linbeg[c] > linbeg[c + 1] || (linflags[c] & ~SDPBIN_FLAG_ALL) != 0 )
+      {
+         SCIPerrorMessage("Invalid linear constraints in file <%s>.\n", filename);
+         goto TERMINATE;
+      }
+   }
+
+   /* read sizes of SDP constraints */
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpinfo, SDPBIN_NSDPINFO * nsdpconss) );
+   if ( ! readArray(scipfile, sdpinfo, sizeof(int), SDPBIN_NSDPINFO * nsdpconss) )
+   {
+      SCIPerrorMessage("Could not read SDP constraints in file <%s>.\n", filename);
+      goto TERMINATE;
+   }
+
+   for (c = 0; c < nsdpconss; ++c)
+   {
+      const int* info = sdpinfo + SDPBIN_NSDPINFO * c;
+
+      if ( info[SDPBIN_SDP_BLOCKSIZE] < 0 || info[SDPBIN_SDP_NVARS] < 0 || info[SDPBIN_SDP_NNONZ] < 0 || info[SDPBIN_SDP_CONSTNNONZ] < 0
+         || (info[SDPBIN_SDP_FLAGS] & ~SDPBIN_FLAG_ALL) != 0 )
+      {
+         SCIPerrorMessage("Invalid SDP constraint in file <%s>.\n", filename);
+         goto TERMINATE;
+      }
+
+      maxsdpnvars = MAX(maxsdpnvars, info[SDPBIN_SDP_NVARS]);
+      maxsdpnnonz = MAX(maxsdpnnonz, info[SDPBIN_SDP_NNONZ]);
+      maxsdpconstnnonz = MAX(maxsdpconstnnonz, info[SDPBIN_SDP_CONSTNNONZ]);
+   }
+
+   /* create problem and variables */
+   SCIP_CALL( SCIPcreateProb(scip, filename, NULL, NULL, NULL, NULL, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPsetObjsense(scip, headerints[SDPBIN_INFO_OBJSENSE] == 1 ? SCIP_OBJSENSE_MINIMIZE : SCIP_OBJSENSE_MAXIMIZE) );
+   if ( headerreals[SDPBIN_REAL_OBJOFFSET] != 0.0 )
+   {
+      SCIP_CALL( SCIPaddOrigObjoffset(scip, headerreals[SDPBIN_REAL_OBJOFFSET]) );
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &createdvars, nvars) );
+   for (v = 0; v < nvars; ++v)
+   {
+      if ( vartype[v] < (int) SCIP_VARTYPE_BINARY || vartype[v] > (int) SCIP_VARTYPE_CONTINUOUS )
+      {
+         SCIPerrorMessage("Invalid type of variable %d in file <%s>.\n", v, filename);
+         goto TERMINATE;
+      }
+
+      SCIP_CALL( SCIPcreateVar(scip, &createdvars[v], getNextName(names, namelen, &namepos),
+            convertBound(scip, lb[v], headerreals[SDPBIN_REAL_INFINITY]), convertBound(scip, ub[v], headerreals[SDPBIN_REAL_INFINITY]),
+            obj[v], (SCIP_VARTYPE) vartype[v], TRUE, FALSE, NULL, NULL, NULL, NULL, NULL) );
+      ++ncreatedvars;
+
+      SCIP_CALL( SCIPaddVar(scip, createdvars[v]) );
+   }
+
+   /* create linear constraints */
+   SCIP_CALL( SCIPallocBufferArray(scip, &linvars, nlinnonz) );
+   for (v = 0; v < nlinnonz; ++v)
+      linvars[v] = createdvars[linind[v]];
+
+   for (c = 0; c < nlinconss; ++c)
+   {
+      SCIP_CONS* cons;
+
+      SCIP_CALL( SCIPcreateConsLinear(scip, &cons, getNextName(names, namelen, &namepos), linbeg[c + 1] - linbeg[c],
+            linvars + linbeg[c], linval + linbeg[c], convertBound(scip, lhs[c], headerreals[SDPBIN_REAL_INFINITY]),
+            convertBound(scip, rhs[c], headerreals[SDPBIN_REAL_INFINITY]),
+            (linflags[c] & SDPBIN_FLAG_INITIAL) != 0, (linflags[c] & SDPBIN_FLAG_SEPARATE) != 0,
+            (linflags[c] & SDPBIN_FLAG_ENFORCE) != 0, (linflags[c] & SDPBIN_FLAG_CHECK) != 0,
+            (linflags[c] & SDPBIN_FLAG_PROPAGATE) != 0, (linflags[c] & SDPBIN_FLAG_LOCAL) != 0,
+            (linflags[c] & SDPBIN_FLAG_MODIFIABLE) != 0, (linflags[c] & SDPBIN_FLAG_DYNAMIC) != 0,
+            (linflags[c] & SDPBIN_FLAG_REMOVABLE) != 0, (linflags[c] & SDPBIN_FLAG_STICKING) != 0) );
+
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   /* create SDP constraints; the arrays are allocated once for the largest constraint */
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpvars, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpvarind, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpnvarnonz, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdprow, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpcol, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpval, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdprowblock, maxsdpnnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpcolblock, maxsdpnnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpvalblock, maxsdpnnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpconstrow, maxsdpconstnnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpconstcol, maxsdpconstnnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpconstval, maxsdpconstnnonz) );
+
+   for (c = 0; c < nsdpconss; ++c)
+   {
+      const int* info = sdpinfo + SDPBIN_NSDPINFO * c;
+      SCIP_CONS* cons;
+      int blocksize;
+      int sdpnvars;
+      int sdpnnonz;
+      int sdpconstnnonz;
+      int pos = 0;
+      int i;
+
+      blocksize = info[SDPBIN_SDP_BLOCKSIZE];
+      sdpnvars = info[SDPBIN_SDP_NVARS];
+      sdpnnonz = info[SDPBIN_SDP_NNONZ];
+      sdpconstnnonz = info[SDPBIN_SDP_CONSTNNONZ];
+
+      if ( ! readArray(scipfile, sdpvarind, sizeof(int), sdpnvars) || ! readArray(scipfile, sdpnvarnonz, sizeof(int), sdpnvars)
+         || ! readArray(scipfile, sdprowblock, sizeof(int), sdpnnonz) || ! readArray(scipfile, sdpcolblock, sizeof(int), sdpnnonz)
+         || ! readArray(scipfile, sdpvalblock, sizeof(SCIP_Real), sdpnnonz)
+         || ! readArray(scipfile, sdpconstrow, sizeof(int), sdpconstnnonz) || ! readArray(scipfile, sdpconstcol, sizeof(int), sdpconstnnonz)
+         || ! readArray(scipfile, sdpconstval, sizeof(SCIP_Real), sdpconstnnonz) )
+      {
+         SCIPerrorMessage("Could not read SDP constraint %d in file <%s>.\n", c, filename);
+         goto TERMINATE;
+      }
+
+      if ( ! indicesInRange(sdpvarind, sdpnvars, nvars) || ! indicesInRange(sdprowblock, sdpnnonz, blocksize)
+         || ! indicesInRange(sdpcolblock, sdpnnonz, blocksize) || ! indicesInRange(sdpconstrow, sdpconstnnonz, blocksize)
+         || ! indicesInRange(sdpconstcol, sdpconstnnonz, blocksize) )
+      {
+         SCIPerrorMessage("Index out of range in SDP constraint %d in file <%s>.\n", c, filename);
+         goto TERMINATE;
+      }
+
+      /* set pointers of the variables into the nonzero arrays */
+      for (v = 0; v < sdpnvars; ++v)
+      {
+         if ( sdpnvarnonz[v] < 0 || pos + sdpnvarnonz[v] > sdpnnonz )
+         {
+            SCIPerrorMessage("Invalid number of nonzeros in SDP constraint %d in file <%s>.\n", c, filename);
+            goto TERMINATE;
+         }
+
+         sdpvars[v] = createdvars[sdpvarind[v]];
+         sdprow[v] = sdprowblock + pos;
+         sdpcol[v] = sdpcolblock + pos;
+         sdpval[v] = sdpvalblock + pos;
+         pos += sdpnvarnonz[v];
+      }
+
+      if ( pos != sdpnnonz )
+      {
+         SCIPerrorMessage("Invalid number of nonzeros in SDP constraint %d in file <%s>.\n", c, filename);
+         goto TERMINATE;
+      }
+
+      /* only the lower triangular part is stored */
+      for (i = 0; i < sdpnnonz; ++i)
+      {
+         if ( sdprowblock[i] < sdpcolblock[i] )
+            break;
+      }
+      if ( i < sdpnnonz )
+      {
+         SCIPerrorMessage("Entry above the diagonal in SDP constraint %d in file <%s>.\n", c, filename);
+         goto TERMINATE;
+      }
+
+      for (i = 0; i < sdpconstnnonz; ++i)
+      {
+         if ( sdpconstrow[i] < sdpconstcol[i] )
+            break;
+      }
+      if ( i < sdpconstnnonz )
+      {
+         SCIPerrorMessage("Entry above the diagonal in constant part of SDP constraint %d in file <%s>.\n", c, filename);
+         goto TERMINATE;
+      }
+
+      if ( info[SDPBIN_SDP_RANKONE] )
+      {
+         SCIP_CALL( SCIPcreateConsSdpRank1(scip, &cons, getNextName(names, namelen, &namepos), sdpnvars, sdpnnonz, blocksize,
+               sdpnvarnonz, sdpcol, sdprow, sdpval, sdpvars, sdpconstnnonz, sdpconstcol, sdpconstrow, sdpconstval, FALSE) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPcreateConsSdp(scip, &cons, getNextName(names, namelen, &namepos), sdpnvars, sdpnnonz, blocksize,
+               sdpnvarnonz, sdpcol, sdprow, sdpval, sdpvars, sdpconstnnonz, sdpconstcol, sdpconstrow, sdpconstval, FALSE) );
+      }
+
+      /* SCIPcreateConsSdp() and SCIPcreateConsSdpRank1() use default flags */
+      SCIP_CALL( setConsFlags(scip, cons, info[SDPBIN_SDP_FLAGS]) );
+
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   success = TRUE;
+   *result = SCIP_SUCCESS;
+
+ TERMINATE:
+   for (v = 0; v < ncreatedvars; ++v)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &createdvars[v]) );
+   }
+
+   SCIPfreeBufferArrayNull(scip, &sdpconstval);
+   SCIPfreeBufferArrayNull(scip, &sdpconstcol);
+   SCIPfreeBufferArrayNull(scip, &sdpconstrow);
+   SCIPfreeBufferArrayNull(scip, &sdpvalblock);
+   SCIPfreeBufferArrayNull(scip, &sdpcolblock);
+   SCIPfreeBufferArrayNull(scip, &sdprowblock);
+   SCIPfreeBufferArrayNull(scip, &sdpval);
+   SCIPfreeBufferArrayNull(scip, &sdpcol);
+   SCIPfreeBufferArrayNull(scip, &sdprow);
+   SCIPfreeBufferArrayNull(scip, &sdpnvarnonz);
+   SCIPfreeBufferArrayNull(scip, &sdpvarind);
+   SCIPfreeBufferArrayNull(scip, &sdpvars);
+   SCIPfreeBufferArrayNull(scip, &linvars);
+   SCIPfreeBufferArrayNull(scip, &createdvars);
+   SCIPfreeBufferArrayNull(scip, &sdpinfo);
+   SCIPfreeBufferArrayNull(scip, &linval);
+   SCIPfreeBufferArrayNull(scip, &linind);
+   SCIPfreeBufferArrayNull(scip, &linbeg);
+   SCIPfreeBufferArrayNull(scip, &linflags);
+   SCIPfreeBufferArrayNull(scip, &rhs);
+   SCIPfreeBufferArrayNull(scip, &lhs);
+   SCIPfreeBufferArrayNull(scip, &vartype);
+   SCIPfreeBufferArrayNull(scip, &ub);
+   SCIPfreeBufferArrayNull(scip, &lb);
+   SCIPfreeBufferArrayNull(scip, &obj);
+   SCIPfreeBufferArrayNull(scip, &names);
+
+   SCIPfclose(scipfile);
+
+   if ( ! success )
+      return SCIP_READERROR;
+
+   return SCIP_OKAY;
+}
+
+/** problem writing method of reader */
+static
+SCIP_DECL_READERWRITE(readerWriteSdpbin)
+{  /*lint --e{715,818}*/
+   SCIP_VAR** sdpvars;
+   SCIP_Real headerreals[SDPBIN_NREALS];
+   SCIP_Real* realbuffer;
+   SCIP_Real* sdpconstval;
+   SCIP_Real** sdpval;
+   int headerints[SDPBIN_NINFO];
+   int* intbuffer;
+   int* sdpinfo;
+   int* sdpnvarnonz;
+   int* sdpconstcol;
+   int* sdpconstrow;
+   int** sdpcol;
+   int** sdprow;
+   int nlinconss = 0;
+   int nsdpconss = 0;
+   int nlinnonz = 0;
+   int namelen = 0;
+   int maxlinnvars = 0;
+   int maxsdpnvars = 0;
+   int maxsdpconstnnonz = 0;
+   int nbuffer;
+   int c;
+   int v;
+
+   assert( scip != NULL );
+   assert( result != NULL );
+
+   SCIPdebugMsg(scip, "Writing problem in binary SCIP-SDP format to file.\n");
+   *result = SCIP_DIDNOTRUN;
+
+   if ( transformed )
+   {
+      SCIPerrorMessage("Binary SCIP-SDP reader currently only supports writing original problems!\n");
+      return SCIP_READERROR; /*lint !e527*/
+   }
+
+   if ( file == NULL )
+   {
+      SCIPerrorMessage("Binary SCIP-SDP format cannot be written to standard output!\n");
+      return SCIP_WRITEERROR; /*lint !e527*/
+   }
+
+   /* count constraints, nonzeros and length of names */
+   for (v = 0; v < nvars; ++v)
+   {
+      assert( SCIPvarGetStatus(vars[v]) == SCIP_VARSTATUS_ORIGINAL );
+      assert( SCIPvarGetProbindex(vars[v]) == v );
+      namelen += (int) strlen(SCIPvarGetName(vars[v])) + 1;
+   }
+
+   for (c = 0; c < nconss; ++c)
+   {
+      const char* conshdlrname;
+
+      conshdlrname = SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c]));
+
+      if ( strcmp(conshdlrname, "linear") == 0 )
+      {
+         /* variables are written by their index, so check them before anything is written */
+         if ( ! varsWritable(SCIPgetVarsLinear(scip, conss[c]), SCIPgetNVarsLinear(scip, conss[c]), vars, nvars) )
+         {
+            SCIPerrorMessage("Linear constraint <%s> contains a variable that is not a problem variable (e.g., a negated variable), which cannot be written in binary SCIP-SDP format!\n",
+               SCIPconsGetName(conss[c]));
+            return SCIP_WRITEERROR; /*lint !e527*/
+         }
+
+         ++nlinconss;
+         nlinnonz += SCIPgetNVarsLinear(scip, conss[c]);
+         maxlinnvars = MAX(maxlinnvars, SCIPgetNVarsLinear(scip, conss[c]));
+      }
+      else if ( strcmp(conshdlrname, "SDP") == 0 || strcmp(conshdlrname, "SDPrank1") == 0 )
+      {
+         int sdpconstnnonz;
+
+         if ( ! varsWritable(SCIPconsSdpGetVars(scip, conss[c]), SCIPconsSdpGetNVars(scip, conss[c]), vars, nvars) )
+         {
+            SCIPerrorMessage("SDP constraint <%s> contains a variable that is not a problem variable (e.g., a negated variable), which cannot be written in binary SCIP-SDP format!\n",
+               SCIPconsGetName(conss[c]));
+            return SCIP_WRITEERROR; /*lint !e527*/
+         }
+
+         ++nsdpconss;
+         SCIP_CALL( SCIPconsSdpGetNNonz(scip, conss[c], NULL, &sdpconstnnonz) );
+         maxsdpnvars = MAX(maxsdpnvars, SCIPconsSdpGetNVars(scip, conss[c]));
+         maxsdpconstnnonz = MAX(maxsdpconstnnonz, sdpconstnnonz);
+      }
+      else
+      {
+         SCIPerrorMessage("Binary SCIP-SDP reader currently only supports linear and SDP constraints!\n");
+         return SCIP_READERROR; /*lint !e527*/
+      }
+
+      namelen += (int) strlen(SCIPconsGetName(conss[c])) + 1;
+   }
+
+   /* write header */
+   headerints[SDPBIN_INFO_VERSION] = SDPBIN_VERSION;
+   headerints[SDPBIN_INFO_BYTEORDER] = SDPBIN_BYTEORDER;
+   headerints[SDPBIN_INFO_INTSIZE] = (int) sizeof(int);
+   headerints[SDPBIN_INFO_REALSIZE] = (int) sizeof(SCIP_Real);
+   headerints[SDPBIN_INFO_OBJSENSE] = objsense == SCIP_OBJSENSE_MINIMIZE ? 1 : -1;
+   headerints[SDPBIN_INFO_NVARS] = nvars;
+   headerints[SDPBIN_INFO_NLINCONSS] = nlinconss;
+   headerints[SDPBIN_INFO_NSDPCONSS] = nsdpconss;
+   headerints[SDPBIN_INFO_NLINNONZ] = nlinnonz;
+   headerints[SDPBIN_INFO_NAMELEN] = namelen;
+
+   headerreals[SDPBIN_REAL_OBJOFFSET] = objoffset;
+   headerreals[SDPBIN_REAL_INFINITY] = SCIPinfinity(scip);
+
+   SCIP_CALL( writeArray(file, SDPBIN_MAGIC, sizeof(char), SDPBIN_MAGICLEN) );
+   SCIP_CALL( writeArray(file, headerints, sizeof(int), SDPBIN_NINFO) );
+   SCIP_CALL( writeArray(file, headerreals, sizeof(SCIP_Real), SDPBIN_NREALS) );
+
+   /* write names: variables, linear constraints, SDP constraints */
+   for (v = 0; v < nvars; ++v)
+   {
+      SCIP_CALL( writeArray(file, SCIPvarGetName(vars[v]), sizeof(char), (int) strlen(SCIPvarGetName(vars[v])) + 1) );
+   }
+
+   for (c = 0; c < nconss; ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") != 0 )
+         continue;
+      SCIP_CALL( writeArray(file, SCIPconsGetName(conss[c]), sizeof(char), (int) strlen(SCIPconsGetName(conss[c])) + 1) );
+   }
+
+   for (c = 0; c < nconss; ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") == 0 )
+         continue;
+      SCIP_CALL( writeArray(file, SCIPconsGetName(conss[c]), sizeof(char), (int) strlen(SCIPconsGetName(conss[c])) + 1) );
+   }
+
+   /* the buffers are used for all arrays of variables and linear constraints */
+   nbuffer = MAX3(nvars, nlinconss + 1, maxlinnvars);
+   SCIP_CALL( SCIPallocBufferArray(scip, &realbuffer, nbuffer) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &intbuffer, nbuffer) );
+
+   /* write variables */
+   for (v = 0; v < nvars; ++v)
+      realbuffer[v] = SCIPvarGetObj(vars[v]);
+   SCIP_CALL( writeArray(file, realbuffer, sizeof(SCIP_Real), nvars) );
+
+   for (v = 0; v < nvars; ++v)
+      realbuffer[v] = SCIPvarGetLbOriginal(vars[v]);
+   SCIP_CALL( writeArray(file, realbuffer, sizeof(SCIP_Real), nvars) );
+
+   for (v = 0; v < nvars; ++v)
+      realbuffer[v] = SCIPvarGetUbOriginal(vars[v]);
+   SCIP_CALL( writeArray(file, realbuffer, sizeof(SCIP_Real), nvars) );
+
+   for (v = 0; v < nvars; ++v)
+      intbuffer[v] = (int) SCIPvarGetType(vars[v]);
+   SCIP_CALL( writeArray(file, intbuffer, sizeof(int), nvars) );
+
+   /* write sides of linear constraints */
+   nlinconss = 0;
+   for (c = 0; c < nconss; ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") == 0 )
+         realbuffer[nlinconss++] = SCIPgetLhsLinear(scip, conss[c]);
+   }
+   SCIP_CALL( writeArray(file, realbuffer, sizeof(SCIP_Real), nlinconss) );
+
+   nlinconss = 0;
+   for (c = 0; c < nconss; ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") == 0 )
+         realbuffer[nlinconss++] = SCIPgetRhsLinear(scip, conss[c]);
+   }
+   SCIP_CALL( writeArray(file, realbuffer, sizeof(SCIP_Real), nlinconss) );
+
+   /* write flags of linear constraints */
+   nlinconss = 0;
+   for (c = 0; c < nconss; ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") == 0 )
+         intbuffer[nlinconss++] = getConsFlags(conss[c]);
+   }
+   SCIP_CALL( writeArray(file, intbuffer, sizeof(int), nlinconss) );
+
+   /* write begin of linear constraints in nonzero arrays */
+   nlinconss = 0;
+   intbuffer[0] = 0;
+   for (c = 0; c < nconss; ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") == 0 )
+      {
+         intbuffer[nlinconss + 1] = intbuffer[nlinconss] + SCIPgetNVarsLinear(scip, conss[c]);
+         ++nlinconss;
+      }
+   }
+   assert( intbuffer[nlinconss] == nlinnonz );
+   SCIP_CALL( writeArray(file, intbuffer, sizeof(int), nlinconss + 1) );
+
+   /* write variable indices and values of linear nonzeros */
+   for (c = 0; c < nconss; ++c)
+   {
+      SCIP_VAR** linvars;
+
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") != 0 )
+         continue;
+
+      linvars = SCIPgetVarsLinear(scip, conss[c]);
+      for (v = 0; v < SCIPgetNVarsLinear(scip, conss[c]); ++v)
+      {
+         intbuffer[v] = SCIPvarGetProbindex(linvars[v]);
+         assert( 0 <= intbuffer[v] && intbuffer[v] < nvars );
+      }
+      SCIP_CALL( writeArray(file, intbuffer, sizeof(int), SCIPgetNVarsLinear(scip, conss[c])) );
+   }
+
+   for (c = 0; c < nconss; ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") != 0 )
+         continue;
+
+      SCIP_CALL( writeArray(file, SCIPgetValsLinear(scip, conss[c]), sizeof(SCIP_Real), SCIPgetNVarsLinear(scip, conss[c])) );
+   }
+
+   SCIPfreeBufferArray(scip, &intbuffer);
+   SCIPfreeBufferArray(scip, &realbuffer);
+
+   /* write sizes and flags of SDP constraints */
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpinfo, SDPBIN_NSDPINFO * nsdpconss) );
+   nsdpconss = 0;
+   for (c = 0; c < nconss; ++c)
+   {
+      int* info;
+
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") == 0 )
+         continue;
+
+      info = sdpinfo + SDPBIN_NSDPINFO * nsdpconss;
+      info[SDPBIN_SDP_BLOCKSIZE] = SCIPconsSdpGetBlocksize(scip, conss[c]);
+      info[SDPBIN_SDP_RANKONE] = strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "SDPrank1") == 0 ? 1 : 0;
+      info[SDPBIN_SDP_NVARS] = SCIPconsSdpGetNVars(scip, conss[c]);
+      SCIP_CALL( SCIPconsSdpGetNNonz(scip, conss[c], &info[SDPBIN_SDP_NNONZ], &info[SDPBIN_SDP_CONSTNNONZ]) );
+      info[SDPBIN_SDP_FLAGS] = getConsFlags(conss[c]);
+      ++nsdpconss;
+   }
+   SCIP_CALL( writeArray(file, sdpinfo, sizeof(int), SDPBIN_NSDPINFO * nsdpconss) );
+
+   /* write data of SDP constraints; the nonzeros are written directly from the arrays of the constraints */
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpvars, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &intbuffer, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpnvarnonz, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpcol, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdprow, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpval, maxsdpnvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpconstcol, maxsdpconstnnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpconstrow, maxsdpconstnnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sdpconstval, maxsdpconstnnonz) );
+
+   for (c = 0; c < nconss; ++c)
+   {
+      int sdpnvars;
+      int sdpnnonz;
+      int sdpblocksize;
+      int sdparraylength;
+      int sdpconstnnonz;
+
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear") == 0 )
+         continue;
+
+      sdparraylength = maxsdpnvars;
+      sdpconstnnonz = maxsdpconstnnonz;
+      SCIP_CALL( SCIPconsSdpGetData(scip, conss[c], &sdpnvars, &sdpnnonz, &sdpblocksize, &sdparraylength, sdpnvarnonz,
+            sdpcol, sdprow, sdpval, sdpvars, &sdpconstnnonz, sdpconstcol, sdpconstrow, sdpconstval, NULL, NULL, NULL) );
+      assert( sdparraylength <= maxsdpnvars );
+      assert( sdpconstnnonz <= maxsdpconstnnonz );
+
+      for (v = 0; v < sdpnvars; ++v)
+      {
+         intbuffer[v] = SCIPvarGetProbindex(sdpvars[v]);
+         assert( 0 <= intbuffer[v] && intbuffer[v] < nvars );
+      }
+      SCIP_CALL( writeArray(file, intbuffer, sizeof(int), sdpnvars) );
+      SCIP_CALL( writeArray(file, sdpnvarnonz, sizeof(int), sdpnvars) );
+
+      for (v = 0; v < sdpnvars; ++v)
+      {
+         SCIP_CALL( writeArray(file, sdprow[v], sizeof(int), sdpnvarnonz[v]) );
+      }
+      for (v = 0; v < sdpnvars; ++v)
+      {
+         SCIP_CALL( writeArray(file, sdpcol[v], sizeof(int), sdpnvarnonz[v]) );
+      }
+      for (v = 0; v < sdpnvars; ++v)
+      {
+         SCIP_CALL( writeArray(file, sdpval[v], sizeof(SCIP_Real), sdpnvarnonz[v]) );
+      }
+
+      SCIP_CALL( writeArray(file, sdpconstrow, sizeof(int), sdpconstnnonz) );
+      SCIP_CALL( writeArray(file, sdpconstcol, sizeof(int), sdpconstnnonz) );
+      SCIP_CALL( writeArray(file, sdpconstval, sizeof(SCIP_Real), sdpconstnnonz) );
+   }
+
+   SCIPfreeBufferArray(scip, &sdpconstval);
+   SCIPfreeBufferArray(scip, &sdpconstrow);
+   SCIPfreeBufferArray(scip, &sdpconstcol);
+   SCIPfreeBufferArray(scip, &sdpval);
+   SCIPfreeBufferArray(scip, &sdprow);
+   SCIPfreeBufferArray(scip, &sdpcol);
+   SCIPfreeBufferArray(scip, &sdpnvarnonz);
+   SCIPfreeBufferArray(scip, &intbuffer);
+   SCIPfreeBufferArray(scip, &sdpvars);
+   SCIPfreeBufferArray(scip, &sdpinfo);
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * reader specific interface methods
+ */
+
+/** includes the binary file reader for MISDPs in SCIP */
+SCIP_RETCODE SCIPincludeReaderSdpbin(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_READER* reader;
+
+   /* include reader */
+   SCIP_CALL( SCIPincludeReaderBasic(scip, &reader, READER_NAME, READER_DESC, READER_EXTENSION, NULL) );
+
+   assert( reader != NULL );
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetReaderCopy(scip, reader, readerCopySdpbin) );
+   SCIP_CALL( SCIPsetReaderRead(scip, reader, readerReadSdpbin) );
+   SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteSdpbin) );
+
+   return SCIP_OKAY;
+}
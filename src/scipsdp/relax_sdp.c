@@ -93,6 +93,10 @@
 #define DEFAULT_SETTINGSRESETFREQ   -1       /**< frequency for resetting parameters in SDP solver and trying again with fastest settings */
 #define DEFAULT_SETTINGSRESETOFS    0        /**< frequency offset for resetting parameters in SDP solver and trying again with fastest settings */
 #define DEFAULT_SDPSOLVERTHREADS    1        /**< number of threads the SDP solver should use (-1 = number of cores) */
+#define DEFAULT_PROBINGGAPTOL       1e-3     /**< gap tolerance of the SDP solver in low-accuracy probing mode (used by diving heuristics) */
+#define DEFAULT_PROBINGMAXITER      -1       /**< maximal number of SDP iterations in low-accuracy probing mode (-1 = solver default) */
+#define DEFAULT_PROBINGWARMSTART    TRUE     /**< Should the dual vector of the previous probing SDP be used as starting point in low-accuracy probing mode? */
+#define DEFAULT_MEMORYTHRESHOLD     0.9      /**< fraction of limits/memory from which on optional data of SCIP-SDP is freed (1.0: never) */
 #define DEFAULT_PENINFEASADJUST     1.1      /**< gap- or feastol will be multiplied by this before checking for infeasibility using the penalty formulation */
 #define DEFAULT_USEPRESOLVING       FALSE    /**< whether presolving of SDP-solver should be used */
 #define DEFAULT_USESCALING          TRUE     /**< whether the SDP-solver should use scaling */
@@ -163,6 +167,19 @@ struct SCIP_RelaxData
    int                   settingsresetofs;   /**< frequency offset for resetting parameters in SDP solver and trying again with fastest settings */
    int                   sdpsolverthreads;   /**< number of threads the SDP solver should use, not supported by all solvers (-1 = number of cores) */
 
+   SCIP_Bool             lowaccprobing;      /**< Are probing SDPs currently solved in low-accuracy mode (set by diving heuristics)? */
+   SCIP_Real             probinggaptol;      /**< gap tolerance of the SDP solver in low-accuracy probing mode */
+   int                   probingmaxiter;     /**< maximal number of SDP iterations in low-accuracy probing mode (-1 = solver default) */
+   SCIP_Bool             probingwarmstart;   /**< Should the dual vector of the previous probing SDP be used as starting point in low-accuracy probing mode? */
+   SCIP_Real*            probingwarmy;       /**< dual vector of the last probing SDP solved in low-accuracy mode */
+   int                   probingwarmysize;   /**< length of the probingwarmy array */
+   SCIP_Bool             probingwarmyexists; /**< Does probingwarmy contain a solution of the current dive? */
+   SCIP_SDPSOLVERSETTING probingsetting;     /**< settings used for the last probing SDP solved in low-accuracy mode */
+
+   SCIP_Real             memorythreshold;    /**< fraction of limits/memory from which on optional data of SCIP-SDP is freed (1.0: never) */
+   int                   memorylevel;        /**< number of memory saving steps applied in the current solving process */
+   int                   origwarmstartproject; /**< value of warmstartproject before it was changed to save memory (or -1) */
+
    int                   sdpcalls;           /**< number of solved SDPs (used to compute average SDP iterations), different settings tried are counted as multiple calls */
    int                   sdpinterfacecalls;  /**< number of times the SDP interfaces was called (used to compute slater statistics) */
    SCIP_Real             sdpopttime;         /**< time used in optimization calls of solver */
@@ -236,6 +253,8 @@ struct SCIP_RelaxData
 
    SCIP_CONSHDLR*        sdpconshdlr;        /**< SDP constraint handler */
    SCIP_CONSHDLR*        sdprank1conshdlr;   /**< SDP rank 1 constraint handler */
+   SCIP_CONSHDLR*        savesdpsolconshdlr; /**< constraint handler storing the SDP solutions of the nodes */
+   SCIP_CONSHDLR*        savedsettingsconshdlr; /**< constraint handler storing the SDP solver settings of the nodes */
 };
 
 /** expand sparse matrix to full matrix format needed by LAPACK */
@@ -1645,10 +1664,6 @@ SCIP_RETCODE solvePrimalRoundingProblem(
    SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
    assert( nrows == 0 || rows != NULL );
 
-   /* if the number of LP constraints is not the same, we proceed without warmstart */
-   if ( SCIPconsSavesdpsolGetNLPcons(scip, cons) != nrows )
-      return SCIP_OKAY;
-
    /* get some data */
    nvars = SCIPgetNVars(scip);
    assert( nvars >= 0 );
@@ -1680,7 +1695,9 @@ SCIP_RETCODE solvePrimalRoundingProblem(
    SCIP_CALL( SCIPallocBufferArray(scip, &(*startXval)[nblocks], 2 * nvars + 2 * nrows) );
    (*startXnblocknonz)[nblocks] = 2 * nvars + 2 * nrows;
 
-   SCIP_CALL( SCIPconsSavesdpsolGetPrimalMatrix(scip, cons, nblocks + 1, *startXnblocknonz, *startXrow, *startXcol, *startXval) );
+   /* get saved primal matrix; the LP block is mapped to the current LP rows */
+   SCIP_CALL( SCIPconsSavesdpsolGetPrimalMatrix(scip, cons, nblocks + 1, nrows, rows, relaxdata->warmstartmevprimal,
+         *startXnblocknonz, *startXrow, *startXcol, *startXval) );
 
    lpi = relaxdata->lpi;
 
@@ -2465,7 +2482,7 @@ SCIP_RETCODE solvePrimalRoundingProblem(
             char consname[SCIP_MAXSTRLEN];
 
             (void) SCIPsnprintf(consname, SCIP_MAXSTRLEN, "saved_relax_sol_%d", SCIPnodeGetNumber(SCIPgetCurrentNode(scip)));
-            SCIP_CALL( createConsSavesdpsol(scip, &savedcons, consname, SCIPnodeGetNumber(SCIPgetCurrentNode(scip)), SCIPgetNLPRows(scip), scipsol,
+            SCIP_CALL( createConsSavesdpsol(scip, &savedcons, consname, SCIPnodeGetNumber(SCIPgetCurrentNode(scip)), nrows, rows, scipsol,
                   maxprimalentry, nblocks + 1, *startXnblocknonz, *startXrow, *startXcol, *startXval) );
 
             SCIP_CALL( SCIPaddCons(scip, savedcons) );
@@ -3060,7 +3077,6 @@ SCIP_RETCODE determineWarmStartInformation(
    SCIP_RESULT*          result              /**< result pointer */
    )
 {
-   SCIP_CONS** conss;
    int nblocks;
    int nvars;
    int nrows;
@@ -3143,46 +3159,28 @@ SCIP_RETCODE determineWarmStartInformation(
    }
    else
    {
-      SCIP_CONSHDLR* conshdlr;
       SCIP_SOL* dualsol;
       SCIP_CONS** sdpblocks = NULL;
+      SCIP_ROW** rows;
       SCIP_VAR* var;
       SCIP_Longint parentnodenumber;
       SCIP_CONS* savesdpsolcons;
-      int parentconsind;
-
-      /* find starting solution as optimal solution of parent node */
 
-      /* get constraint handler */
-      conshdlr = SCIPfindConshdlr(scip, "Savesdpsol");
-      if ( conshdlr == NULL )
-      {
-         SCIPerrorMessage("Savesdpsol constraint handler not found\n");
-         return SCIP_PLUGINNOTFOUND;
-      }
-
-      /* get saveconstraint of parent node, usually it will be the last active constraint of the corresponding constraint handler, so we iterate from
-       * the end of the list until we find the correct one */
-      conss = SCIPconshdlrGetConss(conshdlr);
-      parentconsind = SCIPconshdlrGetNActiveConss(conshdlr) - 1;
+      /* find starting solution as optimal solution of parent node: look up the saveconstraint of the parent node */
       parentnodenumber = SCIPnodeGetNumber(SCIPnodeGetParent(SCIPgetCurrentNode(scip)));
+      savesdpsolcons = SCIPconshdlrSavesdpsolGetNodeCons(relaxdata->savesdpsolconshdlr, parentnodenumber);
 
-      while ( parentconsind >= 0 && SCIPconsSavesdpsolGetNodeIndex(scip, conss[parentconsind]) != parentnodenumber )
-         parentconsind--;
-
-      /* If there are no savesdpsol constraints (e.g. because the parent node could not be solved successfully), solve without warmstart. */
-      if ( parentconsind < 0 )
+      /* If there is no active savesdpsol constraint (e.g. because the parent node could not be solved successfully), solve without warmstart. */
+      if ( savesdpsolcons == NULL || ! SCIPconsIsActive(savesdpsolcons) )
       {
          SCIPdebugMsg(scip, "Starting SDP-Solving from scratch, since no warmstart information available for node %" SCIP_LONGINT_FORMAT "\n", parentnodenumber);
          return SCIP_OKAY;
       }
 
-      /* If the number of LP constraints is not the same, solve without warmstart. */
-      savesdpsolcons = conss[parentconsind];
+      /* If the LP rows changed, the LP block of the saved primal solution is mapped to the current rows below. */
       if ( SCIPconsSavesdpsolGetNLPcons(scip, savesdpsolcons) != nrows )
       {
-         SCIPdebugMsg(scip, "Starting SDP-Solving from scratch, since number of LP constraints of stored solution is not the same.\n");
-         return SCIP_OKAY;
+         SCIPdebugMsg(scip, "Number of LP constraints of stored solution changed from %d to %d.\n", SCIPconsSavesdpsolGetNLPcons(scip, savesdpsolcons), nrows);
       }
 
       SCIPdebugMsg(scip, "Using warmstartinformation from node %" SCIP_LONGINT_FORMAT ".\n", parentnodenumber);
@@ -3345,7 +3343,10 @@ SCIP_RETCODE determineWarmStartInformation(
                SCIP_CALL( SCIPallocBufferArray(scip, &(*startXval)[nblocks], 2 * nrows + 2 * nvars) );
                (*startXnblocknonz)[nblocks] = 2 * nrows + 2 * nvars;
 
-               SCIP_CALL( SCIPconsSavesdpsolGetPrimalMatrix(scip, savesdpsolcons, nblocks + 1, *startXnblocknonz, *startXrow, *startXcol, *startXval) );
+               /* get saved primal matrix; the LP block is mapped to the current LP rows */
+               SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+               SCIP_CALL( SCIPconsSavesdpsolGetPrimalMatrix(scip, savesdpsolcons, nblocks + 1, nrows, rows, relaxdata->warmstartmevprimal,
+                     *startXnblocknonz, *startXrow, *startXcol, *startXval) );
             }
             else
             {
@@ -3828,8 +3829,10 @@ SCIP_RETCODE saveWarmstartInfo(
    SCIP_SOL* preoptimalsol = NULL;
    SCIP_SOL* savesol = NULL;
    SCIP_CONS* savedcons;
+   SCIP_ROW** rows;
    SCIP_VAR** vars;
    SCIP_Bool preoptimalsolsuccess = FALSE;
+   SCIP_Bool sparseprimal = FALSE;
    SCIP_Real maxprimalentry = 0.0;
    int* startXnblocknonz = NULL;
    int** startXrow = NULL;
@@ -3916,28 +3919,11 @@ SCIP_RETCODE saveWarmstartInfo(
    }
    else if ( SCIPsdpiDoesWarmstartNeedPrimal() )
    {
+      /* the primal matrix is only retrieved once we know that the solution is saved, see below */
       if ( relaxdata->warmstartprimaltype == 3 )
       {
          nblocks = SCIPconshdlrGetNConss(relaxdata->sdpconshdlr) + SCIPconshdlrGetNConss(relaxdata->sdprank1conshdlr) + 1; /* +1 for the LP part */
-         SCIP_CALL( SCIPallocBufferArray(scip, &startXnblocknonz, nblocks) );
-
-         /* get amount of memory to allocate for row/col/val from sdpi */
-         SCIP_CALL( SCIPsdpiGetPrimalNonzeros(relaxdata->sdpi, nblocks, startXnblocknonz) );
-
-         /* allocate memory for different blocks in row/col/val */
-         if ( startXnblocknonz[0] >= 0 )
-         {
-            SCIP_CALL( SCIPallocBufferArray(scip, &startXrow, nblocks) );
-            SCIP_CALL( SCIPallocBufferArray(scip, &startXcol, nblocks) );
-            SCIP_CALL( SCIPallocBufferArray(scip, &startXval, nblocks) );
-            for (b = 0; b < nblocks; b++)
-            {
-               SCIP_CALL( SCIPallocBufferArray(scip, &startXrow[b], startXnblocknonz[b]) );
-               SCIP_CALL( SCIPallocBufferArray(scip, &startXcol[b], startXnblocknonz[b]) );
-               SCIP_CALL( SCIPallocBufferArray(scip, &startXval[b], startXnblocknonz[b]) );
-            }
-            SCIP_CALL( SCIPsdpiGetPrimalMatrix(relaxdata->sdpi, nblocks, startXnblocknonz, startXrow, startXcol, startXval) );
-         }
+         sparseprimal = TRUE;
       }
       else
       {
@@ -3955,11 +3941,52 @@ SCIP_RETCODE saveWarmstartInfo(
       savesol = scipsol;
 
    /* save solution */
-   if ( savesol != NULL && startXnblocknonz[0] >= 0 )
+   if ( sparseprimal && savesol != NULL )
+   {
+      SCIP_RETCODE retcode;
+      int* sparseXnblocknonz;
+      int** sparseXrow;
+      int** sparseXcol;
+      SCIP_Real** sparseXval;
+
+      /* get the primal matrix directly in block memory, such that the constraint can take it over without another copy;
+       * all nonzeros reported by the SDP solver are kept (threshold 0.0), as for the dense primal matrix */
+      SCIP_CALL( SCIPsdpiGetPrimalMatrixSparse(relaxdata->sdpi, SCIPblkmem(scip), nblocks, 0.0,
+            &sparseXnblocknonz, &sparseXrow, &sparseXcol, &sparseXval) );
+
+      /* skip creation of the savedsol constraint if the primal matrix does not exist */
+      if ( sparseXnblocknonz != NULL )
+      {
+         int nrows;
+
+         /* store the LP rows together with the solution, such that the LP block can be mapped to the rows of child nodes */
+         retcode = SCIPgetLPRowsData(scip, &rows, &nrows);
+
+         if ( retcode == SCIP_OKAY )
+         {
+            (void) SCIPsnprintf(consname, SCIP_MAXSTRLEN, "saved_relax_sol_%d", SCIPnodeGetNumber(SCIPgetCurrentNode(scip)));
+            retcode = createConsSavesdpsolTakeover(scip, &savedcons, consname, SCIPnodeGetNumber(SCIPgetCurrentNode(scip)), nrows, rows,
+               savesol, maxprimalentry, nblocks, &sparseXnblocknonz, &sparseXrow, &sparseXcol, &sparseXval);
+         }
+
+         /* free the primal matrix if the constraint could not take it over (does nothing otherwise) */
+         SCIPsdpiFreePrimalMatrixSparse(SCIPblkmem(scip), nblocks, &sparseXnblocknonz, &sparseXrow, &sparseXcol, &sparseXval);
+         SCIP_CALL( retcode );
+
+         SCIP_CALL( SCIPaddCons(scip, savedcons) );
+         SCIP_CALL( SCIPreleaseCons(scip, &savedcons) );
+      }
+   }
+   else if ( savesol != NULL && (startXnblocknonz == NULL || startXnblocknonz[0] >= 0) )
    {
+      int nrows;
+
+      /* store the LP rows together with the solution, such that the LP block can be mapped to the rows of child nodes */
+      SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
       (void) SCIPsnprintf(consname, SCIP_MAXSTRLEN, "saved_relax_sol_%d", SCIPnodeGetNumber(SCIPgetCurrentNode(scip)));
-      SCIP_CALL( createConsSavesdpsol(scip, &savedcons, consname, SCIPnodeGetNumber(SCIPgetCurrentNode(scip)), SCIPgetNLPRows(scip), savesol,
-            maxprimalentry, nblocks, startXnblocknonz, startXrow, startXcol, startXval) );
+      SCIP_CALL( createConsSavesdpsol(scip, &savedcons, consname, SCIPnodeGetNumber(SCIPgetCurrentNode(scip)), nrows, rows, savesol,
+            maxprimalentry, startXnblocknonz != NULL ? nblocks : 0, startXnblocknonz, startXrow, startXcol, startXval) );
 
       SCIP_CALL( SCIPaddCons(scip, savedcons) );
       SCIP_CALL( SCIPreleaseCons(scip, &savedcons) );
@@ -3997,6 +4024,36 @@ SCIP_RETCODE saveWarmstartInfo(
 }
 
 
+/** sets the gap tolerance and iteration limit of the SDP solver for low-accuracy probing or restores the default values */
+static
+SCIP_RETCODE setProbingAccuracy(
+   SCIP_RELAXDATA*       relaxdata,          /**< relaxator data */
+   SCIP_Bool             lowaccuracy         /**< Should the low-accuracy values be set (otherwise the default values are restored)? */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert( relaxdata != NULL );
+
+   retcode = SCIPsdpiSetRealpar(relaxdata->sdpi, SCIP_SDPPAR_GAPTOL,
+      lowaccuracy ? MAX(relaxdata->sdpsolvergaptol, relaxdata->probinggaptol) : relaxdata->sdpsolvergaptol);
+   if ( retcode != SCIP_PARAMETERUNKNOWN )
+   {
+      SCIP_CALL( retcode );
+   }
+
+   if ( relaxdata->probingmaxiter >= 0 )
+   {
+      retcode = SCIPsdpiSetIntpar(relaxdata->sdpi, SCIP_SDPPAR_MAXITER, lowaccuracy ? relaxdata->probingmaxiter : -1);
+      if ( retcode != SCIP_PARAMETERUNKNOWN )
+      {
+         SCIP_CALL( retcode );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** calculate relaxation and process the relaxation results */
 static
 SCIP_RETCODE calcRelax(
@@ -4010,10 +4067,11 @@ SCIP_RETCODE calcRelax(
    SCIP_SDPSOLVERSETTING startsetting;
    SCIP_RELAXDATA* relaxdata;
    SCIP_CONS* savedsetting;
-   SCIP_CONS** conss;
    SCIP_SDPI* sdpi;
+   SCIP_RETCODE retcode;
    SCIP_Bool rootnode;
    SCIP_Bool enforceslater;
+   SCIP_Bool lowaccuracy;
    SCIP_Real timelimit;
    SCIP_Real objforscip;
    SCIP_Real* solforscip;
@@ -4082,28 +4140,13 @@ SCIP_RETCODE calcRelax(
    }
    else
    {
-      SCIP_CONSHDLR* conshdlr;
-      int parentconsind;
+      SCIP_CONS* parentcons;
 
-      /* get constraint handler */
-      conshdlr = SCIPfindConshdlr(scip, "Savedsdpsettings");
-      if ( conshdlr == NULL )
-      {
-         SCIPerrorMessage("Savedsdpsettings constraint handler not found!\n");
-         return SCIP_PLUGINNOTFOUND;
-      }
+      /* get startsettings of parent node */
+      parentcons = SCIPconshdlrSavedsdpsettingsGetNodeCons(relaxdata->savedsettingsconshdlr, SCIPnodeGetNumber(SCIPnodeGetParent(SCIPgetCurrentNode(scip))));
 
-      /* Get startsettings of parent node; usually it will be the last active constraint of the corresponding constraint
-       * handler, so we iterate from the end of the list until we find the correct one. */
-      conss = SCIPconshdlrGetConss(conshdlr);
-      parentconsind = SCIPconshdlrGetNActiveConss(conshdlr) - 1;
-      (void) SCIPsnprintf(saveconsname, SCIP_MAXSTRLEN, "savedsettings_node_%d", SCIPnodeGetNumber(SCIPnodeGetParent(SCIPgetCurrentNode(scip))));
-
-      while ( parentconsind >= 0 && strcmp(saveconsname, SCIPconsGetName(conss[parentconsind])) )
-         parentconsind--;
-
-      if ( parentconsind >= 0 )
-         startsetting = SCIPconsSavedsdpsettingsGetSettings(scip, conss[parentconsind]);
+      if ( parentcons != NULL && SCIPconsIsActive(parentcons) )
+         startsetting = SCIPconsSavedsdpsettingsGetSettings(scip, parentcons);
       else
       {
          SCIPdebugMsg(scip, "Startsetting from parent node not found, restarting settings!\n");
@@ -4131,9 +4174,41 @@ SCIP_RETCODE calcRelax(
          return SCIP_OKAY;
    }
 
+   /* in low-accuracy probing mode loosen the tolerances and start from the dual vector of the previous probing SDP */
+   lowaccuracy = SCIPinProbing(scip) && relaxdata->lowaccprobing;
+   if ( lowaccuracy )
+   {
+      if ( relaxdata->probingwarmstart && relaxdata->probingwarmyexists && starty == NULL && relaxdata->probingwarmysize == nvars )
+      {
+         SCIP_VAR* var;
+
+         SCIP_CALL( SCIPduplicateBufferArray(scip, &starty, relaxdata->probingwarmy, nvars) );
+
+         /* the previous dive step fixed or tightened some variables, so move the starting point into the local bounds */
+         for (i = 0; i < nvars; ++i)
+         {
+            var = SCIPsdpVarmapperGetSCIPvar(relaxdata->varmapper, i);
+            starty[i] = MIN(MAX(starty[i], SCIPvarGetLbLocal(var)), SCIPvarGetUbLocal(var));
+         }
+         startsetting = relaxdata->probingsetting;
+      }
+   }
+
    /* solve problem */
    SCIP_CALL( SCIPstartClock(scip, relaxdata->sdpsolvingtime) );
-   SCIP_CALL( SCIPsdpiSolve(sdpi, starty, startZnblocknonz, startZrow, startZcol, startZval, startXnblocknonz, startXrow, startXcol, startXval, startsetting, enforceslater, timelimit) );
+   if ( lowaccuracy )
+   {
+      SCIP_CALL( setProbingAccuracy(relaxdata, TRUE) );
+   }
+
+   retcode = SCIPsdpiSolve(sdpi, starty, startZnblocknonz, startZrow, startZcol, startZval, startXnblocknonz, startXrow, startXcol, startXval, startsetting, enforceslater, timelimit);
+
+   /* restore the default accuracy also if solving failed, since the SDPI is used for all later SDPs */
+   if ( lowaccuracy )
+   {
+      SCIP_CALL( setProbingAccuracy(relaxdata, FALSE) );
+   }
+   SCIP_CALL( retcode );
    SCIP_CALL( SCIPstopClock(scip, relaxdata->sdpsolvingtime) );
 
    /* free warmstart information */
@@ -4189,7 +4264,7 @@ SCIP_RETCODE calcRelax(
       SCIP_CALL( SCIPsdpiSettingsUsed(relaxdata->sdpi, &usedsetting) );
 
       (void) SCIPsnprintf(saveconsname, SCIP_MAXSTRLEN, "savedsettings_node_%d", SCIPnodeGetNumber(SCIPgetCurrentNode(scip)));
-      SCIP_CALL( createConsSavedsdpsettings(scip, &savedsetting, saveconsname, usedsetting) );
+      SCIP_CALL( createConsSavedsdpsettings(scip, &savedsetting, saveconsname, SCIPnodeGetNumber(SCIPgetCurrentNode(scip)), usedsetting) );
       SCIP_CALL( SCIPaddCons(scip, savedsetting) );
       SCIP_CALL( SCIPreleaseCons(scip, &savedsetting) );
    }
@@ -4299,6 +4374,19 @@ SCIP_RETCODE calcRelax(
             SCIP_CALL( saveWarmstartInfo(scip, relaxdata, scipsol) );
          }
 
+         /* save dual vector as starting point for the next step of the dive */
+         if ( lowaccuracy && relaxdata->probingwarmstart && SCIPsdpiSolvedOrig(relaxdata->sdpi) )
+         {
+            if ( relaxdata->probingwarmysize != nvars )
+            {
+               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &relaxdata->probingwarmy, relaxdata->probingwarmysize, nvars) );
+               relaxdata->probingwarmysize = nvars;
+            }
+            BMScopyMemoryArray(relaxdata->probingwarmy, solforscip, nvars);
+            SCIP_CALL( SCIPsdpiSettingsUsed(relaxdata->sdpi, &relaxdata->probingsetting) );
+            relaxdata->probingwarmyexists = TRUE;
+         }
+
          SCIP_CALL( SCIPfreeSol(scip, &scipsol) );
          SCIPfreeBufferArray(scip, &solforscip);
       }
@@ -4340,6 +4428,117 @@ SCIP_RETCODE calcRelax(
    return SCIP_OKAY;
 }
 
+/** frees optional data of SCIP-SDP if the memory used comes close to the memory limit
+ *
+ *  The following steps are applied in this order, one new step in each call in which the memory is above the threshold:
+ *  1. free the saved SDP solutions of nodes that are not ancestors of the current node (these are used for warmstarts only),
+ *  2. free the propagation data and stored eigenvectors of the SDP constraints,
+ *  3. remove SDP cuts that were not used in the last separation rounds from the global cut pool,
+ *  4. replace warmstarting with rounding problems (warmstartproject = 4) by projecting onto the PSD cone.
+ *
+ *  Steps 1 and 3 are repeated in later calls, since the data accumulates again.
+ */
+static
+SCIP_RETCODE reduceMemory(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RELAXDATA*       relaxdata           /**< relaxator data */
+   )
+{
+   SCIP_Real memlimit;
+   SCIP_Real memused;
+   int oldlevel;
+   int c;
+
+   assert( scip != NULL );
+   assert( relaxdata != NULL );
+
+   if ( relaxdata->memorythreshold >= 1.0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/memory", &memlimit) );
+   if ( memlimit >= SCIP_MEM_NOLIMIT )
+      return SCIP_OKAY;
+
+   memused = (SCIP_Real) (SCIPgetMemUsed(scip) + SCIPgetMemExternEstim(scip)) / 1048576.0;
+   if ( memused < relaxdata->memorythreshold * memlimit )
+      return SCIP_OKAY;
+
+   oldlevel = relaxdata->memorylevel;
+   if ( relaxdata->memorylevel < 4 )
+      ++relaxdata->memorylevel;
+
+   /* 1. free saved solutions of nodes in other parts of the tree */
+   if ( relaxdata->savesdpsolconshdlr != NULL )
+   {
+      int nfreed;
+
+      SCIP_CALL( SCIPconshdlrSavesdpsolFreeInactive(scip, relaxdata->savesdpsolconshdlr, &nfreed) );
+      if ( nfreed > 0 )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "SDP memory saving (%.1f of %.1f MB used): freed %d saved SDP solutions.\n",
+            memused, memlimit, nfreed);
+      }
+   }
+
+   /* 2. free propagation data and stored eigenvectors */
+   if ( relaxdata->memorylevel >= 2 && oldlevel < 2 )
+   {
+      SCIP_CONSHDLR* conshdlrs[2];
+      SCIP_Longint nfreedbytes = 0;
+
+      conshdlrs[0] = relaxdata->sdpconshdlr;
+      conshdlrs[1] = relaxdata->sdprank1conshdlr;
+      for (c = 0; c < 2; ++c)
+      {
+         SCIP_Longint nbytes;
+
+         if ( conshdlrs[c] == NULL )
+            continue;
+
+         SCIP_CALL( SCIPconshdlrSdpFreeCaches(scip, conshdlrs[c], &nbytes) );
+         nfreedbytes += nbytes;
+      }
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "SDP memory saving (%.1f of %.1f MB used): freed %.1f MB of propagation data "
+         "and stored eigenvectors, turned off propagation of upper bounds and 3x3 minors.\n", memused, memlimit, (SCIP_Real) nfreedbytes / 1048576.0);
+   }
+
+   /* 3. remove SDP cuts from the cut pool that were not used recently */
+   if ( relaxdata->memorylevel >= 3 )
+   {
+      SCIP_CONSHDLR* conshdlrs[2];
+      int ndelcuts = 0;
+
+      conshdlrs[0] = relaxdata->sdpconshdlr;
+      conshdlrs[1] = relaxdata->sdprank1conshdlr;
+      for (c = 0; c < 2; ++c)
+      {
+         int ncuts;
+
+         if ( conshdlrs[c] == NULL )
+            continue;
+
+         SCIP_CALL( SCIPconshdlrSdpRemoveAgedPoolCuts(scip, conshdlrs[c], &ncuts) );
+         ndelcuts += ncuts;
+      }
+      if ( ndelcuts > 0 )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "SDP memory saving (%.1f of %.1f MB used): removed %d SDP cuts from the cut pool.\n",
+            memused, memlimit, ndelcuts);
+      }
+   }
+
+   /* 4. do not solve rounding problems for warmstarting anymore */
+   if ( relaxdata->memorylevel >= 4 && oldlevel < 4 && relaxdata->warmstart && relaxdata->warmstartproject == 4 )
+   {
+      relaxdata->origwarmstartproject = relaxdata->warmstartproject;
+      relaxdata->warmstartproject = 3;
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "SDP memory saving (%.1f of %.1f MB used): warmstarts project onto the PSD cone "
+         "instead of solving rounding problems.\n", memused, memlimit);
+   }
+
+   return SCIP_OKAY;
+}
+
 /** execution method of relaxator */
 static
 SCIP_DECL_RELAXEXEC(relaxExecSdp)
@@ -4403,6 +4602,12 @@ SCIP_DECL_RELAXEXEC(relaxExecSdp)
       return SCIP_OKAY;
    }
 
+   /* free optional data if memory is short */
+   if ( ! SCIPinProbing(scip) )
+   {
+      SCIP_CALL( reduceMemory(scip, relaxdata) );
+   }
+
    /* construct the lp and make sure, that everything is where it should be */
    SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
 
@@ -4616,6 +4821,14 @@ SCIP_DECL_RELAXINITSOL(relaxInitSolSdp)
    if ( relaxdata->sdprank1conshdlr == NULL )
       return SCIP_PLUGINNOTFOUND;
 
+   relaxdata->savesdpsolconshdlr = SCIPfindConshdlr(scip, "Savesdpsol");
+   if ( relaxdata->savesdpsolconshdlr == NULL )
+      return SCIP_PLUGINNOTFOUND;
+
+   relaxdata->savedsettingsconshdlr = SCIPfindConshdlr(scip, "Savedsdpsettings");
+   if ( relaxdata->savedsettingsconshdlr == NULL )
+      return SCIP_PLUGINNOTFOUND;
+
    nvars = SCIPgetNVars(scip);
    vars = SCIPgetVars(scip);
 
@@ -5056,6 +5269,14 @@ SCIP_DECL_RELAXEXITSOL(relaxExitSolSdp)
 
    SCIPdebugMsg(scip, "Exiting Relaxation Handler.\n");
 
+   /* restore the warmstart parameter if it was changed to save memory */
+   if ( relaxdata->origwarmstartproject >= 0 )
+   {
+      relaxdata->warmstartproject = relaxdata->origwarmstartproject;
+      relaxdata->origwarmstartproject = -1;
+   }
+   relaxdata->memorylevel = 0;
+
    if ( relaxdata->displaystat && SCIPgetSubscipDepth(scip) == 0 )
    {
       SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "\nSDP iterations:\t\t\t\t\t\t%6d\n", relaxdata->sdpiterations);
@@ -5239,6 +5460,11 @@ SCIP_DECL_RELAXEXITSOL(relaxExitSolSdp)
    relaxdata->unsolved = 0;
    SCIP_CALL( SCIPsdpiClear(relaxdata->sdpi) );
 
+   SCIPfreeBlockMemoryArrayNull(scip, &relaxdata->probingwarmy, relaxdata->probingwarmysize);
+   relaxdata->probingwarmysize = 0;
+   relaxdata->probingwarmyexists = FALSE;
+   relaxdata->lowaccprobing = FALSE;
+
    return SCIP_OKAY;
 }
 
@@ -5389,6 +5615,8 @@ SCIP_RETCODE SCIPincludeRelaxSdp(
    relaxdata->roundingprobtime = NULL;
    relaxdata->sdpconshdlr = NULL;
    relaxdata->sdprank1conshdlr = NULL;
+   relaxdata->savesdpsolconshdlr = NULL;
+   relaxdata->savedsettingsconshdlr = NULL;
    relaxdata->ipXexists = FALSE;
    relaxdata->ipZexists = FALSE;
    relaxdata->ipnlpcons = 0;
@@ -5401,6 +5629,13 @@ SCIP_RETCODE SCIPincludeRelaxSdp(
    relaxdata->ipZrow = NULL;
    relaxdata->ipZcol = NULL;
    relaxdata->ipZval = NULL;
+   relaxdata->lowaccprobing = FALSE;
+   relaxdata->probingwarmy = NULL;
+   relaxdata->probingwarmysize = 0;
+   relaxdata->probingwarmyexists = FALSE;
+   relaxdata->probingsetting = SCIP_SDPSOLVERSETTING_UNSOLVED;
+   relaxdata->memorylevel = 0;
+   relaxdata->origwarmstartproject = -1;
 
    relaxdata->ipXexists = FALSE;
    relaxdata->ipZexists = FALSE;
@@ -5566,6 +5801,22 @@ SCIP_RETCODE SCIPincludeRelaxSdp(
          "number of threads the SDP solver should use (-1 = number of cores); currently only supported for MOSEK",
          &(relaxdata->sdpsolverthreads), TRUE, DEFAULT_SDPSOLVERTHREADS, -1, INT_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddRealParam(scip, "relaxing/SDP/probinggaptol",
+         "gap tolerance of the SDP solver for probing SDPs solved in low-accuracy mode by diving heuristics",
+         &(relaxdata->probinggaptol), TRUE, DEFAULT_PROBINGGAPTOL, 1e-20, 1.0, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "relaxing/SDP/probingmaxiter",
+         "maximal number of SDP iterations for probing SDPs solved in low-accuracy mode by diving heuristics (-1 = solver default)",
+         &(relaxdata->probingmaxiter), TRUE, DEFAULT_PROBINGMAXITER, -1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "relaxing/SDP/probingwarmstart",
+         "Should the dual vector of the previous probing SDP be used as starting point in low-accuracy mode?",
+         &(relaxdata->probingwarmstart), TRUE, DEFAULT_PROBINGWARMSTART, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip, "relaxing/SDP/memorythreshold",
+         "fraction of limits/memory from which on saved solutions, propagation data and unused cuts of SDP constraints are freed (1.0: never)",
+         &(relaxdata->memorythreshold), TRUE, DEFAULT_MEMORYTHRESHOLD, 0.0, 1.0, NULL, NULL) );
+
    /* add description of SDP-solver */
    SCIP_CALL( SCIPincludeExternalCodeInformation(scip, SCIPsdpiGetSolverName(), SCIPsdpiGetSolverDesc()) );
 
@@ -6001,6 +6252,45 @@ SCIP_RETCODE SCIPrelaxSdpComputeAnalyticCenters(
    return SCIP_OKAY;
 }
 
+/** computes a conflict cut for the last SDP if it was infeasible
+ *
+ *  The cut aggregates the SDP constraints and the global LP rows with the primal solution of the infeasible SDP. It has
+ *  the form conflictcut^T x >= conflictcutlhs, where the coefficients are indexed by the problem index of the variables,
+ *  and it is globally valid. The cut is violated by every point within the bounds of the last SDP, so diving heuristics
+ *  can use it to find the bound changes responsible for the infeasibility.
+ */
+SCIP_RETCODE SCIPrelaxSdpComputeConflictCut(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RELAX*           relax,              /**< SDP-relaxator */
+   SCIP_Real*            conflictcut,        /**< array to store the coefficients of the cut, must have length nvars */
+   SCIP_Real*            conflictcutlhs,     /**< pointer to store the left hand side of the cut */
+   SCIP_Bool*            success             /**< pointer to store whether a cut could be computed */
+   )
+{
+   SCIP_RELAXDATA* relaxdata;
+   SCIP_Bool cmirsuccess;
+
+   assert( scip != NULL );
+   assert( relax != NULL );
+   assert( conflictcut != NULL );
+   assert( conflictcutlhs != NULL );
+   assert( success != NULL );
+
+   relaxdata = SCIPrelaxGetData(relax);
+   assert( relaxdata != NULL );
+   assert( relaxdata->sdpi != NULL );
+
+   *success = FALSE;
+
+   if ( ! SCIPsdpiWasSolved(relaxdata->sdpi) || ! SCIPsdpiIsDualInfeasible(relaxdata->sdpi) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( computeConflictCut(scip, relaxdata->conflictcancel, relaxdata->conflictcmir, relaxdata->varmapper, relaxdata->sdpi,
+         FALSE, conflictcut, conflictcutlhs, &cmirsuccess, success) );
+
+   return SCIP_OKAY;
+}
+
 /** gets the primal solution corresponding to the lower and upper variable-bounds for a subset of the variables in the dual problem
  *
  *  @note If a variable is either fixed or unbounded in the dual problem, a zero will be returned for the non-existent
@@ -6124,6 +6414,31 @@ SCIP_Bool SCIPrelaxSdpSolvedOrig(
    return relaxdata->origsolved && SCIPsdpiSolvedOrig(relaxdata->sdpi);
 }
 
+/** switches the low-accuracy mode for probing SDPs on or off
+ *
+ *  In low-accuracy mode, probing SDPs are solved with the looser gap tolerance relaxing/SDP/probinggaptol and the
+ *  iteration limit relaxing/SDP/probingmaxiter, starting from the dual vector of the previous probing SDP. Diving
+ *  heuristics should switch it off again before the last SDP of a dive is solved and before ending probing.
+ */
+void SCIPrelaxSdpSetLowAccuracyProbing(
+   SCIP_RELAX*           relax,              /**< SDP-relaxator */
+   SCIP_Bool             lowaccuracy         /**< Should probing SDPs be solved in low-accuracy mode? */
+   )
+{
+   SCIP_RELAXDATA* relaxdata;
+
+   assert( relax != NULL );
+
+   relaxdata = SCIPrelaxGetData(relax);
+   assert( relaxdata != NULL );
+
+   /* a new dive should not start from the solution of a previous one */
+   if ( lowaccuracy && ! relaxdata->lowaccprobing )
+      relaxdata->probingwarmyexists = FALSE;
+
+   relaxdata->lowaccprobing = lowaccuracy;
+}
+
 /** Was the last probing SDP solved successfully ? */
 SCIP_Bool SCIPrelaxSdpSolvedProbing(
    SCIP_RELAX*           relax               /**< SDP-relaxator to get solution for */
@@ -6556,13 +6871,50 @@ SCIP_RETCODE SCIPrelaxSdpGetStatistics(
    SCIP_RELAX*           relax,              /**< SDP-relaxator to get the statistics for */
    int*                  ninfeasible,        /**< pointer to store the total number of times infeasibility was detected in presolving */
    int*                  nallfixed,          /**< pointer to store the total number of times all variables were fixed */
-   int*                  nonevarsdp          /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nonevarsdp,         /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nworkspaceallocs    /**< pointer to store the total number of times the working space of the SDPI had to be enlarged */
    )
 {
    assert( relax != NULL );
    assert( SCIPrelaxGetData(relax) != NULL );
 
-   SCIP_CALL( SCIPsdpiGetStatistics(SCIPrelaxGetData(relax)->sdpi, ninfeasible, nallfixed, nonevarsdp) );
+   SCIP_CALL( SCIPsdpiGetStatistics(SCIPrelaxGetData(relax)->sdpi, ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs) );
 
    return SCIP_OKAY;
 }
+
+/** returns the number of bytes allocated for the data of the SDPI (without the SDP solver) and the maximal number since
+ *  the last call of SCIPrelaxSdpResetPeakSdpiMemory()
+ */
+void SCIPrelaxSdpGetSdpiMemory(
+   SCIP_RELAX*           relax,              /**< SDP-relaxator to get the memory for */
+   SCIP_Longint*         memory,             /**< pointer to store the number of allocated bytes */
+   SCIP_Longint*         peakmemory          /**< pointer to store the maximal number of allocated bytes (or NULL) */
+   )
+{
+   assert( relax != NULL );
+   assert( SCIPrelaxGetData(relax) != NULL );
+   assert( memory != NULL );
+
+   if ( SCIPrelaxGetData(relax)->sdpi == NULL )
+   {
+      *memory = 0;
+      if ( peakmemory != NULL )
+         *peakmemory = 0;
+      return;
+   }
+
+   SCIPsdpiGetMemory(SCIPrelaxGetData(relax)->sdpi, memory, peakmemory);
+}
+
+/** resets the maximal number of bytes allocated for the data of the SDPI to the current number */
+void SCIPrelaxSdpResetPeakSdpiMemory(
+   SCIP_RELAX*           relax               /**< SDP-relaxator */
+   )
+{
+   assert( relax != NULL );
+   assert( SCIPrelaxGetData(relax) != NULL );
+
+   if ( SCIPrelaxGetData(relax)->sdpi != NULL )
+      SCIPsdpiResetPeakMemory(SCIPrelaxGetData(relax)->sdpi);
+}
@@ -69,6 +69,22 @@ SCIP_RETCODE SCIPrelaxSdpComputeAnalyticCenters(
    SCIP_RELAX*           relax               /**< SDP-relaxator to compute analytic centers for */
    );
 
+/** computes a conflict cut for the last SDP if it was infeasible
+ *
+ *  The cut aggregates the SDP constraints and the global LP rows with the primal solution of the infeasible SDP. It has
+ *  the form conflictcut^T x >= conflictcutlhs, where the coefficients are indexed by the problem index of the variables,
+ *  and it is globally valid. The cut is violated by every point within the bounds of the last SDP, so diving heuristics
+ *  can use it to find the bound changes responsible for the infeasibility.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPrelaxSdpComputeConflictCut(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RELAX*           relax,              /**< SDP-relaxator */
+   SCIP_Real*            conflictcut,        /**< array to store the coefficients of the cut, must have length nvars */
+   SCIP_Real*            conflictcutlhs,     /**< pointer to store the left hand side of the cut */
+   SCIP_Bool*            success             /**< pointer to store whether a cut could be computed */
+   );
+
 /** gets the primal solution corresponding to the lower and upper variable-bounds for a subset of the variables in the dual problem
  *
  *  @note If a variable is either fixed or unbounded in the dual
@@ -113,6 +129,18 @@ SCIP_Bool SCIPrelaxSdpSolvedOrig(
    SCIP_RELAX*           relax               /**< SDP-relaxator to get solution for */
    );
 
+/** switches the low-accuracy mode for probing SDPs on or off
+ *
+ *  In low-accuracy mode, probing SDPs are solved with the looser gap tolerance relaxing/SDP/probinggaptol and the
+ *  iteration limit relaxing/SDP/probingmaxiter, starting from the dual vector of the previous probing SDP. Diving
+ *  heuristics should switch it off again before the last SDP of a dive is solved and before ending probing.
+ */
+SCIP_EXPORT
+void SCIPrelaxSdpSetLowAccuracyProbing(
+   SCIP_RELAX*           relax,              /**< SDP-relaxator */
+   SCIP_Bool             lowaccuracy         /**< Should probing SDPs be solved in low-accuracy mode? */
+   );
+
 /** Was the last probing SDP solved successfully ? */
 SCIP_EXPORT
 SCIP_Bool SCIPrelaxSdpSolvedProbing(
@@ -342,7 +370,24 @@ SCIP_RETCODE SCIPrelaxSdpGetStatistics(
    SCIP_RELAX*           relax,              /**< SDP-relaxator to get the statistics for */
    int*                  ninfeasible,        /**< pointer to store the total number of times infeasibility was detected in presolving */
    int*                  nallfixed,          /**< pointer to store the total number of times all variables were fixed */
-   int*                  nonevarsdp          /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nonevarsdp,         /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nworkspaceallocs    /**< pointer to store the total number of times the working space of the SDPI had to be enlarged */
+   );
+
+/** returns the number of bytes allocated for the data of the SDPI (without the SDP solver) and the maximal number since
+ *  the last call of SCIPrelaxSdpResetPeakSdpiMemory()
+ */
+SCIP_EXPORT
+void SCIPrelaxSdpGetSdpiMemory(
+   SCIP_RELAX*           relax,              /**< SDP-relaxator to get the memory for */
+   SCIP_Longint*         memory,             /**< pointer to store the number of allocated bytes */
+   SCIP_Longint*         peakmemory          /**< pointer to store the maximal number of allocated bytes (or NULL) */
+   );
+
+/** resets the maximal number of bytes allocated for the data of the SDPI to the current number */
+SCIP_EXPORT
+void SCIPrelaxSdpResetPeakSdpiMemory(
+   SCIP_RELAX*           relax               /**< SDP-relaxator */
    );
 
 #ifdef __cplusplus
@@ -46,6 +46,7 @@
 #include "relax_sdp.h"
 #include "reader_cbf.h"
 #include "reader_sdpa.h"
+#include "reader_sdpbin.h"
 #include "prop_sdpredcost.h"
 #include "disp_sdpiterations.h"
 #include "disp_sdpavgiterations.h"
@@ -58,6 +59,7 @@
 #include "branch_sdpinfobjective.h"
 #include "heur_sdpfracdiving.h"
 #include "heur_sdpfracround.h"
+#include "heur_sdphyperplane.h"
 #include "heur_sdpinnerlp.h"
 #include "heur_sdprand.h"
 #include "prop_sdpobbt.h"
@@ -66,6 +68,7 @@
 #include "scipsdpgithash.c"
 #include "table_relaxsdp.h"
 #include "table_slater.h"
+#include "table_sdpmemory.h"
 
 /* hack to allow to change the name of the dialog without needing to copy everything */
 #include "scip/struct_dialog.h"
@@ -224,6 +227,7 @@ SCIP_RETCODE SCIPSDPincludeDefaultPlugins(
    /* include new plugins */
    SCIP_CALL( SCIPincludeReaderCbf(scip) );
    SCIP_CALL( SCIPincludeReaderSdpa(scip) );
+   SCIP_CALL( SCIPincludeReaderSdpbin(scip) );
    SCIP_CALL( SCIPincludeConshdlrSdp(scip) );
    SCIP_CALL( SCIPincludeConshdlrSdpRank1(scip) );
    SCIP_CALL( SCIPincludeConshdlrSavesdpsol(scip) );
@@ -238,6 +242,7 @@ SCIP_RETCODE SCIPSDPincludeDefaultPlugins(
    SCIP_CALL( SCIPincludeHeurSdpFracround(scip) );
    SCIP_CALL( SCIPincludeHeurSdpInnerlp(scip) );
    SCIP_CALL( SCIPincludeHeurSdpRand(scip) );
+   SCIP_CALL( SCIPincludeHeurSdpHyperplane(scip) );
    SCIP_CALL( SCIPincludePropSdpObbt(scip) );
    SCIP_CALL( SCIPincludePropSdpSymmetry(scip) );
    SCIP_CALL( SCIPincludePropCompAnalCent(scip) );
@@ -258,6 +263,7 @@ SCIP_RETCODE SCIPSDPincludeDefaultPlugins(
    /* include tables */
    SCIP_CALL( SCIPincludeTableRelaxSdp(scip) );
    SCIP_CALL( SCIPincludeTableSlater(scip) );
+   SCIP_CALL( SCIPincludeTableSdpMemory(scip) );
 
    return SCIP_OKAY;
 }
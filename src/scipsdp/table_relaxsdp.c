@@ -122,6 +122,7 @@ SCIP_DECL_TABLEOUTPUT(tableOutputRelaxSdp)
    int ninfeasible;
    int nallfixed;
    int nonevarsdp;
+   int nworkspaceallocs;
 
    assert( scip != NULL );
    assert( table != NULL );
@@ -132,39 +133,39 @@ SCIP_DECL_TABLEOUTPUT(tableOutputRelaxSdp)
    relaxsdp = tabledata->relaxSDP;
    assert( relaxsdp != NULL );
 
-   SCIP_CALL( SCIPrelaxSdpGetStatistics(relaxsdp, &ninfeasible, &nallfixed, &nonevarsdp) );
+   SCIP_CALL( SCIPrelaxSdpGetStatistics(relaxsdp, &ninfeasible, &nallfixed, &nonevarsdp, &nworkspaceallocs) );
    nintercalls = SCIPrelaxSdpGetNSdpInterfaceCalls(relaxsdp);
    nsdpcalls = SCIPrelaxSdpGetNSdpCalls(relaxsdp);
 
    if ( strcmp(SCIPsdpiGetSolverName(), "SDPA") == 0 )
    {
-      SCIPinfoMessage(scip, file, "    SDP-Solvers    :       Time    Opttime     Solves Iterations  Iter/call       Fast     Medium     Stable    Penalty   Unsolved     Infeas   Allfixed  OnevarSDP\n");
+      SCIPinfoMessage(scip, file, "    SDP-Solvers    :       Time    Opttime     Solves Iterations  Iter/call       Fast     Medium     Stable    Penalty   Unsolved     Infeas   Allfixed  OnevarSDP     Allocs\n");
       if ( nintercalls > 0 )
       {
          if ( tabledata->absolute )
          {
             if ( nsdpcalls > 0 )
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %10d %10d %10d %10d %10d %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %10d %10d %10d %10d %10d %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), (SCIP_Real) SCIPrelaxSdpGetNIterations(relaxsdp) / (SCIP_Real) nsdpcalls,
                   SCIPrelaxSdpGetNSdpFast(relaxsdp), SCIPrelaxSdpGetNSdpMedium(relaxsdp), SCIPrelaxSdpGetNSdpStable(relaxsdp), SCIPrelaxSdpGetNSdpPenalty(relaxsdp),
-                  SCIPrelaxSdpGetNSdpUnsolved(relaxsdp), ninfeasible, nallfixed, nonevarsdp);
+                  SCIPrelaxSdpGetNSdpUnsolved(relaxsdp), ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
             }
             else
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %10d %10d %10d %10d %10d %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %10d %10d %10d %10d %10d %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), "-",
                   SCIPrelaxSdpGetNSdpFast(relaxsdp), SCIPrelaxSdpGetNSdpMedium(relaxsdp), SCIPrelaxSdpGetNSdpStable(relaxsdp), SCIPrelaxSdpGetNSdpPenalty(relaxsdp),
-                  SCIPrelaxSdpGetNSdpUnsolved(relaxsdp), ninfeasible, nallfixed, nonevarsdp);
+                  SCIPrelaxSdpGetNSdpUnsolved(relaxsdp), ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
             }
          }
          else
          {
             if ( nsdpcalls > 0 )
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %8.2f %% %8.2f %% %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %8.2f %% %8.2f %% %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), (SCIP_Real) SCIPrelaxSdpGetNIterations(relaxsdp) / (SCIP_Real) nsdpcalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpFast(relaxsdp) / (SCIP_Real) nintercalls,
@@ -172,11 +173,11 @@ SCIP_DECL_TABLEOUTPUT(tableOutputRelaxSdp)
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpStable(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpPenalty(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpUnsolved(relaxsdp) / (SCIP_Real) nintercalls,
-                  ninfeasible, nallfixed, nonevarsdp);
+                  ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
             }
             else
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %8.2f %% %8.2f %% %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %8.2f %% %8.2f %% %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), "-",
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpFast(relaxsdp) / (SCIP_Real) nintercalls,
@@ -184,71 +185,71 @@ SCIP_DECL_TABLEOUTPUT(tableOutputRelaxSdp)
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpStable(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpPenalty(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpUnsolved(relaxsdp) / (SCIP_Real) nintercalls,
-                  ninfeasible, nallfixed, nonevarsdp);
+                  ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
 
             }
          }
       }
       else
       {
-         SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n",
+         SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n",
             SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
-            "-", "-", "-", "-", "-", "-", "-", "-", "-", "-", "-");
+            "-", "-", "-", "-", "-", "-", "-", "-", "-", "-", "-", "-");
       }
    }
    else
    {
-      SCIPinfoMessage(scip, file, "    SDP-Solvers    :       Time    Opttime     Solves Iterations  Iter/call    Default    Penalty   Unsolved     Infeas   Allfixed  OnevarSDP\n");
+      SCIPinfoMessage(scip, file, "    SDP-Solvers    :       Time    Opttime     Solves Iterations  Iter/call    Default    Penalty   Unsolved     Infeas   Allfixed  OnevarSDP     Allocs\n");
       if ( nintercalls > 0 )
       {
          if ( tabledata->absolute )
          {
             if ( nsdpcalls > 0 )
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %10d %10d %10d %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %10d %10d %10d %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), (SCIP_Real) SCIPrelaxSdpGetNIterations(relaxsdp) / (SCIP_Real) nsdpcalls,
                   SCIPrelaxSdpGetNSdpFast(relaxsdp), SCIPrelaxSdpGetNSdpPenalty(relaxsdp), SCIPrelaxSdpGetNSdpUnsolved(relaxsdp),
-                  ninfeasible, nallfixed, nonevarsdp);
+                  ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
             }
             else
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %10d %10d %10d %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %10d %10d %10d %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), "-",
                   SCIPrelaxSdpGetNSdpFast(relaxsdp), SCIPrelaxSdpGetNSdpPenalty(relaxsdp), SCIPrelaxSdpGetNSdpUnsolved(relaxsdp),
-                  ninfeasible, nallfixed, nonevarsdp);
+                  ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
             }
          }
          else
          {
             if ( nsdpcalls > 0 )
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10.2f %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), (SCIP_Real) SCIPrelaxSdpGetNIterations(relaxsdp) / (SCIP_Real) nsdpcalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpFast(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpPenalty(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpUnsolved(relaxsdp) / (SCIP_Real) nintercalls,
-                  ninfeasible, nallfixed, nonevarsdp);
+                  ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
             }
             else
             {
-               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d\n",
+               SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10d %10d %10s %8.2f %% %8.2f %% %8.2f %% %10d %10d %10d %10d\n",
                   SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
                   nsdpcalls, SCIPrelaxSdpGetNIterations(relaxsdp), "-",
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpFast(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpPenalty(relaxsdp) / (SCIP_Real) nintercalls,
                   100.0 * (SCIP_Real) SCIPrelaxSdpGetNSdpUnsolved(relaxsdp) / (SCIP_Real) nintercalls,
-                  ninfeasible, nallfixed, nonevarsdp);
+                  ninfeasible, nallfixed, nonevarsdp, nworkspaceallocs);
             }
          }
       }
       else
       {
-         SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n",
+         SCIPinfoMessage(scip, file, "     %-14.14s: %10.2f %10.2f %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n",
             SCIPsdpiGetSolverName(), SCIPrelaxSdpGetSolvingTime(scip, relaxsdp), SCIPrelaxSdpGetOptTime(relaxsdp),
-            "-", "-", "-", "-", "-", "-", "-", "-", "-", "-");
+            "-", "-", "-", "-", "-", "-", "-", "-", "-", "-", "-");
       }
    }
 
@@ -0,0 +1,376 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   table_sdpmemory.c
+ * @brief  statistics table for the memory consumption of the SCIP-SDP data structures
+ * @author SCIP-SDP developers
+ *
+ * The table reports the current and peak number of bytes of the data of SDP constraints, their propagation data, the
+ * SDPI, the saved warmstart solutions and the symmetry information, together with the total memory used by SCIP. The
+ * numbers are computed from the sizes of the data structures; the memory of the SDP solver itself is not included.
+ *
+ * The SDP constraints, the SDPI and the saved solutions update their memory whenever their arrays are (re)allocated or
+ * freed, so their peaks are exact; the peaks of all categories are reset when the solving process starts. The memory of
+ * the symmetry information and of SCIP is sampled after each solved node. With the parameter table/sdpmemory/printfreq,
+ * the current numbers are also printed during the solving process.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "table_sdpmemory.h"
+#include "cons_sdp.h"
+#include "cons_savesdpsol.h"
+#include "relax_sdp.h"
+#include "prop_sdpsymmetry.h"
+
+
+#define TABLE_NAME              "sdpmemory"
+#define TABLE_DESC              "memory statistics table for SCIP-SDP data structures"
+#define TABLE_ACTIVE            TRUE
+#define TABLE_POSITION          17200              /**< the position of the statistics table */
+#define TABLE_EARLIEST_STAGE    SCIP_STAGE_TRANSFORMED /**< output of the statistics table is only printed from this stage onwards */
+
+#define EVENTHDLR_NAME          "sdpmemory"
+#define EVENTHDLR_DESC          "event handler for sampling the memory of SCIP-SDP data structures"
+
+#define DEFAULT_PRINTFREQ       0                  /**< frequency (in nodes) for printing the current memory (0: never) */
+
+/* categories of memory */
+#define SDPMEM_CONSDATA         0                  /**< data of SDP constraints */
+#define SDPMEM_PROP             1                  /**< propagation data of SDP constraints */
+#define SDPMEM_SDPI             2                  /**< data of the SDPI */
+#define SDPMEM_SAVEDSOL         3                  /**< saved warmstart solutions */
+#define SDPMEM_SYMMETRY         4                  /**< symmetry information */
+#define SDPMEM_SCIP             5                  /**< total memory used by SCIP */
+#define SDPMEM_NCATEGORIES      6                  /**< number of categories */
+
+/** names of the categories */
+static const char* categorynames[SDPMEM_NCATEGORIES] = { "SDP constraints", "SDP propagation", "SDPI", "saved solutions",
+   "symmetry", "SCIP (total)" };
+
+
+/*
+ * Data structures
+ */
+
+/** statistics table data */
+struct SCIP_TableData
+{
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for sampling after each node */
+   int                   filterpos;          /**< filter position of the node event (or -1) */
+   int                   printfreq;          /**< frequency (in nodes) for printing the current memory (0: never) */
+   SCIP_Longint          current[SDPMEM_NCATEGORIES]; /**< memory of each category at the last sample */
+   SCIP_Longint          peak[SDPMEM_NCATEGORIES];    /**< maximal memory of each category since the start of the solving process */
+};
+
+
+/*
+ * Local methods
+ */
+
+/** gets the current memory of all categories and updates the peaks */
+static
+void sampleMemory(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TABLEDATA*       tabledata           /**< statistics table data */
+   )
+{
+   SCIP_CONSHDLR* conshdlr;
+   SCIP_RELAX* relax;
+   SCIP_Longint consdatamem;
+   SCIP_Longint propmem;
+   SCIP_Longint peakconsdatamem;
+   SCIP_Longint peakpropmem;
+   SCIP_Longint peakmem;
+   int i;
+
+   assert( scip != NULL );
+   assert( tabledata != NULL );
+
+   for (i = 0; i < SDPMEM_NCATEGORIES; ++i)
+      tabledata->current[i] = 0;
+
+   /* the constraint handlers, the SDPI and the saved solutions keep track of their peaks themselves; the peaks of the
+    * SDP and SDPrank1 constraint handlers are added, which may overestimate the peak of the sum */
+   peakconsdatamem = 0;
+   peakpropmem = 0;
+   conshdlr = SCIPfindConshdlr(scip, "SDP");
+   if ( conshdlr != NULL )
+   {
+      SCIPconshdlrSdpGetMemory(conshdlr, &consdatamem, &propmem, &peakconsdatamem, &peakpropmem);
+      tabledata->current[SDPMEM_CONSDATA] += consdatamem;
+      tabledata->current[SDPMEM_PROP] += propmem;
+   }
+
+   conshdlr = SCIPfindConshdlr(scip, "SDPrank1");
+   if ( conshdlr != NULL )
+   {
+      SCIP_Longint peakconsdatamemrank1;
+      SCIP_Longint peakpropmemrank1;
+
+      SCIPconshdlrSdpGetMemory(conshdlr, &consdatamem, &propmem, &peakconsdatamemrank1, &peakpropmemrank1);
+      tabledata->current[SDPMEM_CONSDATA] += consdatamem;
+      tabledata->current[SDPMEM_PROP] += propmem;
+      peakconsdatamem += peakconsdatamemrank1;
+      peakpropmem += peakpropmemrank1;
+   }
+   tabledata->peak[SDPMEM_CONSDATA] = MAX(tabledata->peak[SDPMEM_CONSDATA], peakconsdatamem);
+   tabledata->peak[SDPMEM_PROP] = MAX(tabledata->peak[SDPMEM_PROP], peakpropmem);
+
+   relax = SCIPfindRelax(scip, "SDP");
+   if ( relax != NULL )
+   {
+      SCIPrelaxSdpGetSdpiMemory(relax, &tabledata->current[SDPMEM_SDPI], &peakmem);
+      tabledata->peak[SDPMEM_SDPI] = MAX(tabledata->peak[SDPMEM_SDPI], peakmem);
+   }
+
+   conshdlr = SCIPfindConshdlr(scip, "Savesdpsol");
+   if ( conshdlr != NULL )
+   {
+      SCIPconshdlrSavesdpsolGetMemory(conshdlr, &tabledata->current[SDPMEM_SAVEDSOL], &peakmem);
+      tabledata->peak[SDPMEM_SAVEDSOL] = MAX(tabledata->peak[SDPMEM_SAVEDSOL], peakmem);
+   }
+
+   tabledata->current[SDPMEM_SYMMETRY] = SCIPgetSdpSymmetryMemory(scip);
+   tabledata->current[SDPMEM_SCIP] = SCIPgetMemUsed(scip);
+
+   for (i = 0; i < SDPMEM_NCATEGORIES; ++i)
+      tabledata->peak[i] = MAX(tabledata->peak[i], tabledata->current[i]);
+}
+
+/** resets the peaks of all categories to the current memory */
+static
+void resetPeakMemory(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TABLEDATA*       tabledata           /**< statistics table data */
+   )
+{
+   SCIP_CONSHDLR* conshdlr;
+   SCIP_RELAX* relax;
+   int i;
+
+   assert( scip != NULL );
+   assert( tabledata != NULL );
+
+   conshdlr = SCIPfindConshdlr(scip, "SDP");
+   if ( conshdlr != NULL )
+      SCIPconshdlrSdpResetPeakMemory(conshdlr);
+
+   conshdlr = SCIPfindConshdlr(scip, "SDPrank1");
+   if ( conshdlr != NULL )
+      SCIPconshdlrSdpResetPeakMemory(conshdlr);
+
+   relax = SCIPfindRelax(scip, "SDP");
+   if ( relax != NULL )
+      SCIPrelaxSdpResetPeakSdpiMemory(relax);
+
+   conshdlr = SCIPfindConshdlr(scip, "Savesdpsol");
+   if ( conshdlr != NULL )
+      SCIPconshdlrSavesdpsolResetPeakMemory(conshdlr);
+
+   for (i = 0; i < SDPMEM_NCATEGORIES; ++i)
+      tabledata->peak[i] = 0;
+}
+
+
+/*
+ * Callback methods of event handler
+ */
+
+/** execution method of event handler: samples the memory after each solved node */
+static
+SCIP_DECL_EVENTEXEC(eventExecSdpMemory)
+{  /*lint --e{715}*/
+   SCIP_TABLEDATA* tabledata;
+   int i;
+
+   assert( scip != NULL );
+   assert( eventdata != NULL );
+
+   tabledata = (SCIP_TABLEDATA*) eventdata;
+
+   sampleMemory(scip, tabledata);
+
+   if ( tabledata->printfreq > 0 && SCIPgetNNodes(scip) % tabledata->printfreq == 0 )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "SDP memory (MB) after %" SCIP_LONGINT_FORMAT " nodes:", SCIPgetNNodes(scip));
+      for (i = 0; i < SDPMEM_NCATEGORIES; ++i)
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, " %s %.2f%s", categorynames[i],
+            (SCIP_Real) tabledata->current[i] / 1048576.0, i < SDPMEM_NCATEGORIES - 1 ? "," : "\n");
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of statistics table
+ */
+
+/** copy method for statistics table plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_TABLECOPY(tableCopySdpMemory)
+{  /*lint --e{715}*/
+   assert( scip != NULL );
+   assert( table != NULL );
+
+   SCIP_CALL( SCIPincludeTableSdpMemory(scip) );
+
+   return SCIP_OKAY;
+}
+
+
+/** destructor of statistics table to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_TABLEFREE(tableFreeSdpMemory)
+{  /*lint --e{715}*/
+   SCIP_TABLEDATA* tabledata;
+
+   assert( scip != NULL );
+   assert( table != NULL );
+   tabledata = SCIPtableGetData(table);
+   assert( tabledata != NULL );
+
+   SCIPfreeMemory(scip, &tabledata);
+   SCIPtableSetData(table, NULL);
+
+   return SCIP_OKAY;
+}
+
+
+/** solving process initialization method of statistics table (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_TABLEINITSOL(tableInitsolSdpMemory)
+{  /*lint --e{715}*/
+   SCIP_TABLEDATA* tabledata;
+
+   assert( table != NULL );
+   tabledata = SCIPtableGetData(table);
+   assert( tabledata != NULL );
+   assert( tabledata->eventhdlr != NULL );
+
+   /* the peaks refer to the solving process, so forget the memory used during presolving */
+   resetPeakMemory(scip, tabledata);
+
+   /* sample after presolving, then after each solved node */
+   sampleMemory(scip, tabledata);
+   SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODESOLVED, tabledata->eventhdlr, (SCIP_EVENTDATA*) tabledata, &tabledata->filterpos) );
+
+   return SCIP_OKAY;
+}
+
+
+/** solving process deinitialization method of statistics table (called before branch and bound process data is freed) */
+static
+SCIP_DECL_TABLEEXITSOL(tableExitsolSdpMemory)
+{  /*lint --e{715}*/
+   SCIP_TABLEDATA* tabledata;
+
+   assert( table != NULL );
+   tabledata = SCIPtableGetData(table);
+   assert( tabledata != NULL );
+
+   if ( tabledata->filterpos >= 0 )
+   {
+      SCIP_CALL( SCIPdropEvent(scip, SCIP_EVENTTYPE_NODESOLVED, tabledata->eventhdlr, (SCIP_EVENTDATA*) tabledata, tabledata->filterpos) );
+      tabledata->filterpos = -1;
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUT(tableOutputSdpMemory)
+{  /*lint --e{715}*/
+   SCIP_TABLEDATA* tabledata;
+   int i;
+
+   assert( scip != NULL );
+   assert( table != NULL );
+
+   tabledata = SCIPtableGetData(table);
+   assert( tabledata != NULL );
+
+   sampleMemory(scip, tabledata);
+
+   SCIPinfoMessage(scip, file, "SDP Memory (MB)    :    Current       Peak\n");
+   for (i = 0; i < SDPMEM_NCATEGORIES; ++i)
+   {
+      SCIPinfoMessage(scip, file, "  %-17.17s: %10.2f %10.2f\n", categorynames[i],
+         (SCIP_Real) tabledata->current[i] / 1048576.0, (SCIP_Real) tabledata->peak[i] / 1048576.0);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * statistics table specific interface methods
+ */
+
+/** creates the SDP memory statistics table and includes it in SCIP */
+SCIP_RETCODE SCIPincludeTableSdpMemory(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_TABLEDATA* tabledata;
+   int i;
+
+   assert( scip != NULL );
+
+   /* create statistics table data */
+   SCIP_CALL( SCIPallocMemory(scip, &tabledata) );
+   tabledata->filterpos = -1;
+   for (i = 0; i < SDPMEM_NCATEGORIES; ++i)
+   {
+      tabledata->current[i] = 0;
+      tabledata->peak[i] = 0;
+   }
+
+   /* include event handler for sampling */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &tabledata->eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecSdpMemory, NULL) );
+   assert( tabledata->eventhdlr != NULL );
+
+   /* include statistics table */
+   SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME, TABLE_DESC, TABLE_ACTIVE,
+         tableCopySdpMemory, tableFreeSdpMemory, NULL, NULL,
+         tableInitsolSdpMemory, tableExitsolSdpMemory, tableOutputSdpMemory,
+         tabledata, TABLE_POSITION, TABLE_EARLIEST_STAGE) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "table/" TABLE_NAME "/printfreq",
+         "frequency (in nodes) for printing the current memory of SCIP-SDP data structures during the solving process (0: never)",
+         &tabledata->printfreq, FALSE, DEFAULT_PRINTFREQ, 0, INT_MAX, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
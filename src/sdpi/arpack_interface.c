@@ -232,12 +232,36 @@ SCIP_RETCODE SCIParpackComputeSmallestEigenvector(
 }
 
 
-/** computes an eigenvector for the smallest eigenvalue of a symmetric matrix using ARPACK; specialized sparse version for mu A - B */  /*lint -e{715}*/
+/** data for computing eigenvectors of mu A - B for several values of mu
+ *
+ *  The nonzeros of A and B are stored in one list, such that a matrix-vector multiplication is a single pass over the
+ *  nonzeros. The ARPACK workspace is kept and the last eigenvector is used as starting vector of the next computation.
+ */
+struct SCIP_ArpackOneVar
+{
+   int                   n;                  /**< size of matrices */
+   int                   annonz;             /**< number of nonzeros of A (stored first) */
+   int                   nnonz;              /**< total number of nonzeros of A and B */
+   int*                  row;                /**< row-indices of nonzeros of A and B */
+   int*                  col;                /**< column-indices of nonzeros of A and B */
+   SCIP_Real*            aval;               /**< values of nonzeros of A */
+   SCIP_Real*            val;                /**< values of nonzeros of mu A - B for current mu */
+   SCIP_Real             mu;                 /**< current value of mu (SCIP_INVALID if not yet set) */
+   int                   ncv;                /**< number of Lanczos vectors */
+   int                   lworkl;             /**< size of WORKL */
+   SCIP_Real*            resid;              /**< ARPACK residual vector, contains starting vector on input */
+   SCIP_Real*            v;                  /**< ARPACK Lanczos basis */
+   SCIP_Real*            workd;              /**< ARPACK work array for reverse communication */
+   SCIP_Real*            workl;              /**< ARPACK work array */
+   SCIP_Bool             haswarmstart;       /**< whether resid contains the last eigenvector */
+};
+
+/** creates data for computing eigenvectors of mu A - B for several values of mu */  /*lint -e{715}*/
 SCIP_EXPORT
-SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
+SCIP_RETCODE SCIParpackCreateOneVar(
    BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_ARPACKONEVAR**   arpackdata,         /**< pointer to store data */
    int                   n,                  /**< size of matrix */
-   SCIP_Real             mu,                 /**< scaling factor for A matrix */
    int                   annonz,             /**< number of nonzero elements in A */
    int*                  arow,               /**< array of row-indices of A */
    int*                  acol,               /**< array of column-indices of A */
@@ -245,7 +269,101 @@ SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
    int                   bnnonz,             /**< number of nonzero elements in B */
    int*                  brow,               /**< array of row-indices of nonzero matrix entries in B */
    int*                  bcol,               /**< array of column-indices of nonzero matrix entries in B*/
-   SCIP_Real*            bval,               /**< array of nonzero values in B */
+   SCIP_Real*            bval                /**< array of nonzero values in B */
+   )
+{  /*lint --e{715}*/
+   assert( arpackdata != NULL );
+
+   *arpackdata = NULL;
+
+#ifdef ARPACK
+   {
+      SCIP_ARPACKONEVAR* data;
+      int nnonz;
+      int i;
+
+      assert( bufmem != NULL );
+      assert( n > 0 );
+      assert( n < INT_MAX );
+      assert( annonz == 0 || (arow != NULL && acol != NULL && aval != NULL) );
+      assert( bnnonz == 0 || (brow != NULL && bcol != NULL && bval != NULL) );
+
+      BMS_CALL( BMSallocBufferMemory(bufmem, arpackdata) );
+      data = *arpackdata;
+
+      nnonz = annonz + bnnonz;
+      data->n = n;
+      data->annonz = annonz;
+      data->nnonz = nnonz;
+      data->mu = SCIP_INVALID;
+      data->ncv = MIN(n, 4);
+      data->lworkl = data->ncv * (data->ncv + 8);  /* must be at least NCV**2 + 8*NCV */
+      data->haswarmstart = FALSE;
+
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->row, MAX(nnonz, 1)) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->col, MAX(nnonz, 1)) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->aval, MAX(annonz, 1)) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->val, MAX(nnonz, 1)) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->resid, n) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->v, n * data->ncv) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->workd, 3 * n) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &data->workl, data->lworkl) );
+
+      /* store nonzeros of A first; the values of B do not depend on mu */
+      for (i = 0; i < annonz; ++i)
+      {
+         assert( 0 <= arow[i] && arow[i] < n );
+         assert( 0 <= acol[i] && acol[i] < n );
+         data->row[i] = arow[i];
+         data->col[i] = acol[i];
+         data->aval[i] = aval[i];
+      }
+      for (i = 0; i < bnnonz; ++i)
+      {
+         assert( 0 <= brow[i] && brow[i] < n );
+         assert( 0 <= bcol[i] && bcol[i] < n );
+         data->row[annonz + i] = brow[i];
+         data->col[annonz + i] = bcol[i];
+         data->val[annonz + i] = - bval[i];
+      }
+   }
+#endif
+
+   return SCIP_OKAY;
+}
+
+/** frees data for computing eigenvectors of mu A - B */
+SCIP_EXPORT
+void SCIParpackFreeOneVar(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_ARPACKONEVAR**   arpackdata          /**< pointer to data */
+   )
+{
+   assert( arpackdata != NULL );
+
+   if ( *arpackdata == NULL )
+      return;
+
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->workl);
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->workd);
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->v);
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->resid);
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->val);
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->aval);
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->col);
+   BMSfreeBufferMemoryArray(bufmem, &(*arpackdata)->row);
+   BMSfreeBufferMemory(bufmem, arpackdata);
+}
+
+/** computes an eigenvector for the smallest eigenvalue of mu A - B using ARPACK with the given data
+ *
+ *  The eigenvector of the previous call is used as starting vector, which usually saves many iterations if mu changes
+ *  only slightly.
+ */  /*lint -e{715}*/
+SCIP_EXPORT
+SCIP_RETCODE SCIParpackOneVarComputeSmallestEigenvector(
+   SCIP_ARPACKONEVAR*    arpackdata,         /**< data for eigenvector computations */
+   SCIP_Real             mu,                 /**< scaling factor for A matrix */
    SCIP_Real*            eigenvalue,         /**< pointer to store eigenvalue */
    SCIP_Real*            eigenvector         /**< array for eigenvector */
    )
@@ -266,25 +384,40 @@ SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
    SCIP_Real* WORKD;
    SCIP_Real* WORKL;
    SCIP_Real* V;
+   SCIP_Real* val;
    SCIP_Real TOL;
    SCIP_Real SIGMA;
    char BMAT;
    char WHICH[2];
    char HOWMNY;
+   int* row;
+   int* col;
+   int nnonz;
+   int n;
    int i;
 
-   assert( bufmem != NULL );
-   assert( n > 0 );
-   assert( n < INT_MAX );
-   assert( arow != NULL );
-   assert( acol != NULL );
-   assert( aval != NULL );
-   assert( brow != NULL );
-   assert( bcol != NULL );
-   assert( bval != NULL );
+   assert( arpackdata != NULL );
    assert( eigenvalue != NULL );
    assert( eigenvector != NULL );
 
+   n = arpackdata->n;
+   nnonz = arpackdata->nnonz;
+   row = arpackdata->row;
+   col = arpackdata->col;
+   val = arpackdata->val;
+   RESID = arpackdata->resid;
+   V = arpackdata->v;
+   WORKD = arpackdata->workd;
+   WORKL = arpackdata->workl;
+
+   /* update values of the A part */
+   if ( mu != arpackdata->mu )  /*lint !e777*/
+   {
+      for (i = 0; i < arpackdata->annonz; ++i)
+         val[i] = mu * arpackdata->aval[i];
+      arpackdata->mu = mu;
+   }
+
    IDO = 0;
    BMAT = 'I';
    N = n;
@@ -292,18 +425,15 @@ SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
    WHICH[1] = 'A';
    NEV = 1;
    TOL = 0.0;
-   NCV = MIN(n,4);
+   NCV = arpackdata->ncv;
    LDV = n;
    IPARAM[0] = 1;       /* exact shifts */
    IPARAM[2] = MAXITER; /* maximal number of iterations */
    IPARAM[6] = 1;       /* Mode 1: A*x = lambda*x, A symmetric, => OP = A  and  B = I. */
-   LWORKL = NCV * (NCV + 8);  /* must be at least NCV**2 + 8*NCV */
-   INFO = 0;            /* use random starting vector */
+   LWORKL = arpackdata->lworkl;
 
-   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &RESID, n) );
-   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &V, n * NCV) );
-   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &WORKD, 3 * n) );
-   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &WORKL, LWORKL) );
+   /* use the last eigenvector as starting vector (it is still stored in RESID) or a random starting vector */
+   INFO = arpackdata->haswarmstart ? 1 : 0;
 
    /* enter loop with "reverse communication interface" */
    do
@@ -331,30 +461,17 @@ SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
          x = &WORKD[IPNTR[0] - 1];   /* input vector */
          y = &WORKD[IPNTR[1] - 1];   /* output vector */
 
-         /* perform matrix vector multiplication */
+         /* perform matrix vector multiplication with mu A - B */
          for (i = 0; i < n; ++i)
             y[i] = 0.0;
 
-         for (i = 0; i < annonz; ++i)
-         {
-            r = arow[i];
-            c = acol[i];
-            assert( 0 <= r && r < n );
-            assert( 0 <= c && c < n );
-            y[r] += mu * aval[i] * x[c];
-            if ( r != c )
-               y[c] += mu * aval[i] * x[r];
-         }
-
-         for (i = 0; i < bnnonz; ++i)
+         for (i = 0; i < nnonz; ++i)
          {
-            r = brow[i];
-            c = bcol[i];
-            assert( 0 <= r && r < n );
-            assert( 0 <= c && c < n );
-            y[r] -= bval[i] * x[c];
+            r = row[i];
+            c = col[i];
+            y[r] += val[i] * x[c];
             if ( r != c )
-               y[c] -= bval[i] * x[r];
+               y[c] += val[i] * x[r];
          }
       }
    }
@@ -389,15 +506,45 @@ SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
       return SCIP_ERROR;
    }
 
-   /* copy handle output */
+   /* copy output and keep eigenvector as starting vector for the next call */
    for (i = 0; i < n; ++i)
+   {
       eigenvector[i] = V[i];
+      RESID[i] = V[i];
+   }
+   arpackdata->haswarmstart = TRUE;
+#endif
 
-   /* free memory */
-   BMSfreeBufferMemoryArray(bufmem, &WORKL);
-   BMSfreeBufferMemoryArray(bufmem, &WORKD);
-   BMSfreeBufferMemoryArray(bufmem, &V);
-   BMSfreeBufferMemoryArray(bufmem, &RESID);
+   return SCIP_OKAY;
+}
+
+/** computes an eigenvector for the smallest eigenvalue of a symmetric matrix using ARPACK; specialized sparse version for mu A - B */  /*lint -e{715}*/
+SCIP_EXPORT
+SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   int                   n,                  /**< size of matrix */
+   SCIP_Real             mu,                 /**< scaling factor for A matrix */
+   int                   annonz,             /**< number of nonzero elements in A */
+   int*                  arow,               /**< array of row-indices of A */
+   int*                  acol,               /**< array of column-indices of A */
+   SCIP_Real*            aval,               /**< array of nonzero values of entries of A */
+   int                   bnnonz,             /**< number of nonzero elements in B */
+   int*                  brow,               /**< array of row-indices of nonzero matrix entries in B */
+   int*                  bcol,               /**< array of column-indices of nonzero matrix entries in B*/
+   SCIP_Real*            bval,               /**< array of nonzero values in B */
+   SCIP_Real*            eigenvalue,         /**< pointer to store eigenvalue */
+   SCIP_Real*            eigenvector         /**< array for eigenvector */
+   )
+{  /*lint --e{715}*/
+#ifdef ARPACK
+   SCIP_ARPACKONEVAR* arpackdata;
+
+   assert( eigenvalue != NULL );
+   assert( eigenvector != NULL );
+
+   SCIP_CALL( SCIParpackCreateOneVar(bufmem, &arpackdata, n, annonz, arow, acol, aval, bnnonz, brow, bcol, bval) );
+   SCIP_CALL( SCIParpackOneVarComputeSmallestEigenvector(arpackdata, mu, eigenvalue, eigenvector) );
+   SCIParpackFreeOneVar(bufmem, &arpackdata);
 #endif
 
    return SCIP_OKAY;
@@ -44,6 +44,8 @@
 extern "C" {
 #endif
 
+typedef struct SCIP_ArpackOneVar SCIP_ARPACKONEVAR;   /**< data for computing eigenvectors of mu A - B for several values of mu */
+
 /** computes an eigenvector for the smallest eigenvalue of a symmetric matrix using ARPACK */
 SCIP_EXPORT
 SCIP_RETCODE SCIParpackComputeSmallestEigenvector(
@@ -72,6 +74,41 @@ SCIP_RETCODE SCIParpackComputeSmallestEigenvectorOneVar(
    SCIP_Real*            eigenvector         /**< array for eigenvector */
    );
 
+/** creates data for computing eigenvectors of mu A - B for several values of mu (sets data to NULL if ARPACK is not available) */
+SCIP_EXPORT
+SCIP_RETCODE SCIParpackCreateOneVar(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_ARPACKONEVAR**   arpackdata,         /**< pointer to store data */
+   int                   n,                  /**< size of matrix */
+   int                   annonz,             /**< number of nonzero elements in A */
+   int*                  arow,               /**< array of row-indices of A */
+   int*                  acol,               /**< array of column-indices of A */
+   SCIP_Real*            aval,               /**< array of nonzero values of entries of A */
+   int                   bnnonz,             /**< number of nonzero elements in B */
+   int*                  brow,               /**< array of row-indices of nonzero matrix entries in B */
+   int*                  bcol,               /**< array of column-indices of nonzero matrix entries in B*/
+   SCIP_Real*            bval                /**< array of nonzero values in B */
+   );
+
+/** frees data for computing eigenvectors of mu A - B */
+SCIP_EXPORT
+void SCIParpackFreeOneVar(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_ARPACKONEVAR**   arpackdata          /**< pointer to data */
+   );
+
+/** computes an eigenvector for the smallest eigenvalue of mu A - B using ARPACK with the given data
+ *
+ *  The eigenvector of the previous call is used as starting vector.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIParpackOneVarComputeSmallestEigenvector(
+   SCIP_ARPACKONEVAR*    arpackdata,         /**< data for eigenvector computations */
+   SCIP_Real             mu,                 /**< scaling factor for A matrix */
+   SCIP_Real*            eigenvalue,         /**< pointer to store eigenvalue */
+   SCIP_Real*            eigenvector         /**< array for eigenvector */
+   );
+
 #ifdef __cplusplus
 }
 #endif
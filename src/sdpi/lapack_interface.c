@@ -58,6 +58,10 @@
 /*lint --e{788,818}*/
 
 /* use int type from Openblas if available */
+#ifdef OMP
+#include <omp.h>
+#endif
+
 #ifdef OPENBLAS
 #include <cblas.h>
 typedef blasint LAPACKINTTYPE;
@@ -80,6 +84,9 @@ typedef long long int LAPACKINTTYPE;
 /** transforms a SCIP_Real (that should be integer, but might be off by some numerical error) to an integer by adding 0.5 and rounding down */
 #define SCIP_RealTOINT(x) ((LAPACKINTTYPE) (x + 0.5))
 
+/** minimal matrix size for which BLAS/LAPACK calls use more than one thread */
+#define MINPARALLELSIZE 200
+
 /*
  * BLAS/LAPACK Calls
  */
@@ -106,6 +113,15 @@ void F77_FUNC(dsyevx, DSYEVX)(char* JOBZ, char* RANGE, char* UPLO,
    LAPACKINTTYPE* LDZ, SCIP_Real* WORK, LAPACKINTTYPE* LWORK, LAPACKINTTYPE* IWORK,
    LAPACKINTTYPE* IFAIL, LAPACKINTTYPE* INFO);
 
+/** LAPACK Fortran subroutine DSPEVX (symmetric matrix in packed storage) */
+void F77_FUNC(dspevx, DSPEVX)(char* JOBZ, char* RANGE, char* UPLO,
+   LAPACKINTTYPE* N, SCIP_Real* AP,
+   SCIP_Real* VL, SCIP_Real* VU,
+   LAPACKINTTYPE* IL, LAPACKINTTYPE* IU,
+   SCIP_Real* ABSTOL, LAPACKINTTYPE* M, SCIP_Real* W, SCIP_Real* Z,
+   LAPACKINTTYPE* LDZ, SCIP_Real* WORK, LAPACKINTTYPE* IWORK,
+   LAPACKINTTYPE* IFAIL, LAPACKINTTYPE* INFO);
+
 /** BLAS Fortran subroutine DGEMV */
 void F77_FUNC(dgemv, DGEMV)(char* TRANS, LAPACKINTTYPE* M,
    LAPACKINTTYPE* N, SCIP_Real* ALPHA, SCIP_Real* A, LAPACKINTTYPE* LDA,
@@ -163,6 +179,284 @@ int convertToInt(
 }
 
 
+/*
+ * Threading policy
+ */
+
+/**@name Threading policy
+ *
+ * All BLAS/LAPACK calls of SCIP-SDP and the SDP solvers use one multi-threaded BLAS library. To avoid oversubscription,
+ * the number of BLAS threads is controlled here:
+ * - Calls within parallel regions of plugins (see SCIPlapackEnterParallelRegion()) run single-threaded; the number of
+ *   threads is never changed inside such a region.
+ * - If a number of threads is set with SCIPlapackSetNThreads(), calls on small matrices run single-threaded, since the
+ *   overhead of starting threads dominates, and calls on large matrices and the SDP solvers use up to this number.
+ * - Otherwise (-1, the default), the number of threads of the BLAS library is left unchanged, so that the environment
+ *   variables OMP_NUM_THREADS and OPENBLAS_NUM_THREADS are respected. If the policy had to change it (within a parallel
+ *   region or in deterministic mode), the number of threads from before the first change is restored.
+ * - In deterministic mode (see SCIPlapackSetDeterministic()), all calls and the SDP solvers run single-threaded, since
+ *   multi-threaded BLAS routines split sums into partial sums per thread, so their results depend on the number of
+ *   threads.
+ *
+ * The number of BLAS threads can only be changed if OpenBLAS is used; otherwise the policy has no effect.
+ *
+ * The state of the policy is global to the process, like the number of threads of the BLAS library itself. If several
+ * SCIP instances run in one process, they share these settings, and the last call of SCIPlapackSetNThreads() or
+ * SCIPlapackSetDeterministic() applies to all of them.
+ */
+/**@{ */
+
+static int maxnthreads = -1;                 /**< maximal number of BLAS threads (-1: leave the BLAS library unchanged) */
+static int origblasnthreads = 0;             /**< number of BLAS threads before the first change by the policy (0: unchanged) */
+static int paralleldepth = 0;                /**< depth of nested parallel regions of plugins */
+static SCIP_Bool deterministic = FALSE;      /**< Should the results be independent of the number of threads? */
+
+/** sets the number of BLAS threads if it changed; must not be called within a parallel region
+ *
+ *  The current number is queried from BLAS instead of being stored here, since it may also be changed by other code.
+ *  Before the first change, the number of threads of the BLAS library is recorded, see restoreBlasNThreads().
+ */
+static
+void setBlasNThreads(
+   int                   nthreads            /**< number of threads */
+   )
+{  /*lint --e{715}*/
+   assert( nthreads >= 1 );
+
+#ifdef OPENBLAS
+   {
+      int currentnthreads;
+
+      currentnthreads = openblas_get_num_threads();
+      if ( nthreads != currentnthreads )
+      {
+         if ( origblasnthreads == 0 )
+            origblasnthreads = currentnthreads;
+         openblas_set_num_threads(nthreads);
+      }
+   }
+#endif
+}
+
+/** restores the number of BLAS threads from before the first change by the policy; does nothing if it was never changed */
+static
+void restoreBlasNThreads(
+   void
+   )
+{
+   if ( origblasnthreads > 0 )
+      setBlasNThreads(origblasnthreads);
+}
+
+/** returns whether we are within a parallel region, in which the number of BLAS threads must not be changed */
+static
+SCIP_Bool inParallelRegion(
+   void
+   )
+{
+   if ( paralleldepth > 0 )
+      return TRUE;
+#ifdef OMP
+   if ( omp_in_parallel() )
+      return TRUE;
+#endif
+   return FALSE;
+}
+
+/** applies the threading policy to a BLAS/LAPACK call on a matrix of the given size */
+static
+void applyThreadingPolicy(
+   int                   size                /**< size of the matrix of the call */
+   )
+{
+   if ( inParallelRegion() )
+      return;
+
+   if ( deterministic )
+      setBlasNThreads(1);
+   else if ( maxnthreads > 0 )
+      setBlasNThreads(size < MINPARALLELSIZE ? 1 : maxnthreads);
+   else
+      restoreBlasNThreads();
+}
+
+/** sets the maximal number of threads used by BLAS/LAPACK (-1: leave the number of threads of the BLAS library unchanged) */
+void SCIPlapackSetNThreads(
+   int                   nthreads            /**< maximal number of threads */
+   )
+{
+   assert( nthreads == -1 || nthreads >= 1 );
+
+   maxnthreads = nthreads;
+}
+
+/** returns the maximal number of threads used by BLAS/LAPACK (-1: the number of threads of the BLAS library is left unchanged) */
+int SCIPlapackGetNThreads(
+   void
+   )
+{
+   return maxnthreads;
+}
+
+/** sets whether the results of BLAS/LAPACK calls and the SDP solvers should be independent of the number of threads
+ *
+ *  If set, all calls run single-threaded.
+ */
+void SCIPlapackSetDeterministic(
+   SCIP_Bool             value               /**< Should the results be independent of the number of threads? */
+   )
+{
+   deterministic = value;
+}
+
+/** sets the number of BLAS threads before calling an SDP solver and returns the number of threads the solver should use
+ *
+ *  If called within a parallel region or in deterministic mode, the solver has to run single-threaded. If the maximal
+ *  number of threads is requested but no maximal number is set with SCIPlapackSetNThreads(), the number of BLAS threads
+ *  is left unchanged and 0 is returned, i.e., the solver should choose the number of threads itself.
+ */
+int SCIPlapackSetSolverNThreads(
+   int                   nthreads            /**< number of threads requested by the solver (-1: maximal number) */
+   )
+{
+   if ( inParallelRegion() )
+      return 1;
+
+   if ( deterministic )
+   {
+      setBlasNThreads(1);
+      return 1;
+   }
+
+   if ( nthreads <= 0 && maxnthreads <= 0 )
+   {
+      restoreBlasNThreads();
+      return 0;
+   }
+
+   if ( nthreads <= 0 )
+      nthreads = maxnthreads;
+   else if ( maxnthreads > 0 )
+      nthreads = MIN(nthreads, maxnthreads);
+
+   setBlasNThreads(nthreads);
+
+   return nthreads;
+}
+
+/** marks the beginning of a parallel region of a plugin, within which BLAS/LAPACK calls run single-threaded
+ *
+ *  Has to be called by the thread that starts the parallel region, before the region is entered.
+ */
+void SCIPlapackEnterParallelRegion(
+   void
+   )
+{
+   assert( paralleldepth >= 0 );
+
+   if ( paralleldepth == 0 )
+   {
+#ifdef OMP
+      if ( ! omp_in_parallel() )
+#endif
+         setBlasNThreads(1);
+   }
+   ++paralleldepth;
+}
+
+/** marks the end of a parallel region of a plugin */
+void SCIPlapackLeaveParallelRegion(
+   void
+   )
+{
+   assert( paralleldepth > 0 );
+
+   --paralleldepth;
+}
+
+/**@} */
+
+
+/** calls DSPEVX for a symmetric matrix given by its lower triangular part in row-wise packed storage
+ *
+ *  The lower triangular part stored row by row is the upper triangular part stored column by column, which is the
+ *  packed format of LAPACK with UPLO = 'U'. Thus, the matrix can be passed without conversion.
+ */
+static
+SCIP_RETCODE callDspevx(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   char                  JOBZ,               /**< 'N': only eigenvalues, 'V': also eigenvectors */
+   char                  RANGE,              /**< 'V': eigenvalues in (VL, VU], 'I': eigenvalues IL to IU */
+   int                   n,                  /**< size of matrix */
+   SCIP_Real*            AP,                 /**< packed matrix (length n(n+1)/2) - will be destroyed! */
+   SCIP_Real             VL,                 /**< lower bound of interval (RANGE = 'V') */
+   SCIP_Real             VU,                 /**< upper bound of interval (RANGE = 'V') */
+   int                   IL,                 /**< index of smallest eigenvalue to be computed (RANGE = 'I') */
+   int                   IU,                 /**< index of largest eigenvalue to be computed (RANGE = 'I') */
+   int*                  neigenvalues,       /**< pointer to store the number of computed eigenvalues */
+   SCIP_Real*            eigenvalues,        /**< array for eigenvalues (length n) */
+   SCIP_Real*            eigenvectors        /**< array for eigenvectors (length n * number of eigenvalues) or NULL */
+   )
+{
+   LAPACKINTTYPE* IWORK;
+   LAPACKINTTYPE* IFAIL;
+   LAPACKINTTYPE N;
+   LAPACKINTTYPE INFO;
+   LAPACKINTTYPE LIL;
+   LAPACKINTTYPE LIU;
+   LAPACKINTTYPE M;
+   LAPACKINTTYPE LDZ;
+   SCIP_Real* WORK;
+   SCIP_Real ABSTOL;
+   char UPLO;
+
+   assert( bufmem != NULL );
+   assert( n > 0 );
+   assert( AP != NULL );
+   assert( neigenvalues != NULL );
+   assert( eigenvalues != NULL );
+   assert( JOBZ == 'N' || eigenvectors != NULL );
+
+   N = n;
+   UPLO = 'U';
+   ABSTOL = 0.0;  /* we use abstol = 0, since some lapack return an error otherwise */
+   LIL = IL;
+   LIU = IU;
+   M = 0;
+   LDZ = n;
+   INFO = 0LL;
+
+   /* DSPEVX has no workspace query, the sizes are fixed */
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &WORK, 8 * n) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &IWORK, 5 * n) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &IFAIL, n) );
+
+   applyThreadingPolicy(n);
+
+   F77_FUNC(dspevx, DSPEVX)( &JOBZ, &RANGE, &UPLO,
+      &N, AP,
+      &VL, &VU,
+      &LIL, &LIU,
+      &ABSTOL, &M, eigenvalues, eigenvectors,
+      &LDZ, WORK, IWORK,
+      IFAIL, &INFO);
+
+   BMSfreeBufferMemoryArray(bufmem, &IFAIL);
+   BMSfreeBufferMemoryArray(bufmem, &IWORK);
+   BMSfreeBufferMemoryArray(bufmem, &WORK);
+
+   if ( convertToInt(INFO) != 0 )
+   {
+      SCIPerrorMessage("There was an error when calling DSPEVX. INFO = %d.\n", convertToInt(INFO));
+      return SCIP_ERROR;
+   }
+
+   *neigenvalues = convertToInt(M);
+
+   return SCIP_OKAY;
+}
+
+
 /*
  * Functions
  */
@@ -229,6 +523,8 @@ SCIP_RETCODE SCIPlapackComputeIthEigenvalue(
    LWORK = -1LL;
    LIWORK = -1LL;
 
+   applyThreadingPolicy(n);
+
    /* this computes the internally needed memory and returns this as (the first entries of [the 1x1 arrays]) WSIZE and WISIZE */
    F77_FUNC(dsyevr, DSYEVR)( &JOBZ, &RANGE, &UPLO,
       &N, NULL, &LDA,
@@ -339,6 +635,8 @@ SCIP_RETCODE SCIPlapackComputeIthEigenvalueAlternative(
    /* standard LAPACK workspace query, to get the amount of needed memory */
    LWORK = -1LL;
 
+   applyThreadingPolicy(n);
+
    /* this computes the internally needed memory and returns this as (the first entries of [the 1x1 arrays]) WSIZE */
    F77_FUNC(dsyevx, DSYEVX)( &JOBZ, &RANGE, &UPLO,
       &N, NULL, &LDA,
@@ -395,7 +693,7 @@ SCIP_RETCODE SCIPlapackComputeEigenvectorsNegative(
    BMS_BUFMEM*           bufmem,             /**< buffer memory */
    int                   n,                  /**< size of matrix */
    SCIP_Real*            A,                  /**< matrix for which eigenvectors should be computed - will be destroyed! */
-   SCIP_Real             tol,                /**< tolerance; the eigenvalues will be in the interval (-1e20, -tol] */
+   SCIP_Real             tol,                /**< tolerance; the eigenvalues will be in the interval (-1e30, -tol] */
    int*                  neigenvalues,       /**< pointer to store the number of negative eigenvalues */
    SCIP_Real*            eigenvalues,        /**< array for eigenvalues (should be length n) */
    SCIP_Real*            eigenvectors        /**< array for eigenvectors (should be length n*n), eigenvectors are given as rows  */
@@ -447,6 +745,8 @@ SCIP_RETCODE SCIPlapackComputeEigenvectorsNegative(
    LWORK = -1LL;
    LIWORK = -1LL;
 
+   applyThreadingPolicy(n);
+
    /* this computes the internally needed memory and returns this as (the first entries of [the 1x1 arrays]) WSIZE and WISIZE */
    F77_FUNC(dsyevr, DSYEVR)( &JOBZ, &RANGE, &UPLO,
       &N, NULL, &LDA,
@@ -498,6 +798,76 @@ SCIP_RETCODE SCIPlapackComputeEigenvectorsNegative(
    return SCIP_OKAY;
 }
 
+/** computes the i-th eigenvalue of a symmetric matrix using LAPACK, where 1 is the smallest and n the largest, matrix
+ *  has to be given by its lower triangular part in row-wise packed storage, i.e., entry (r,c) with c <= r is at
+ *  position r(r+1)/2 + c
+ */
+SCIP_RETCODE SCIPlapackComputeIthEigenvaluePacked(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_Bool             geteigenvectors,    /**< Should also the eigenvectors be computed? */
+   int                   n,                  /**< size of matrix */
+   SCIP_Real*            AP,                 /**< packed matrix (length n(n+1)/2) - will be destroyed! */
+   int                   i,                  /**< index of eigenvalue to be computed */
+   SCIP_Real*            eigenvalue,         /**< pointer to store eigenvalue */
+   SCIP_Real*            eigenvector         /**< pointer to array to store eigenvector */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Real* WTMP;
+   int m = 0;
+
+   assert( bufmem != NULL );
+   assert( n > 0 );
+   assert( n < INT_MAX );
+   assert( AP != NULL );
+   assert( 0 < i && i <= n );
+   assert( eigenvalue != NULL );
+   assert( ! geteigenvectors || eigenvector != NULL );
+
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &WTMP, n) );
+
+   retcode = callDspevx(bufmem, geteigenvectors ? 'V' : 'N', 'I', n, AP, -1e20, 1e20, i, i, &m, WTMP,
+      geteigenvectors ? eigenvector : NULL);
+
+   /* handle output */
+   if ( retcode == SCIP_OKAY )
+   {
+      assert( m == 1 );
+      *eigenvalue = WTMP[0];
+   }
+
+   BMSfreeBufferMemoryArray(bufmem, &WTMP);
+
+   return retcode;
+}
+
+/** computes eigenvectors corresponding to negative eigenvalues of a symmetric matrix using LAPACK, matrix has to be
+ *  given by its lower triangular part in row-wise packed storage, i.e., entry (r,c) with c <= r is at position
+ *  r(r+1)/2 + c
+ */
+SCIP_RETCODE SCIPlapackComputeEigenvectorsNegativePacked(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   int                   n,                  /**< size of matrix */
+   SCIP_Real*            AP,                 /**< packed matrix (length n(n+1)/2) - will be destroyed! */
+   SCIP_Real             tol,                /**< tolerance; the eigenvalues will be in the interval (-1e30, -tol] */
+   int*                  neigenvalues,       /**< pointer to store the number of negative eigenvalues */
+   SCIP_Real*            eigenvalues,        /**< array for eigenvalues (should be length n) */
+   SCIP_Real*            eigenvectors        /**< array for eigenvectors (should be length n*n), eigenvectors are given as rows  */
+   )
+{
+   assert( bufmem != NULL );
+   assert( n > 0 );
+   assert( n < INT_MAX );
+   assert( AP != NULL );
+   assert( tol >= 0 );
+   assert( neigenvalues != NULL );
+   assert( eigenvalues != NULL );
+   assert( eigenvectors != NULL );
+
+   SCIP_CALL( callDspevx(bufmem, 'V', 'V', n, AP, -1e30, -tol, 0, 0, neigenvalues, eigenvalues, eigenvectors) );
+
+   return SCIP_OKAY;
+}
 
 /** computes the eigenvector decomposition of a symmetric matrix using LAPACK */
 SCIP_RETCODE SCIPlapackComputeEigenvectorDecomposition(
@@ -550,6 +920,8 @@ SCIP_RETCODE SCIPlapackComputeEigenvectorDecomposition(
    LWORK = -1LL;
    LIWORK = -1LL;
 
+   applyThreadingPolicy(n);
+
    /* this computes the internally needed memory and returns this as (the first entries of [the 1x1 arrays]) WSIZE and WISIZE */
    F77_FUNC(dsyevr, DSYEVR)( &JOBZ, &RANGE, &UPLO,
       &N, NULL, &LDA,
@@ -640,6 +1012,8 @@ SCIP_RETCODE SCIPlapackMatrixVectorMult(
    Y = result;
    INCY = 1;
 
+   applyThreadingPolicy(MAX(nrows, ncols));
+
    F77_FUNC(dgemv, DGEMV)(&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
 
    return SCIP_OKAY;
@@ -696,6 +1070,8 @@ SCIP_RETCODE SCIPlapackMatrixMatrixMult(
    BETA = 0.0;
    LDC = M;
 
+   applyThreadingPolicy(MAX(MAX(nrowsA, ncolsA), MAX(nrowsB, ncolsB)));
+
    F77_FUNC(dgemm, DGEMM)(&TRANSA, &TRANSB, &M, &N, &K, &ALPHA, matrixA, &LDA, matrixB, &LDB, &BETA, result, &LDC);
 
    return SCIP_OKAY;
@@ -753,6 +1129,8 @@ SCIP_RETCODE SCIPlapackLinearSolve(
    /* standard LAPACK workspace query, to get the amount of needed memory */
    LWORK = -1LL;
 
+   applyThreadingPolicy(MAX(m, n));
+
    /* this computes the internally needed memory and returns this as (the first entry of [the 1x1 array]) WSIZE */
    F77_FUNC(dgelsd, DGELSD)( &M, &N, &NRHS,
       NULL, &LDA, NULL, &LDB, NULL,
@@ -45,6 +45,57 @@
 extern "C" {
 #endif
 
+/** sets the maximal number of threads used by BLAS/LAPACK (-1: leave the number of threads of the BLAS library unchanged)
+ *
+ *  Calls within parallel regions of plugins always run single-threaded. If a maximal number is set, calls on small
+ *  matrices run single-threaded as well.
+ */
+SCIP_EXPORT
+void SCIPlapackSetNThreads(
+   int                   nthreads            /**< maximal number of threads */
+   );
+
+/** returns the maximal number of threads used by BLAS/LAPACK (-1: the number of threads of the BLAS library is left unchanged) */
+SCIP_EXPORT
+int SCIPlapackGetNThreads(
+   void
+   );
+
+/** sets whether the results of BLAS/LAPACK calls and the SDP solvers should be independent of the number of threads
+ *
+ *  If set, all calls run single-threaded.
+ */
+SCIP_EXPORT
+void SCIPlapackSetDeterministic(
+   SCIP_Bool             value               /**< Should the results be independent of the number of threads? */
+   );
+
+/** sets the number of BLAS threads before calling an SDP solver and returns the number of threads the solver should use
+ *
+ *  If called within a parallel region or in deterministic mode, the solver has to run single-threaded. If the maximal
+ *  number of threads is requested but no maximal number is set with SCIPlapackSetNThreads(), the number of BLAS threads
+ *  is left unchanged and 0 is returned, i.e., the solver should choose the number of threads itself.
+ */
+SCIP_EXPORT
+int SCIPlapackSetSolverNThreads(
+   int                   nthreads            /**< number of threads requested by the solver (-1: maximal number) */
+   );
+
+/** marks the beginning of a parallel region of a plugin, within which BLAS/LAPACK calls run single-threaded
+ *
+ *  Has to be called by the thread that starts the parallel region, before the region is entered.
+ */
+SCIP_EXPORT
+void SCIPlapackEnterParallelRegion(
+   void
+   );
+
+/** marks the end of a parallel region of a plugin */
+SCIP_EXPORT
+void SCIPlapackLeaveParallelRegion(
+   void
+   );
+
 /** computes the i-th eigenvalue of a symmetric matrix using LAPACK, where 1 is the smallest and n the largest, matrix has to be given with all \f$n^2\f$ entries */
 SCIP_EXPORT
 SCIP_RETCODE SCIPlapackComputeIthEigenvalue(
@@ -75,7 +126,37 @@ SCIP_RETCODE SCIPlapackComputeEigenvectorsNegative(
    BMS_BUFMEM*           bufmem,             /**< buffer memory */
    int                   n,                  /**< size of matrix */
    SCIP_Real*            A,                  /**< matrix for which eigenvectors should be computed - will be destroyed! */
-   SCIP_Real             tol,                /**< tolerance; the eigenvalues will be in the interval (-1e20, -tol] */
+   SCIP_Real             tol,                /**< tolerance; the eigenvalues will be in the interval (-1e30, -tol] */
+   int*                  neigenvalues,       /**< pointer to store the number of negative eigenvalues */
+   SCIP_Real*            eigenvalues,        /**< array for eigenvalues (should be length n) */
+   SCIP_Real*            eigenvectors        /**< array for eigenvectors (should be length n*n), eigenvectors are given as rows  */
+   );
+
+/** computes the i-th eigenvalue of a symmetric matrix using LAPACK, where 1 is the smallest and n the largest, matrix
+ *  has to be given by its lower triangular part in row-wise packed storage, i.e., entry (r,c) with c <= r is at
+ *  position r(r+1)/2 + c
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPlapackComputeIthEigenvaluePacked(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_Bool             geteigenvectors,    /**< Should also the eigenvectors be computed? */
+   int                   n,                  /**< size of matrix */
+   SCIP_Real*            AP,                 /**< packed matrix (length n(n+1)/2) - will be destroyed! */
+   int                   i,                  /**< index of eigenvalue to be computed */
+   SCIP_Real*            eigenvalue,         /**< pointer to store eigenvalue */
+   SCIP_Real*            eigenvector         /**< pointer to array to store eigenvector */
+   );
+
+/** computes eigenvectors corresponding to negative eigenvalues of a symmetric matrix using LAPACK, matrix has to be
+ *  given by its lower triangular part in row-wise packed storage, i.e., entry (r,c) with c <= r is at position
+ *  r(r+1)/2 + c
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPlapackComputeEigenvectorsNegativePacked(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   int                   n,                  /**< size of matrix */
+   SCIP_Real*            AP,                 /**< packed matrix (length n(n+1)/2) - will be destroyed! */
+   SCIP_Real             tol,                /**< tolerance; the eigenvalues will be in the interval (-1e30, -tol] */
    int*                  neigenvalues,       /**< pointer to store the number of negative eigenvalues */
    SCIP_Real*            eigenvalues,        /**< array for eigenvalues (should be length n) */
    SCIP_Real*            eigenvectors        /**< array for eigenvectors (should be length n*n), eigenvectors are given as rows  */
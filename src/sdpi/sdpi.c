@@ -109,6 +109,7 @@
 #include "sdpi/lapack_interface.h"           /* to check feasibility if all variables are fixed during preprocessing */
 #include "sdpi/sdpiclock.h"
 #include "sdpi/solveonevarsdp.h"
+#include "sdpi/solvesmallsdp.h"
 
 #include "blockmemshell/memory.h"            /* for memory allocation */
 #include "scip/def.h"                        /* for SCIP_Real, _Bool, ... */
@@ -163,6 +164,30 @@
                       }                                                                                       \
                       while( FALSE )
 
+/** allocates an array of the SDPI and adds its size to the memory of the SDPI */
+#define SDPI_ALLOC_ARRAY(sdpi, ptr, num) do                                                                   \
+                      {                                                                                       \
+                         BMS_CALL( BMSallocBlockMemoryArray((sdpi)->blkmem, ptr, num) );                      \
+                         addMemory(sdpi, (SCIP_Longint) (num) * (SCIP_Longint) sizeof(**(ptr)));              \
+                      }                                                                                       \
+                      while( FALSE )
+
+/** duplicates an array into an array of the SDPI and adds its size to the memory of the SDPI */
+#define SDPI_DUPLICATE_ARRAY(sdpi, ptr, source, num) do                                                       \
+                      {                                                                                       \
+                         BMS_CALL( BMSduplicateBlockMemoryArray((sdpi)->blkmem, ptr, source, num) );          \
+                         addMemory(sdpi, (SCIP_Longint) (num) * (SCIP_Longint) sizeof(**(ptr)));              \
+                      }                                                                                       \
+                      while( FALSE )
+
+/** reallocates an array of the SDPI and adds the change of its size to the memory of the SDPI */
+#define SDPI_REALLOC_ARRAY(sdpi, ptr, oldnum, newnum) do                                                      \
+                      {                                                                                       \
+                         BMS_CALL( BMSreallocBlockMemoryArray((sdpi)->blkmem, ptr, oldnum, newnum) );         \
+                         addMemory(sdpi, ((SCIP_Longint) (newnum) - (SCIP_Longint) (oldnum)) * (SCIP_Longint) sizeof(**(ptr))); \
+                      }                                                                                       \
+                      while( FALSE )
+
 /** same as SCIP_CALL, but gives a SCIP_PARAMETERUNKNOWN error if it fails */
 #define SCIP_CALL_PARAM(x)   do                                                                               \
                       {                                                                                       \
@@ -201,6 +226,10 @@
 #define DEFAULT_PENALTYPARAM        1e+5     /**< the starting penalty parameter Gamma used for the penalty formulation if the SDP-solver didn't converge */
 #define DEFAULT_MAXPENALTYPARAM     1e+10    /**< the maximal penalty parameter Gamma used for the penalty formulation if the SDP-solver didn't converge */
 #define DEFAULT_NPENALTYINCR        8        /**< maximal number of times the penalty parameter will be increased if penalty formulation failed */
+#define MAXNCERTIFICATES            20       /**< maximal number of infeasibility certificates that are stored */
+#define MAXNSMALLSDPVARS            10       /**< maximal number of active variables for solving the SDP by the barrier method for few variables */
+#define MAXSMALLSDPBLOCKSIZE        100      /**< maximal block size for solving the SDP by the barrier method for few variables */
+#define MAXSMALLSDPITER             200      /**< maximal number of Newton steps of the barrier method for few variables */
 
 /** one variable SDP status */
 enum SCIP_Onevar_Status
@@ -254,6 +283,7 @@ struct SCIP_SDPi
    int*                  sdprowstore;        /**< array to store all rows */
    int*                  sdpcolstore;        /**< array to store all columns */
    SCIP_Real*            sdpvalstore;        /**< array to store all nonzeros */
+   SCIP_Bool             sdpsorted;          /**< whether the nonzeros of all SDP matrices are sorted by row, then col, without duplicates */
 
    /* lp data: */
    int                   nlpcons;            /**< number of LP-constraints */
@@ -282,11 +312,27 @@ struct SCIP_SDPi
    int*                  sdpilpbeg;          /**< working space for start index of each row in ind- and val-array */
    int*                  sdpilpind;          /**< working space for column-index for each entry in lpval-array */
    SCIP_Real*            sdpilpval;          /**< working space for values of LP-constraint matrix entries */
+   int                   maxnsdpiconstblocks; /**< number of blocks for which the working space for the constant matrix is allocated */
+   int*                  sdpiconstnblocknonz; /**< working space for number of nonzeros in the constant matrix after fixings */
+   int*                  maxsdpiconstnblocknonz; /**< size of the working space for the constant matrix for each block */
+   int**                 sdpiconstrow;       /**< working space for row-indices of the constant matrix after fixings */
+   int**                 sdpiconstcol;       /**< working space for column-indices of the constant matrix after fixings */
+   SCIP_Real**           sdpiconstval;       /**< working space for values of the constant matrix after fixings */
+
+   /* infeasibility certificates v^T (sum_j A_j y_j - A_0) v >= 0 of previously infeasible SDPs */
+   int                   ncertificates;      /**< number of stored infeasibility certificates */
+   int                   nextcertificate;    /**< position at which the next certificate is stored (oldest one is replaced) */
+   int*                  certnvars;          /**< number of variables in each certificate */
+   int*                  maxcertnvars;       /**< length of the arrays of each certificate */
+   int**                 certvars;           /**< indices of the variables of each certificate */
+   SCIP_Real**           certcoefs;          /**< coefficients v^T A_j v of the variables of each certificate */
+   SCIP_Real*            certconst;          /**< constant v^T A_0 v of each certificate */
 
    /* statistics */
-   int                   ninfeasible;        /**< total number of times infeasibility was detected in presolving */
+   int                   ninfeasible;        /**< total number of times infeasibility was detected in presolving (including stored certificates) */
    int                   nallfixed;          /**< total number of times all variables were fixed */
    int                   nonevarsdp;         /**< total number of times a one variable SDP was solved */
+   int                   nworkspaceallocs;   /**< total number of times the working space of the constant matrix had to be enlarged */
 
    /* other data */
    int                   slatercheck;        /**< should the Slater condition for the dual problem be checked ahead of each solving process */
@@ -317,6 +363,15 @@ struct SCIP_SDPi
    int                   onevarsdpcertsize;  /**< block size for one variable SDP certificate vector */
    SCIP_Real             onevarsdpcertval;   /**< one variable SDP certificate value (supergradient) */
    SCIP_Real**           allfixedeigenvecs;  /**< eigenvectors for instances if all variables are fixed */
+   SCIP_Bool             smallsdp;           /**< whether the SDP was solved by the barrier method for few variables (solvedonevarsdp is then optimal) */
+   int                   maxsmallsdpnvars;   /**< length of the solution arrays of the barrier method for few variables */
+   int                   maxsmallsdpsize;    /**< length of the primal matrix of the barrier method for few variables */
+   SCIP_Real*            smallsdpsol;        /**< solution of the barrier method for few variables (for all variables) */
+   SCIP_Real*            smallsdplbvals;     /**< primal values corresponding to the lower bounds of the barrier method for few variables */
+   SCIP_Real*            smallsdpubvals;     /**< primal values corresponding to the upper bounds of the barrier method for few variables */
+   SCIP_Real*            smallsdpprimalmatrix; /**< primal matrix of the barrier method for few variables */
+   SCIP_Longint          memory;             /**< number of bytes allocated for the data of the SDPI */
+   SCIP_Longint          peakmemory;         /**< maximal number of bytes allocated since the last reset */
 };
 
 
@@ -350,6 +405,28 @@ SCIP_Bool isFixed(
 #define isFixed(sdpi, v) (sdpi->sdpiub[v] - sdpi->sdpilb[v] <= sdpi->epsilon)
 #endif
 
+/** sorts the given nonzeros by row, then col, and returns whether they are free of duplicates */
+static
+SCIP_Bool sortNonzeros(
+   int*                  row,                /**< row indices */
+   int*                  col,                /**< column indices */
+   SCIP_Real*            val,                /**< values */
+   int                   nnonz               /**< number of nonzeros */
+   )
+{
+   int j;
+
+   SCIPsdpVarfixerSortRowCol(row, col, val, nnonz);
+
+   for (j = 1; j < nnonz; ++j)
+   {
+      if ( row[j-1] == row[j] && col[j-1] == col[j] )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
 /** calculate memory size for dynamically allocated arrays */
 static
 int calcGrowSize(
@@ -385,6 +462,20 @@ int calcGrowSize(
    return size;
 }
 
+/** adds a change of the allocated memory to the memory of the SDPI and updates the peak */
+static
+void addMemory(
+   SCIP_SDPI*            sdpi,               /**< SDP-interface structure */
+   SCIP_Longint          nbytes              /**< number of allocated (positive) or freed (negative) bytes */
+   )
+{
+   assert( sdpi != NULL );
+
+   sdpi->memory += nbytes;
+   assert( sdpi->memory >= 0 );
+   sdpi->peakmemory = MAX(sdpi->peakmemory, sdpi->memory);
+}
+
 /** ensure size of bound data */
 static
 SCIP_RETCODE ensureBoundDataMemory(
@@ -400,14 +491,14 @@ SCIP_RETCODE ensureBoundDataMemory(
    {
       newsize = calcGrowSize(sdpi->maxnvars, nvars);
 
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->obj), sdpi->maxnvars, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->lb), sdpi->maxnvars, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->ub), sdpi->maxnvars, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->isintegral), sdpi->maxnvars, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilb), sdpi->maxnvars, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpiub), sdpi->maxnvars, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilbrowidx), sdpi->maxnvars, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpiubrowidx), sdpi->maxnvars, newsize) );
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->obj), sdpi->maxnvars, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->lb), sdpi->maxnvars, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->ub), sdpi->maxnvars, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->isintegral), sdpi->maxnvars, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilb), sdpi->maxnvars, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiub), sdpi->maxnvars, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilbrowidx), sdpi->maxnvars, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiubrowidx), sdpi->maxnvars, newsize);
       sdpi->maxnvars = newsize;
    }
 
@@ -430,14 +521,14 @@ SCIP_RETCODE ensureLPDataMemory(
    {
       newsize = calcGrowSize(sdpi->maxnlpcons, nlpcons);
 
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->lplhs), sdpi->maxnlpcons, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->lprhs), sdpi->maxnlpcons, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->lpbeg), sdpi->maxnlpcons, newsize) );
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->lplhs), sdpi->maxnlpcons, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->lprhs), sdpi->maxnlpcons, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->lpbeg), sdpi->maxnlpcons, newsize);
 
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilpindchanges), sdpi->maxnlpcons, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilplhs), sdpi->maxnlpcons, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilprhs), sdpi->maxnlpcons, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilpbeg), sdpi->maxnlpcons, newsize) );
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilpindchanges), sdpi->maxnlpcons, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilplhs), sdpi->maxnlpcons, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilprhs), sdpi->maxnlpcons, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilpbeg), sdpi->maxnlpcons, newsize);
 
       sdpi->maxnlpcons = newsize;
    }
@@ -446,11 +537,11 @@ SCIP_RETCODE ensureLPDataMemory(
    {
       newsize = calcGrowSize(sdpi->maxlpnnonz, nlpnonz);
 
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->lpind), sdpi->maxlpnnonz, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->lpval), sdpi->maxlpnnonz, newsize) );
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->lpind), sdpi->maxlpnnonz, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->lpval), sdpi->maxlpnnonz, newsize);
 
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilpind), sdpi->maxlpnnonz, newsize) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpilpval), sdpi->maxlpnnonz, newsize) );
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilpind), sdpi->maxlpnnonz, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpilpval), sdpi->maxlpnnonz, newsize);
 
       sdpi->maxlpnnonz = newsize;
    }
@@ -458,6 +549,68 @@ SCIP_RETCODE ensureLPDataMemory(
    return SCIP_OKAY;
 }
 
+/** ensure size of the working space for the constant matrix after fixings
+ *
+ *  The working space is only enlarged and kept between solves, such that it is sized to the largest SDP solved so far.
+ */
+static
+SCIP_RETCODE ensureConstWorkspaceMemory(
+   SCIP_SDPI*            sdpi                /**< pointer to an SDP-interface structure */
+   )
+{
+   int oldnblocks;
+   int newsize;
+   int b;
+
+   assert( sdpi != NULL );
+
+   if ( sdpi->nsdpblocks > sdpi->maxnsdpiconstblocks )
+   {
+      oldnblocks = sdpi->maxnsdpiconstblocks;
+      newsize = calcGrowSize(sdpi->maxnsdpiconstblocks, sdpi->nsdpblocks);
+
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiconstnblocknonz), sdpi->maxnsdpiconstblocks, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->maxsdpiconstnblocknonz), sdpi->maxnsdpiconstblocks, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiconstrow), sdpi->maxnsdpiconstblocks, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiconstcol), sdpi->maxnsdpiconstblocks, newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiconstval), sdpi->maxnsdpiconstblocks, newsize);
+
+      for (b = oldnblocks; b < newsize; ++b)
+      {
+         sdpi->maxsdpiconstnblocknonz[b] = 0;
+         sdpi->sdpiconstrow[b] = NULL;
+         sdpi->sdpiconstcol[b] = NULL;
+         sdpi->sdpiconstval[b] = NULL;
+      }
+      sdpi->maxnsdpiconstblocks = newsize;
+      ++sdpi->nworkspaceallocs;
+   }
+
+   for (b = 0; b < sdpi->nsdpblocks; ++b)
+   {
+      int nnonz;
+
+      /* the constant matrix after fixings has at most as many nonzeros as all matrices together and at most as many as the lower triangle */
+      nnonz = MIN(sdpi->sdpnnonz + sdpi->sdpconstnnonz, sdpi->sdpblocksizes[b] * (sdpi->sdpblocksizes[b] + 1) / 2);
+
+      if ( nnonz > sdpi->maxsdpiconstnblocknonz[b] )
+      {
+         newsize = calcGrowSize(sdpi->maxsdpiconstnblocknonz[b], nnonz);
+
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiconstrow[b]), sdpi->maxsdpiconstnblocknonz[b], newsize); /*lint !e776*/
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiconstcol[b]), sdpi->maxsdpiconstnblocknonz[b], newsize); /*lint !e776*/
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpiconstval[b]), sdpi->maxsdpiconstnblocknonz[b], newsize); /*lint !e776*/
+         sdpi->maxsdpiconstnblocknonz[b] = newsize;
+         ++sdpi->nworkspaceallocs;
+      }
+
+      /* reset the available space, compConstMatAfterFixings() reduces it to the number of nonzeros actually used */
+      sdpi->sdpiconstnblocknonz[b] = sdpi->maxsdpiconstnblocknonz[b];
+   }
+
+   return SCIP_OKAY;
+}
+
 /** ensure size of SDP data */
 static
 SCIP_RETCODE ensureSDPDataMemory(
@@ -487,9 +640,9 @@ SCIP_RETCODE ensureSDPDataMemory(
 
    if ( sdpnnonz > sdpi->maxsdpstore )
    {
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdprowstore), sdpi->maxsdpstore, sdpnnonz) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpcolstore), sdpi->maxsdpstore, sdpnnonz) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpvalstore), sdpi->maxsdpstore, sdpnnonz) );
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdprowstore), sdpi->maxsdpstore, sdpnnonz);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpcolstore), sdpi->maxsdpstore, sdpnnonz);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpvalstore), sdpi->maxsdpstore, sdpnnonz);
       sdpi->maxsdpstore = sdpnnonz;
    }
    sdpi->sdpnnonz = sdpnnonz;
@@ -500,27 +653,27 @@ SCIP_RETCODE ensureSDPDataMemory(
       oldnsdpblocks = sdpi->maxnsdpblocks;
 
       /* the following array pointers are all initialized (possibly with NULL) */
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpblocksizes), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpnblockvars), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->maxsdpnblockvars), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->maxsdpblocksizes), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstnblocknonz), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->maxsdpconstnblocknonz), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpnblockvarnonz), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstcol), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstrow), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstval), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpvar), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpcol), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdprow), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpval), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->indchanges), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->nremovedinds), sdpi->maxnsdpblocks, nsdpblocks) );
-      BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->blockindchanges), sdpi->maxnsdpblocks, nsdpblocks) );
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpblocksizes), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpnblockvars), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->maxsdpnblockvars), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->maxsdpblocksizes), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpconstnblocknonz), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->maxsdpconstnblocknonz), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpnblockvarnonz), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpconstcol), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpconstrow), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpconstval), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpvar), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpcol), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdprow), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpval), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->indchanges), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->nremovedinds), sdpi->maxnsdpblocks, nsdpblocks);
+      SDPI_REALLOC_ARRAY(sdpi, &(sdpi->blockindchanges), sdpi->maxnsdpblocks, nsdpblocks);
       assert( allfixedeigenvecs || sdpi->allfixedeigenvecs == NULL );
       if ( allfixedeigenvecs )
       {
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->allfixedeigenvecs), sdpi->maxnsdpblocks, nsdpblocks) );
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->allfixedeigenvecs), sdpi->maxnsdpblocks, nsdpblocks);
       }
       sdpi->maxnsdpblocks = nsdpblocks;
    }
@@ -533,29 +686,29 @@ SCIP_RETCODE ensureSDPDataMemory(
       /* the following array pointers should be initialized */
       if ( sdpconstnblocknonz[b] > sdpi->maxsdpconstnblocknonz[b] )
       {
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstcol[b]), sdpi->maxsdpconstnblocknonz[b], sdpconstnblocknonz[b]) );
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstrow[b]), sdpi->maxsdpconstnblocknonz[b], sdpconstnblocknonz[b]) );
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstval[b]), sdpi->maxsdpconstnblocknonz[b], sdpconstnblocknonz[b]) );
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpconstcol[b]), sdpi->maxsdpconstnblocknonz[b], sdpconstnblocknonz[b]);
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpconstrow[b]), sdpi->maxsdpconstnblocknonz[b], sdpconstnblocknonz[b]);
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpconstval[b]), sdpi->maxsdpconstnblocknonz[b], sdpconstnblocknonz[b]);
          sdpi->maxsdpconstnblocknonz[b] = sdpconstnblocknonz[b];
       }
 
       if ( sdpnblockvars[b] > sdpi->maxsdpnblockvars[b] )
       {
          assert( sdpi->sdpnblockvarnonz[b] != NULL );
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpnblockvarnonz[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]) );
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpvar[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]) );
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdprow[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]) );
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpcol[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]) );
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpval[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]) );
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpnblockvarnonz[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]);
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpvar[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]);
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdprow[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]);
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpcol[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]);
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->sdpval[b]), sdpi->maxsdpnblockvars[b], sdpnblockvars[b]);
          sdpi->maxsdpnblockvars[b] = sdpnblockvars[b];
       }
 
       if ( sdpblocksizes[b] > sdpi->maxsdpblocksizes[b] )
       {
-         BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->indchanges[b]), sdpi->maxsdpblocksizes[b], sdpblocksizes[b]) );
+         SDPI_REALLOC_ARRAY(sdpi, &(sdpi->indchanges[b]), sdpi->maxsdpblocksizes[b], sdpblocksizes[b]);
          if ( allfixedeigenvecs )
          {
-            BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->allfixedeigenvecs[b]), sdpi->maxsdpblocksizes[b], sdpblocksizes[b]) );
+            SDPI_REALLOC_ARRAY(sdpi, &(sdpi->allfixedeigenvecs[b]), sdpi->maxsdpblocksizes[b], sdpblocksizes[b]);
          }
          sdpi->maxsdpblocksizes[b] = sdpblocksizes[b];
       }
@@ -574,16 +727,16 @@ SCIP_RETCODE ensureSDPDataMemory(
    /* loop through new blocks */
    for (b = oldnsdpblocks; b < nsdpblocks; ++b)
    {
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpnblockvarnonz[b]), sdpnblockvars[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpvar[b]), sdpnblockvars[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdprow[b]), sdpnblockvars[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpcol[b]), sdpnblockvars[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpval[b]), sdpnblockvars[b]) );
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdpnblockvarnonz[b]), sdpnblockvars[b]);
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdpvar[b]), sdpnblockvars[b]);
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdprow[b]), sdpnblockvars[b]);
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdpcol[b]), sdpnblockvars[b]);
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdpval[b]), sdpnblockvars[b]);
       sdpi->maxsdpnblockvars[b] = sdpnblockvars[b];
 
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstcol[b]), sdpconstnblocknonz[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstrow[b]), sdpconstnblocknonz[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->sdpconstval[b]), sdpconstnblocknonz[b]) );
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdpconstcol[b]), sdpconstnblocknonz[b]);
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdpconstrow[b]), sdpconstnblocknonz[b]);
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->sdpconstval[b]), sdpconstnblocknonz[b]);
       sdpi->maxsdpconstnblocknonz[b] = sdpconstnblocknonz[b];
 
       /* set pointers into storage */
@@ -594,10 +747,10 @@ SCIP_RETCODE ensureSDPDataMemory(
          sdpi->sdpval[b][v] = &sdpi->sdpvalstore[cnt];
          cnt += sdpnblockvarnonz[b][v];
       }
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->indchanges[b]), sdpblocksizes[b]) );
+      SDPI_ALLOC_ARRAY(sdpi, &(sdpi->indchanges[b]), sdpblocksizes[b]);
       if ( allfixedeigenvecs )
       {
-         BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->allfixedeigenvecs[b]), sdpblocksizes[b]) );
+         SDPI_ALLOC_ARRAY(sdpi, &(sdpi->allfixedeigenvecs[b]), sdpblocksizes[b]);
       }
       sdpi->maxsdpblocksizes[b] = sdpblocksizes[b];
    }
@@ -649,6 +802,7 @@ SCIP_RETCODE compConstMatAfterFixings(
    for (b = 0; b < sdpi->nsdpblocks; ++b)
    {
       int nfixednonz = 0;
+      int nfixedblockvars = 0;
       int varidx;
 
       for (v = 0; v < sdpi->sdpnblockvars[b]; ++v)
@@ -656,6 +810,7 @@ SCIP_RETCODE compConstMatAfterFixings(
          varidx = sdpi->sdpvar[b][v];
          if ( isFixed(sdpi, varidx) && REALABS(sdpilb[varidx]) > sdpi->epsilon )
          {
+            ++nfixedblockvars;
             for (i = 0; i < sdpi->sdpnblockvarnonz[b][v]; ++i)
             {
                fixedrows[nfixednonz] = sdpi->sdprow[b][v][i];
@@ -666,9 +821,10 @@ SCIP_RETCODE compConstMatAfterFixings(
          }
       }
 
+      /* the stored matrices are sorted, so only the nonzeros of several fixed variables need to be sorted */
       SCIP_CALL( SCIPsdpVarfixerMergeArraysIntoNew(sdpi->blkmem, sdpi->epsilon,
-            sdpi->sdpconstrow[b], sdpi->sdpconstcol[b], sdpi->sdpconstval[b], sdpi->sdpconstnblocknonz[b],
-            fixedrows, fixedcols, fixedvals, nfixednonz,
+            sdpi->sdpconstrow[b], sdpi->sdpconstcol[b], sdpi->sdpconstval[b], sdpi->sdpconstnblocknonz[b], sdpi->sdpsorted,
+            fixedrows, fixedcols, fixedvals, nfixednonz, sdpi->sdpsorted && nfixedblockvars <= 1,
             sdpconstrow[b], sdpconstcol[b], sdpconstval[b], &sdpconstnblocknonz[b]) );
       *sdpconstnnonz += sdpconstnblocknonz[b];
    }
@@ -1365,6 +1521,179 @@ SCIP_RETCODE prepareLPData(
    return SCIP_OKAY;
 }
 
+/** checks whether the given stored certificate proves infeasibility for the current bounds
+ *
+ *  The certificate proves infeasibility if the maximum of \f$\sum_j (v^T A_j v)\, y_j - v^T A_0 v\f$ over the bounds
+ *  is negative.
+ */
+static
+SCIP_Bool certificateIsValid(
+   SCIP_SDPI*            sdpi,               /**< pointer to an SDP-interface structure */
+   int                   nvars,              /**< number of variables in certificate */
+   int*                  vars,               /**< indices of variables in certificate */
+   SCIP_Real*            coefs,              /**< coefficients of variables in certificate */
+   SCIP_Real             constant,           /**< constant of certificate */
+   SCIP_Real*            sdpilb,             /**< array of lower bounds */
+   SCIP_Real*            sdpiub              /**< array of upper bounds */
+   )
+{
+   SCIP_Real maxval;
+   int i;
+
+   assert( sdpi != NULL );
+   assert( nvars == 0 || vars != NULL );
+   assert( nvars == 0 || coefs != NULL );
+
+   maxval = -constant;
+   for (i = 0; i < nvars; ++i)
+   {
+      SCIP_Real bound;
+
+      if ( coefs[i] > sdpi->epsilon )
+         bound = sdpiub[vars[i]];
+      else if ( coefs[i] < -sdpi->epsilon )
+         bound = sdpilb[vars[i]];
+      else
+         continue;
+
+      if ( SCIPsdpiIsInfinity(sdpi, REALABS(bound)) )
+         return FALSE;
+
+      maxval += coefs[i] * bound;
+   }
+
+   return maxval < -sdpi->feastol;
+}
+
+/** stores the certificate v^T (sum_j A_j y_j - A_0) v >= 0 for the given vector and SDP-block if it proves infeasibility for the current bounds */
+static
+SCIP_RETCODE addInfeasibilityCertificate(
+   SCIP_SDPI*            sdpi,               /**< pointer to an SDP-interface structure */
+   int                   block,              /**< SDP-block of certificate */
+   SCIP_Real*            vec                 /**< vector v of length sdpblocksizes[block] */
+   )
+{
+   SCIP_Real* coefs;
+   SCIP_Real constant = 0.0;
+   int pos;
+   int nvars;
+   int i;
+   int v;
+
+   assert( sdpi != NULL );
+   assert( 0 <= block && block < sdpi->nsdpblocks );
+   assert( vec != NULL );
+
+   nvars = sdpi->sdpnblockvars[block];
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &coefs, MAX(nvars, 1)) );
+
+   /* compute v^T A_0 v (only the lower triangular part is stored) */
+   for (i = 0; i < sdpi->sdpconstnblocknonz[block]; ++i)
+   {
+      int r = sdpi->sdpconstrow[block][i];
+      int c = sdpi->sdpconstcol[block][i];
+
+      constant += sdpi->sdpconstval[block][i] * vec[r] * vec[c];
+      if ( r != c )
+         constant += sdpi->sdpconstval[block][i] * vec[c] * vec[r];
+   }
+
+   /* compute v^T A_j v for all variables of the block */
+   for (v = 0; v < nvars; ++v)
+   {
+      coefs[v] = 0.0;
+      for (i = 0; i < sdpi->sdpnblockvarnonz[block][v]; ++i)
+      {
+         int r = sdpi->sdprow[block][v][i];
+         int c = sdpi->sdpcol[block][v][i];
+
+         coefs[v] += sdpi->sdpval[block][v][i] * vec[r] * vec[c];
+         if ( r != c )
+            coefs[v] += sdpi->sdpval[block][v][i] * vec[c] * vec[r];
+      }
+   }
+
+   /* only keep the certificate if it is valid for the current bounds (the eigenvector might not be an exact certificate) */
+   if ( ! certificateIsValid(sdpi, nvars, sdpi->sdpvar[block], coefs, constant, sdpi->sdpilb, sdpi->sdpiub) )
+   {
+      BMSfreeBufferMemoryArray(sdpi->bufmem, &coefs);
+      return SCIP_OKAY;
+   }
+
+   /* allocate storage for certificates */
+   if ( sdpi->certnvars == NULL )
+   {
+      SDPI_ALLOC_ARRAY(sdpi, &sdpi->certnvars, MAXNCERTIFICATES);
+      SDPI_ALLOC_ARRAY(sdpi, &sdpi->maxcertnvars, MAXNCERTIFICATES);
+      SDPI_ALLOC_ARRAY(sdpi, &sdpi->certvars, MAXNCERTIFICATES);
+      SDPI_ALLOC_ARRAY(sdpi, &sdpi->certcoefs, MAXNCERTIFICATES);
+      SDPI_ALLOC_ARRAY(sdpi, &sdpi->certconst, MAXNCERTIFICATES);
+      for (i = 0; i < MAXNCERTIFICATES; ++i)
+      {
+         sdpi->certnvars[i] = 0;
+         sdpi->maxcertnvars[i] = 0;
+         sdpi->certvars[i] = NULL;
+         sdpi->certcoefs[i] = NULL;
+      }
+   }
+
+   /* replace the oldest certificate if the storage is full */
+   pos = sdpi->nextcertificate;
+   assert( 0 <= pos && pos < MAXNCERTIFICATES );
+
+   if ( nvars > sdpi->maxcertnvars[pos] )
+   {
+      int newsize;
+
+      newsize = calcGrowSize(sdpi->maxcertnvars[pos], nvars);
+      SDPI_REALLOC_ARRAY(sdpi, &sdpi->certvars[pos], sdpi->maxcertnvars[pos], newsize);
+      SDPI_REALLOC_ARRAY(sdpi, &sdpi->certcoefs[pos], sdpi->maxcertnvars[pos], newsize);
+      sdpi->maxcertnvars[pos] = newsize;
+   }
+
+   if ( nvars > 0 )
+   {
+      BMScopyMemoryArray(sdpi->certvars[pos], sdpi->sdpvar[block], nvars);
+      BMScopyMemoryArray(sdpi->certcoefs[pos], coefs, nvars);
+   }
+   sdpi->certnvars[pos] = nvars;
+   sdpi->certconst[pos] = constant;
+   sdpi->nextcertificate = (pos + 1) % MAXNCERTIFICATES;
+   if ( sdpi->ncertificates < MAXNCERTIFICATES )
+      ++sdpi->ncertificates;
+
+   SCIPdebugMessage("Stored infeasibility certificate for block %d with %d variables (%d stored).\n", block, nvars, sdpi->ncertificates);
+
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &coefs);
+
+   return SCIP_OKAY;
+}
+
+/** checks whether one of the stored certificates proves infeasibility for the current bounds */
+static
+SCIP_Bool checkInfeasibilityCertificates(
+   SCIP_SDPI*            sdpi,               /**< pointer to an SDP-interface structure */
+   SCIP_Real*            sdpilb,             /**< array of lower bounds */
+   SCIP_Real*            sdpiub              /**< array of upper bounds */
+   )
+{
+   int i;
+
+   assert( sdpi != NULL );
+   assert( 0 <= sdpi->ncertificates && sdpi->ncertificates <= MAXNCERTIFICATES );
+
+   for (i = 0; i < sdpi->ncertificates; ++i)
+   {
+      if ( certificateIsValid(sdpi, sdpi->certnvars[i], sdpi->certvars[i], sdpi->certcoefs[i], sdpi->certconst[i], sdpilb, sdpiub) )
+      {
+         SCIPdebugMessage("Stored infeasibility certificate %d proves infeasibility.\n", i);
+         return TRUE;
+      }
+   }
+
+   return FALSE;
+}
+
 /** If all variables are fixed, check whether the remaining solution is feasible for the SDP-constraints (LP-constraints
  *  should have been checked already during preprocessing)
  */
@@ -1376,6 +1705,7 @@ SCIP_RETCODE checkFixedFeasibilitySdp(
    )
 {
    SCIP_Real* fullmatrix; /* we need to give the full matrix to LAPACK */
+   SCIP_Real* eigenvector;
    int maxsize = -1;
    int b;
    int i;
@@ -1395,12 +1725,14 @@ SCIP_RETCODE checkFixedFeasibilitySdp(
 
    /* allocate memory */
    BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &fullmatrix, maxsize * maxsize) ); /*lint !e647*/
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &eigenvector, maxsize) );
 
    /* iterate over all SDP-blocks and check if the smallest eigenvalue is non-negative */
    for (b = 0; b < sdpi->nsdpblocks; b++)
    {
       SCIP_Real eigenvalue;
       SCIP_Real fixedval;
+      SCIP_Real* vec;
       int size;
       int r;
       int c;
@@ -1449,31 +1781,266 @@ SCIP_RETCODE checkFixedFeasibilitySdp(
          }
       }
 
-      /* compute the smallest eigenvalue */
-      if ( sdpi->allfixedeigenvecs != NULL )
-      {
-         SCIP_CALL( SCIPlapackComputeIthEigenvalue(sdpi->bufmem, TRUE, size, fullmatrix, 1, &eigenvalue, sdpi->allfixedeigenvecs[b]) );
-      }
-      else
-      {
-         SCIP_CALL( SCIPlapackComputeIthEigenvalue(sdpi->bufmem, FALSE, size, fullmatrix, 1, &eigenvalue, NULL) );
-      }
+      /* compute the smallest eigenvalue; the eigenvector is always needed as an infeasibility certificate */
+      vec = sdpi->allfixedeigenvecs != NULL ? sdpi->allfixedeigenvecs[b] : eigenvector;
+      SCIP_CALL( SCIPlapackComputeIthEigenvalue(sdpi->bufmem, TRUE, size, fullmatrix, 1, &eigenvalue, vec) );
 
       /* check if the eigenvalue is negative */
       if ( eigenvalue < - sdpi->feastol )
       {
          sdpi->infeasible = TRUE;
          SCIPdebugMessage("Detected infeasibility for SDP %d with all variables fixed (minimal eigenvalue: %g)!\n", sdpi->sdpid, eigenvalue);
+
+         /* store the eigenvector for a quick check of later SDPs */
+         SCIP_CALL( addInfeasibilityCertificate(sdpi, b, vec) );
          break;
       }
    }
 
    /* free memory */
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &eigenvector);
    BMSfreeBufferMemoryArray(sdpi->bufmem, &fullmatrix);
 
    return SCIP_OKAY;
 }
 
+/** solves the SDP by the barrier method for few variables (see SCIPsolveSmallSDP())
+ *
+ *  Assumes that there is one SDP block and no active LP row. Empty rows and columns of the block are removed before. If
+ *  the method does not converge, the SDP is left unsolved.
+ */
+static
+SCIP_RETCODE solveSmallSDP(
+   SCIP_SDPI*            sdpi,               /**< pointer to an SDP-interface structure */
+   int                   nactivevars,        /**< number of active variables */
+   SCIP_Real             fixedvarsobjcontr,  /**< objective contribution of the fixed variables */
+   int                   sdpconstnnonz,      /**< number of nonzeros of the constant matrix after fixings */
+   int*                  sdpconstrow,        /**< row-indices of the constant matrix after fixings */
+   int*                  sdpconstcol,        /**< column-indices of the constant matrix after fixings */
+   SCIP_Real*            sdpconstval         /**< values of the constant matrix after fixings */
+   )
+{
+   SCIP_Real* activeobj;
+   SCIP_Real* activelb;
+   SCIP_Real* activeub;
+   SCIP_Real* activesol;
+   SCIP_Real* activelbvals;
+   SCIP_Real* activeubvals;
+   SCIP_Real* primalmatrix;
+   SCIP_Real** activeval;
+   int** activerow;
+   int** activecol;
+   int* activennonz;
+   int* activevars;
+   int* blockpos;
+   int* indmap;
+   int* constrow;
+   int* constcol;
+   SCIP_Real objval;
+   int blocksize;
+   int newsize = 0;
+   int niterations;
+   int nactive = 0;
+   int i;
+   int j;
+   int v;
+
+   assert( sdpi != NULL );
+   assert( sdpi->nsdpblocks == 1 );
+   assert( sdpi->nactivelpcons == 0 );
+   assert( 0 < nactivevars && nactivevars <= sdpi->nvars );
+
+   blocksize = sdpi->sdpblocksizes[0];
+
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activevars, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activeobj, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activelb, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activeub, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activesol, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activelbvals, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activeubvals, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activennonz, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activerow, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activecol, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activeval, nactivevars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &blockpos, sdpi->nvars) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &indmap, blocksize) );
+
+   /* determine positions of the variables in the block */
+   for (v = 0; v < sdpi->nvars; ++v)
+      blockpos[v] = -1;
+   for (v = 0; v < sdpi->sdpnblockvars[0]; ++v)
+      blockpos[sdpi->sdpvar[0][v]] = v;
+
+   /* collect active variables and mark the used rows and columns */
+   for (i = 0; i < blocksize; ++i)
+      indmap[i] = -1;
+   for (i = 0; i < sdpconstnnonz; ++i)
+   {
+      indmap[sdpconstrow[i]] = 0;
+      indmap[sdpconstcol[i]] = 0;
+   }
+
+   for (v = 0; v < sdpi->nvars; ++v)
+   {
+      if ( isFixed(sdpi, v) )
+         continue;
+
+      assert( nactive < nactivevars );
+      activevars[nactive] = v;
+      activeobj[nactive] = sdpi->obj[v];
+      activelb[nactive] = sdpi->sdpilb[v];
+      activeub[nactive] = sdpi->sdpiub[v];
+      activennonz[nactive] = 0;
+      activerow[nactive] = NULL;
+      activecol[nactive] = NULL;
+      activeval[nactive] = NULL;
+
+      if ( blockpos[v] >= 0 )
+      {
+         j = blockpos[v];
+         activennonz[nactive] = sdpi->sdpnblockvarnonz[0][j];
+         activeval[nactive] = sdpi->sdpval[0][j];
+         for (i = 0; i < activennonz[nactive]; ++i)
+         {
+            indmap[sdpi->sdprow[0][j][i]] = 0;
+            indmap[sdpi->sdpcol[0][j][i]] = 0;
+         }
+      }
+      ++nactive;
+   }
+   assert( nactive == nactivevars );
+
+   /* compute new indices without empty rows and columns */
+   for (i = 0; i < blocksize; ++i)
+   {
+      if ( indmap[i] == 0 )
+         indmap[i] = newsize++;
+   }
+
+   /* if the block is empty, leave the problem to the solver */
+   if ( newsize == 0 )
+      goto TERMINATE;
+
+   /* copy indices of the constant matrix and the matrices of the active variables with new indices */
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &constrow, MAX(sdpconstnnonz, 1)) );
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &constcol, MAX(sdpconstnnonz, 1)) );
+   for (i = 0; i < sdpconstnnonz; ++i)
+   {
+      constrow[i] = indmap[sdpconstrow[i]];
+      constcol[i] = indmap[sdpconstcol[i]];
+   }
+
+   for (j = 0; j < nactivevars; ++j)
+   {
+      int pos;
+
+      if ( activennonz[j] == 0 )
+         continue;
+
+      pos = blockpos[activevars[j]];
+      BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activerow[j], activennonz[j]) );
+      BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &activecol[j], activennonz[j]) );
+      for (i = 0; i < activennonz[j]; ++i)
+      {
+         activerow[j][i] = indmap[sdpi->sdprow[0][pos][i]];
+         activecol[j][i] = indmap[sdpi->sdpcol[0][pos][i]];
+      }
+   }
+
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &primalmatrix, newsize * newsize) );
+
+   SCIP_CALL( SCIPsolveSmallSDP(sdpi->bufmem, nactivevars, activeobj, activelb, activeub, newsize,
+         sdpconstnnonz, constrow, constcol, sdpconstval, activennonz, activerow, activecol, activeval,
+         SCIPsdpiInfinity(sdpi), sdpi->gaptol, MAXSMALLSDPITER, activesol, activelbvals, activeubvals, primalmatrix, &objval, &niterations) );
+
+   sdpi->niterations += niterations;
+
+   if ( objval != SCIP_INVALID )  /*lint !e777*/
+   {
+      /* make sure that there is enough space for the solution */
+      if ( sdpi->nvars > sdpi->maxsmallsdpnvars )
+      {
+         int newsolsize;
+
+         newsolsize = calcGrowSize(sdpi->maxsmallsdpnvars, sdpi->nvars);
+         SDPI_REALLOC_ARRAY(sdpi, &sdpi->smallsdpsol, sdpi->maxsmallsdpnvars, newsolsize);
+         SDPI_REALLOC_ARRAY(sdpi, &sdpi->smallsdplbvals, sdpi->maxsmallsdpnvars, newsolsize);
+         SDPI_REALLOC_ARRAY(sdpi, &sdpi->smallsdpubvals, sdpi->maxsmallsdpnvars, newsolsize);
+         sdpi->maxsmallsdpnvars = newsolsize;
+      }
+      if ( blocksize * blocksize > sdpi->maxsmallsdpsize )
+      {
+         int newmatrixsize;
+
+         newmatrixsize = calcGrowSize(sdpi->maxsmallsdpsize, blocksize * blocksize);
+         SDPI_REALLOC_ARRAY(sdpi, &sdpi->smallsdpprimalmatrix, sdpi->maxsmallsdpsize, newmatrixsize);
+         sdpi->maxsmallsdpsize = newmatrixsize;
+      }
+
+      /* fixed variables keep their values and have zero primal values */
+      for (v = 0; v < sdpi->nvars; ++v)
+      {
+         sdpi->smallsdpsol[v] = sdpi->sdpilb[v];
+         sdpi->smallsdplbvals[v] = 0.0;
+         sdpi->smallsdpubvals[v] = 0.0;
+      }
+      for (j = 0; j < nactivevars; ++j)
+      {
+         sdpi->smallsdpsol[activevars[j]] = activesol[j];
+         sdpi->smallsdplbvals[activevars[j]] = activelbvals[j];
+         sdpi->smallsdpubvals[activevars[j]] = activeubvals[j];
+      }
+
+      /* expand primal matrix to original block size, removed rows and columns are 0 */
+      for (i = 0; i < blocksize; ++i)
+      {
+         for (j = 0; j < blocksize; ++j)
+         {
+            if ( indmap[i] >= 0 && indmap[j] >= 0 )
+               sdpi->smallsdpprimalmatrix[i * blocksize + j] = primalmatrix[indmap[i] * newsize + indmap[j]];
+            else
+               sdpi->smallsdpprimalmatrix[i * blocksize + j] = 0.0;
+         }
+      }
+
+      sdpi->solved = TRUE;
+      sdpi->dualslater = SCIP_SDPSLATER_NOINFO;
+      sdpi->primalslater = SCIP_SDPSLATER_NOINFO;
+      sdpi->solvedonevarsdp = SCIP_ONEVAR_OPTIMAL;
+      sdpi->smallsdp = TRUE;
+      sdpi->onevarsdpobjval = objval + fixedvarsobjcontr;
+
+      SCIPdebugMessage("SDP %d with %d active variables solved by barrier method in %d iterations.\n", sdpi->sdpid, nactivevars, niterations);
+   }
+
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &primalmatrix);
+   for (j = nactivevars - 1; j >= 0; --j)
+   {
+      BMSfreeBufferMemoryArrayNull(sdpi->bufmem, &activecol[j]);
+      BMSfreeBufferMemoryArrayNull(sdpi->bufmem, &activerow[j]);
+   }
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &constcol);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &constrow);
+
+ TERMINATE:
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &indmap);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &blockpos);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activeval);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activecol);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activerow);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activennonz);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activeubvals);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activelbvals);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activesol);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activeub);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activelb);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activeobj);
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &activevars);
+
+   return SCIP_OKAY;
+}
+
 /** checks primal and dual Slater condition and outputs result depending on Slater settings in SDPI as well as updating
  *  sdpisolver->primalslater and sdpisolver->dualslater
  *
@@ -1946,6 +2513,8 @@ SCIP_RETCODE SCIPsdpiCreate(
    (*sdpi)->messagehdlr = messagehdlr;
    (*sdpi)->blkmem = blkmem;
    (*sdpi)->bufmem = bufmem;
+   (*sdpi)->memory = (SCIP_Longint) sizeof(SCIP_SDPI);
+   (*sdpi)->peakmemory = (*sdpi)->memory;
    (*sdpi)->sdpid = 1;
    (*sdpi)->niterations = 0;
    (*sdpi)->opttime = 0.0;
@@ -1956,6 +2525,7 @@ SCIP_RETCODE SCIPsdpiCreate(
    (*sdpi)->maxnsdpblocks = 0;
    (*sdpi)->sdpconstnnonz = 0;
    (*sdpi)->sdpnnonz = 0;
+   (*sdpi)->sdpsorted = TRUE;
    (*sdpi)->nlpcons = 0;
    (*sdpi)->maxnlpcons = 0;
    (*sdpi)->nactivelpcons = -1;
@@ -2012,6 +2582,13 @@ SCIP_RETCODE SCIPsdpiCreate(
    (*sdpi)->sdpilpind = NULL;
    (*sdpi)->sdpilpval = NULL;
 
+   (*sdpi)->maxnsdpiconstblocks = 0;
+   (*sdpi)->sdpiconstnblocknonz = NULL;
+   (*sdpi)->maxsdpiconstnblocknonz = NULL;
+   (*sdpi)->sdpiconstrow = NULL;
+   (*sdpi)->sdpiconstcol = NULL;
+   (*sdpi)->sdpiconstval = NULL;
+
    (*sdpi)->epsilon = DEFAULT_EPSILON;
    (*sdpi)->gaptol = DEFAULT_SDPSOLVERGAPTOL;
    (*sdpi)->feastol = DEFAULT_FEASTOL;
@@ -2029,9 +2606,26 @@ SCIP_RETCODE SCIPsdpiCreate(
    (*sdpi)->onevarsdpcertsize = -1;
    (*sdpi)->onevarsdpcertval = SCIP_INVALID;
 
+   (*sdpi)->smallsdp = FALSE;
+   (*sdpi)->maxsmallsdpnvars = 0;
+   (*sdpi)->maxsmallsdpsize = 0;
+   (*sdpi)->smallsdpsol = NULL;
+   (*sdpi)->smallsdplbvals = NULL;
+   (*sdpi)->smallsdpubvals = NULL;
+   (*sdpi)->smallsdpprimalmatrix = NULL;
+
+   (*sdpi)->ncertificates = 0;
+   (*sdpi)->nextcertificate = 0;
+   (*sdpi)->certnvars = NULL;
+   (*sdpi)->maxcertnvars = NULL;
+   (*sdpi)->certvars = NULL;
+   (*sdpi)->certcoefs = NULL;
+   (*sdpi)->certconst = NULL;
+
    (*sdpi)->nallfixed = 0;
    (*sdpi)->ninfeasible = 0;
    (*sdpi)->nonevarsdp = 0;
+   (*sdpi)->nworkspaceallocs = 0;
 
    SCIP_CALL( SDPIclockCreate(&(*sdpi)->usedsdpitime) );
 
@@ -2070,6 +2664,19 @@ SCIP_RETCODE SCIPsdpiFree(
    BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->lplhs), (*sdpi)->maxnlpcons);
    BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->lpbeg), (*sdpi)->maxnlpcons);
 
+   /* free the working space for the constant matrix */
+   for (i = 0; i < (*sdpi)->maxnsdpiconstblocks; i++)
+   {
+      BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->sdpiconstval[i]), (*sdpi)->maxsdpiconstnblocknonz[i]);
+      BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->sdpiconstcol[i]), (*sdpi)->maxsdpiconstnblocknonz[i]);
+      BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->sdpiconstrow[i]), (*sdpi)->maxsdpiconstnblocknonz[i]);
+   }
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->sdpiconstval), (*sdpi)->maxnsdpiconstblocks);
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->sdpiconstcol), (*sdpi)->maxnsdpiconstblocks);
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->sdpiconstrow), (*sdpi)->maxnsdpiconstblocks);
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->maxsdpiconstnblocknonz), (*sdpi)->maxnsdpiconstblocks);
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->sdpiconstnblocknonz), (*sdpi)->maxnsdpiconstblocks);
+
    /* free the individual SDP nonzeros */
    assert( 0 <= (*sdpi)->nsdpblocks && (*sdpi)->nsdpblocks <= (*sdpi)->maxnsdpblocks );
    for (i = 0; i < (*sdpi)->maxnsdpblocks; i++)
@@ -2124,6 +2731,26 @@ SCIP_RETCODE SCIPsdpiFree(
 
    BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->onevarsdpcertvec), (*sdpi)->onevarsdpcertsize);
 
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->smallsdpprimalmatrix), (*sdpi)->maxsmallsdpsize);
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->smallsdpubvals), (*sdpi)->maxsmallsdpnvars);
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->smallsdplbvals), (*sdpi)->maxsmallsdpnvars);
+   BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->smallsdpsol), (*sdpi)->maxsmallsdpnvars);
+
+   /* free the infeasibility certificates */
+   if ( (*sdpi)->certnvars != NULL )
+   {
+      for (i = 0; i < MAXNCERTIFICATES; i++)
+      {
+         BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->certcoefs[i]), (*sdpi)->maxcertnvars[i]);
+         BMSfreeBlockMemoryArrayNull((*sdpi)->blkmem, &((*sdpi)->certvars[i]), (*sdpi)->maxcertnvars[i]);
+      }
+      BMSfreeBlockMemoryArray((*sdpi)->blkmem, &((*sdpi)->certconst), MAXNCERTIFICATES);
+      BMSfreeBlockMemoryArray((*sdpi)->blkmem, &((*sdpi)->certcoefs), MAXNCERTIFICATES);
+      BMSfreeBlockMemoryArray((*sdpi)->blkmem, &((*sdpi)->certvars), MAXNCERTIFICATES);
+      BMSfreeBlockMemoryArray((*sdpi)->blkmem, &((*sdpi)->maxcertnvars), MAXNCERTIFICATES);
+      BMSfreeBlockMemoryArray((*sdpi)->blkmem, &((*sdpi)->certnvars), MAXNCERTIFICATES);
+   }
+
    /* free the solver */
    SCIP_CALL( SCIPsdpiSolverFree(&((*sdpi)->sdpisolver)) );
 
@@ -2165,83 +2792,86 @@ SCIP_RETCODE SCIPsdpiClone(
 
    newsdpi->messagehdlr = oldsdpi->messagehdlr;
    newsdpi->blkmem = blkmem;
+   newsdpi->memory = (SCIP_Longint) sizeof(SCIP_SDPI);
+   newsdpi->peakmemory = newsdpi->memory;
    newsdpi->nvars = nvars;
    newsdpi->maxnvars = nvars;
 
    assert( 0 <= oldsdpi->nvars && oldsdpi->nvars <= oldsdpi->maxnvars );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->obj), oldsdpi->obj, nvars) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->lb), oldsdpi->lb, nvars) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->ub), oldsdpi->ub, nvars) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->isintegral), oldsdpi->isintegral, nvars) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilb), nvars) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpiub), nvars) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilbrowidx), nvars) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpiubrowidx), nvars) );
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->obj), oldsdpi->obj, nvars);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->lb), oldsdpi->lb, nvars);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->ub), oldsdpi->ub, nvars);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->isintegral), oldsdpi->isintegral, nvars);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilb), nvars);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpiub), nvars);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilbrowidx), nvars);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpiubrowidx), nvars);
 
    newsdpi->nsdpblocks = nsdpblocks;
    newsdpi->maxnsdpblocks = nsdpblocks;
 
    assert( 0 <= oldsdpi->nsdpblocks && oldsdpi->nsdpblocks <= oldsdpi->maxnsdpblocks );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpblocksizes), oldsdpi->sdpblocksizes, nsdpblocks) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpnblockvars), oldsdpi->sdpnblockvars, nsdpblocks) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->maxsdpnblockvars), oldsdpi->sdpnblockvars, nsdpblocks) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->maxsdpblocksizes), oldsdpi->sdpblocksizes, nsdpblocks) );
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpblocksizes), oldsdpi->sdpblocksizes, nsdpblocks);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpnblockvars), oldsdpi->sdpnblockvars, nsdpblocks);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->maxsdpnblockvars), oldsdpi->sdpnblockvars, nsdpblocks);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->maxsdpblocksizes), oldsdpi->sdpblocksizes, nsdpblocks);
 
    /* constant SDP data */
    newsdpi->sdpconstnnonz = oldsdpi->sdpconstnnonz;
+   newsdpi->sdpsorted = oldsdpi->sdpsorted;
 
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpconstnblocknonz), oldsdpi->sdpconstnblocknonz, nsdpblocks) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->maxsdpconstnblocknonz), oldsdpi->sdpconstnblocknonz, nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpconstrow), nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpconstcol), nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpconstval), nsdpblocks) );
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpconstnblocknonz), oldsdpi->sdpconstnblocknonz, nsdpblocks);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->maxsdpconstnblocknonz), oldsdpi->sdpconstnblocknonz, nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpconstrow), nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpconstcol), nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpconstval), nsdpblocks);
 
    for (b = 0; b < nsdpblocks; b++)
    {
-      BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpconstrow[b]), oldsdpi->sdpconstrow[b], oldsdpi->sdpconstnblocknonz[b]) );
-      BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpconstcol[b]), oldsdpi->sdpconstcol[b], oldsdpi->sdpconstnblocknonz[b]) );
-      BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpconstval[b]), oldsdpi->sdpconstval[b], oldsdpi->sdpconstnblocknonz[b]) );
+      SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpconstrow[b]), oldsdpi->sdpconstrow[b], oldsdpi->sdpconstnblocknonz[b]);
+      SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpconstcol[b]), oldsdpi->sdpconstcol[b], oldsdpi->sdpconstnblocknonz[b]);
+      SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpconstval[b]), oldsdpi->sdpconstval[b], oldsdpi->sdpconstnblocknonz[b]);
    }
 
    /* SDP data */
    newsdpi->sdpnnonz = oldsdpi->sdpnnonz;
    newsdpi->maxsdpstore = oldsdpi->sdpnnonz;
 
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpnblockvarnonz), nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpvar), nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdprow), nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpcol), nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpval), nsdpblocks) );
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpnblockvarnonz), nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpvar), nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdprow), nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpcol), nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpval), nsdpblocks);
 
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdprowstore), newsdpi->maxsdpstore) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpcolstore), newsdpi->maxsdpstore) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpvalstore), newsdpi->maxsdpstore) );
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdprowstore), newsdpi->maxsdpstore);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpcolstore), newsdpi->maxsdpstore);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpvalstore), newsdpi->maxsdpstore);
 
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->indchanges), nsdpblocks) );
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->indchanges), nsdpblocks);
    if ( oldsdpi->allfixedeigenvecs != NULL )
    {
-      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->allfixedeigenvecs), nsdpblocks) );
+      SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->allfixedeigenvecs), nsdpblocks);
    }
    else
       newsdpi->allfixedeigenvecs = NULL;
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->nremovedinds), nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->blockindchanges), nsdpblocks) );
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->nremovedinds), nsdpblocks);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->blockindchanges), nsdpblocks);
    newsdpi->nremovedblocks = 0;
 
    for (b = 0; b < nsdpblocks; b++)
    {
       assert( 0 <= oldsdpi->sdpnblockvars[b] && oldsdpi->sdpnblockvars[b] <= oldsdpi->maxsdpnblockvars[b] );
-      BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpnblockvarnonz[b]), oldsdpi->sdpnblockvarnonz[b], oldsdpi->sdpnblockvars[b]) );
-      BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->sdpvar[b]), oldsdpi->sdpvar[b], oldsdpi->sdpnblockvars[b]) );
+      SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpnblockvarnonz[b]), oldsdpi->sdpnblockvarnonz[b], oldsdpi->sdpnblockvars[b]);
+      SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->sdpvar[b]), oldsdpi->sdpvar[b], oldsdpi->sdpnblockvars[b]);
 
-      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdprow[b]), oldsdpi->sdpnblockvars[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpcol[b]), oldsdpi->sdpnblockvars[b]) );
-      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpval[b]), oldsdpi->sdpnblockvars[b]) );
+      SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdprow[b]), oldsdpi->sdpnblockvars[b]);
+      SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpcol[b]), oldsdpi->sdpnblockvars[b]);
+      SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpval[b]), oldsdpi->sdpnblockvars[b]);
 
-      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->indchanges[b]), oldsdpi->sdpblocksizes[b]) );
+      SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->indchanges[b]), oldsdpi->sdpblocksizes[b]);
       if ( newsdpi->allfixedeigenvecs != NULL )
       {
-         BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->allfixedeigenvecs[b]), oldsdpi->sdpblocksizes[b]) );
+         SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->allfixedeigenvecs[b]), oldsdpi->sdpblocksizes[b]);
       }
 
       /* set pointers into storage */
@@ -2260,23 +2890,31 @@ SCIP_RETCODE SCIPsdpiClone(
    newsdpi->maxnlpcons = oldsdpi->nlpcons;
    newsdpi->nactivelpcons = -1;
 
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->lplhs), oldsdpi->lplhs, oldsdpi->nlpcons) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->lprhs), oldsdpi->lprhs, oldsdpi->nlpcons) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->lpbeg), oldsdpi->lpbeg, oldsdpi->nlpcons) );
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->lplhs), oldsdpi->lplhs, oldsdpi->nlpcons);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->lprhs), oldsdpi->lprhs, oldsdpi->nlpcons);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->lpbeg), oldsdpi->lpbeg, oldsdpi->nlpcons);
 
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilpindchanges), oldsdpi->nlpcons) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilplhs), oldsdpi->nlpcons) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilprhs), oldsdpi->nlpcons) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilpbeg), oldsdpi->nlpcons) );
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilpindchanges), oldsdpi->nlpcons);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilplhs), oldsdpi->nlpcons);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilprhs), oldsdpi->nlpcons);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilpbeg), oldsdpi->nlpcons);
 
    newsdpi->lpnnonz = lpnnonz;
    newsdpi->maxlpnnonz = lpnnonz;
 
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->lpind), oldsdpi->lpind, lpnnonz) );
-   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, &(newsdpi->lpval), oldsdpi->lpval, lpnnonz) );
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->lpind), oldsdpi->lpind, lpnnonz);
+   SDPI_DUPLICATE_ARRAY(newsdpi, &(newsdpi->lpval), oldsdpi->lpval, lpnnonz);
 
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilpind), lpnnonz) );
-   BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(newsdpi->sdpilpval), lpnnonz) );
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilpind), lpnnonz);
+   SDPI_ALLOC_ARRAY(newsdpi, &(newsdpi->sdpilpval), lpnnonz);
+
+   /* the working space for the constant matrix is allocated in the first solve */
+   newsdpi->maxnsdpiconstblocks = 0;
+   newsdpi->sdpiconstnblocknonz = NULL;
+   newsdpi->maxsdpiconstnblocknonz = NULL;
+   newsdpi->sdpiconstrow = NULL;
+   newsdpi->sdpiconstcol = NULL;
+   newsdpi->sdpiconstval = NULL;
 
    /* other data */
    newsdpi->solved = FALSE; /* as we don't copy the sdpisolver, this needs to be set to false */
@@ -2296,9 +2934,26 @@ SCIP_RETCODE SCIPsdpiClone(
    newsdpi->onevarsdpcertsize = -1;
    newsdpi->onevarsdpcertval = SCIP_INVALID;
 
+   newsdpi->smallsdp = FALSE;
+   newsdpi->maxsmallsdpnvars = 0;
+   newsdpi->maxsmallsdpsize = 0;
+   newsdpi->smallsdpsol = NULL;
+   newsdpi->smallsdplbvals = NULL;
+   newsdpi->smallsdpubvals = NULL;
+   newsdpi->smallsdpprimalmatrix = NULL;
+
+   newsdpi->ncertificates = 0;
+   newsdpi->nextcertificate = 0;
+   newsdpi->certnvars = NULL;
+   newsdpi->maxcertnvars = NULL;
+   newsdpi->certvars = NULL;
+   newsdpi->certcoefs = NULL;
+   newsdpi->certconst = NULL;
+
    newsdpi->nallfixed = 0;
    newsdpi->ninfeasible = 0;
    newsdpi->nonevarsdp = 0;
+   newsdpi->nworkspaceallocs = 0;
 
    SCIP_CALL( SDPIclockCreate(&newsdpi->usedsdpitime) );
 
@@ -2433,6 +3088,10 @@ SCIP_RETCODE SCIPsdpiLoadSDP(
    SCIP_CALL( ensureLPDataMemory(sdpi, nlpcons, lpnnonz) );
    SCIP_CALL( ensureSDPDataMemory(sdpi, nsdpblocks, sdpblocksizes, sdpnblockvars, sdpnblockvarnonz, sdpconstnblocknonz, sdpnnonz, allfixedprimalray) );
 
+   /* the stored infeasibility certificates refer to the old SDP data */
+   sdpi->ncertificates = 0;
+   sdpi->nextcertificate = 0;
+
    /* copy data in arrays */
    BMScopyMemoryArray(sdpi->obj, obj, nvars);
    BMScopyMemoryArray(sdpi->lb, lb, nvars);
@@ -2449,6 +3108,8 @@ SCIP_RETCODE SCIPsdpiLoadSDP(
          sdpi->isintegral[i] = FALSE;
    }
 
+   /* the nonzeros are sorted once here, so that they need not be sorted again when computing fixings */
+   sdpi->sdpsorted = TRUE;
    for (b = 0; b < nsdpblocks; ++b)
    {
 #ifndef NDEBUG
@@ -2465,6 +3126,9 @@ SCIP_RETCODE SCIPsdpiLoadSDP(
          BMScopyMemoryArray(sdpi->sdpconstval[b], sdpconstval[b], sdpconstnblocknonz[b]);
          BMScopyMemoryArray(sdpi->sdpconstcol[b], sdpconstcol[b], sdpconstnblocknonz[b]);
          BMScopyMemoryArray(sdpi->sdpconstrow[b], sdpconstrow[b], sdpconstnblocknonz[b]);
+
+         if ( ! sortNonzeros(sdpi->sdpconstrow[b], sdpi->sdpconstcol[b], sdpi->sdpconstval[b], sdpconstnblocknonz[b]) )
+            sdpi->sdpsorted = FALSE;
       }
 
       assert( 0 <= sdpnblockvars[b] && sdpnblockvars[b] <= nvars );
@@ -2486,6 +3150,9 @@ SCIP_RETCODE SCIPsdpiLoadSDP(
          BMScopyMemoryArray(&sdpi->sdpvalstore[cnt], sdpval[b][v], sdpnblockvarnonz[b][v]);
          BMScopyMemoryArray(&sdpi->sdpcolstore[cnt], sdpcol[b][v], sdpnblockvarnonz[b][v]);
          BMScopyMemoryArray(&sdpi->sdprowstore[cnt], sdprow[b][v], sdpnblockvarnonz[b][v]);
+
+         if ( ! sortNonzeros(&sdpi->sdprowstore[cnt], &sdpi->sdpcolstore[cnt], &sdpi->sdpvalstore[cnt], sdpnblockvarnonz[b][v]) )
+            sdpi->sdpsorted = FALSE;
          cnt += sdpnblockvarnonz[b][v];
          assert( cnt <= sdpnnonz );
       }
@@ -2746,10 +3413,15 @@ SCIP_RETCODE SCIPsdpiClear(
    }
    sdpi->sdpconstnnonz = 0;
    sdpi->sdpnnonz = 0;
+   sdpi->sdpsorted = TRUE;
 
    sdpi->nsdpblocks = 0;
    sdpi->nvars = 0;
    sdpi->sdpid = 1;
+
+   /* the stored infeasibility certificates refer to the old data */
+   sdpi->ncertificates = 0;
+   sdpi->nextcertificate = 0;
    SCIP_CALL( SCIPsdpiSolverResetCounter(sdpi->sdpisolver) );
 
    return SCIP_OKAY;
@@ -3141,11 +3813,10 @@ SCIP_RETCODE SCIPsdpiSolve(
    SCIP_Real             timelimit           /**< after this many seconds solving will be aborted (currently only implemented for DSDP and MOSEK) */
    )
 {
-   int* sdpconstnblocknonz = NULL;
-   int* maxsdpconstnblocknonz = NULL;
-   int** sdpconstrow = NULL;
-   int** sdpconstcol = NULL;
-   SCIP_Real** sdpconstval = NULL;
+   int* sdpconstnblocknonz;
+   int** sdpconstrow;
+   int** sdpconstcol;
+   SCIP_Real** sdpconstval;
    SCIP_Real addedopttime;
    SCIP_Real fixedvarsobjcontr = 0.0;
    SCIP_Bool fixingfound;
@@ -3155,7 +3826,6 @@ SCIP_RETCODE SCIPsdpiSolve(
    int activevaridx = -1;
    int naddediterations;
    int naddedsdpcalls;
-   int b;
    int v;
 
    assert( sdpi != NULL );
@@ -3175,6 +3845,7 @@ SCIP_RETCODE SCIPsdpiSolve(
    sdpi->onevarsdpoptval = SCIP_INVALID;
    sdpi->onevarsdpidx = -1;
    sdpi->onevarsdpcertval = SCIP_INVALID;
+   sdpi->smallsdp = FALSE;
 
    if ( timelimit <= 0.0 )
       return SCIP_OKAY;
@@ -3236,6 +3907,23 @@ SCIP_RETCODE SCIPsdpiSolve(
    }
    assert( ! sdpi->infeasible );
 
+   /* check whether a certificate of a previously infeasible SDP still proves infeasibility for the current bounds */
+   if ( sdpi->ncertificates > 0 && checkInfeasibilityCertificates(sdpi, sdpi->sdpilb, sdpi->sdpiub) )
+   {
+      SCIPdebugMessage("SDP %d not given to solver, since a stored certificate proves infeasibility!\n", sdpi->sdpid++);
+      SCIP_CALL( SCIPsdpiSolverIncreaseCounter(sdpi->sdpisolver) );
+
+      sdpi->infeasible = TRUE;
+      sdpi->solved = TRUE;
+      sdpi->dualslater = SCIP_SDPSLATER_NOINFO;
+      sdpi->primalslater = SCIP_SDPSLATER_NOINFO;
+      ++sdpi->ninfeasible;
+
+      SDPIclockStop(sdpi->usedsdpitime);
+
+      return SCIP_OKAY;
+   }
+
    /* Checks whether all variables are fixed; this cannot be done in prepareLPData() because not all variables need to be contained in LP-constraints. */
    for (v = 0; v < sdpi->nvars; v++)
    {
@@ -3271,21 +3959,12 @@ SCIP_RETCODE SCIPsdpiSolve(
    assert( ! sdpi->allfixed );
    assert( ! sdpi->infeasible );
 
-   /* allocate memory for computing the constant matrix after fixings and finding empty rows and columns */
-   BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &sdpconstnblocknonz, sdpi->nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &maxsdpconstnblocknonz, sdpi->nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &sdpconstrow, sdpi->nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &sdpconstcol, sdpi->nsdpblocks) );
-   BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &sdpconstval, sdpi->nsdpblocks) );
-
-   for (b = 0; b < sdpi->nsdpblocks; ++b)
-   {
-      maxsdpconstnblocknonz[b] = MIN(sdpi->sdpnnonz + sdpi->sdpconstnnonz, sdpi->sdpblocksizes[b] * (sdpi->sdpblocksizes[b] + 1) / 2);
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpconstrow[b]), maxsdpconstnblocknonz[b]) ); /*lint !e776*/
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpconstcol[b]), maxsdpconstnblocknonz[b]) ); /*lint !e776*/
-      BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpconstval[b]), maxsdpconstnblocknonz[b]) ); /*lint !e776*/
-      sdpconstnblocknonz[b] = maxsdpconstnblocknonz[b];
-   }
+   /* make sure that the working space for computing the constant matrix after fixings and finding empty rows and columns is large enough */
+   SCIP_CALL( ensureConstWorkspaceMemory(sdpi) );
+   sdpconstnblocknonz = sdpi->sdpiconstnblocknonz;
+   sdpconstrow = sdpi->sdpiconstrow;
+   sdpconstcol = sdpi->sdpiconstcol;
+   sdpconstval = sdpi->sdpiconstval;
 
    /* compute constant matrix after fixings */
    SCIP_CALL( compConstMatAfterFixings(sdpi, sdpi->sdpilb, sdpi->sdpiub, &sdpconstnnonz, sdpconstnblocknonz, sdpconstrow, sdpconstcol, sdpconstval) );
@@ -3340,12 +4019,12 @@ SCIP_RETCODE SCIPsdpiSolve(
 
          if ( sdpi->onevarsdpcertvec == NULL )
          {
-            BMS_CALL( BMSallocBlockMemoryArray(sdpi->blkmem, &(sdpi->onevarsdpcertvec), sdpi->sdpblocksizes[0]) );
+            SDPI_ALLOC_ARRAY(sdpi, &(sdpi->onevarsdpcertvec), sdpi->sdpblocksizes[0]);
             sdpi->onevarsdpcertsize = sdpi->sdpblocksizes[0];
          }
          else if ( sdpi->onevarsdpcertsize != sdpi->sdpblocksizes[0] )
          {
-            BMS_CALL( BMSreallocBlockMemoryArray(sdpi->blkmem, &(sdpi->onevarsdpcertvec), sdpi->sdpblocksizes[0], sdpi->onevarsdpcertsize) );
+            SDPI_REALLOC_ARRAY(sdpi, &(sdpi->onevarsdpcertvec), sdpi->sdpblocksizes[0], sdpi->onevarsdpcertsize);
             sdpi->onevarsdpcertsize = sdpi->sdpblocksizes[0];
          }
 
@@ -3364,7 +4043,12 @@ SCIP_RETCODE SCIPsdpiSolve(
             sdpi->onevarsdpidx = activevaridx;
 
             if ( SCIPsdpiIsInfinity(sdpi, objval) )
+            {
                sdpi->solvedonevarsdp = SCIP_ONEVAR_INFEASIBLE;
+
+               /* store the eigenvector for a quick check of later SDPs */
+               SCIP_CALL( addInfeasibilityCertificate(sdpi, 0, sdpi->onevarsdpcertvec) );
+            }
             else
             {
                sdpi->solvedonevarsdp = SCIP_ONEVAR_OPTIMAL;
@@ -3375,6 +4059,13 @@ SCIP_RETCODE SCIPsdpiSolve(
       }
    }
 
+   /* for few active variables, one SDP block and no LP rows, try the barrier method for few variables */
+   if ( ! sdpi->solved && nactivevars <= MAXNSMALLSDPVARS && sdpi->nsdpblocks == 1 && sdpi->nactivelpcons == 0
+      && sdpi->sdpblocksizes[0] <= MAXSMALLSDPBLOCKSIZE )
+   {
+      SCIP_CALL( solveSmallSDP(sdpi, nactivevars, fixedvarsobjcontr, sdpconstnblocknonz[0], sdpconstrow[0], sdpconstcol[0], sdpconstval[0]) );
+   }
+
    /* solve SDP if not yet done */
    if ( ! sdpi->solved )
    {
@@ -3614,19 +4305,6 @@ SCIP_RETCODE SCIPsdpiSolve(
       }
    }
 
-   /* free memory */
-   for (b = sdpi->nsdpblocks - 1; b >= 0; --b)
-   {
-      BMSfreeBlockMemoryArray(sdpi->blkmem, &(sdpconstval[b]), maxsdpconstnblocknonz[b]);/*lint !e737*/
-      BMSfreeBlockMemoryArray(sdpi->blkmem, &(sdpconstcol[b]), maxsdpconstnblocknonz[b]);/*lint !e737*/
-      BMSfreeBlockMemoryArray(sdpi->blkmem, &(sdpconstrow[b]), maxsdpconstnblocknonz[b]);/*lint !e737*/
-   }
-   BMSfreeBlockMemoryArray(sdpi->blkmem, &sdpconstval, sdpi->nsdpblocks);/*lint !e737*/
-   BMSfreeBlockMemoryArray(sdpi->blkmem, &sdpconstcol, sdpi->nsdpblocks);/*lint !e737*/
-   BMSfreeBlockMemoryArray(sdpi->blkmem, &sdpconstrow, sdpi->nsdpblocks);/*lint !e737*/
-   BMSfreeBlockMemoryArray(sdpi->blkmem, &maxsdpconstnblocknonz, sdpi->nsdpblocks);/*lint !e737*/
-   BMSfreeBlockMemoryArray(sdpi->blkmem, &sdpconstnblocknonz, sdpi->nsdpblocks);/*lint !e737*/
-
    sdpi->sdpid++;
 
    SDPIclockStop(sdpi->usedsdpitime);
@@ -4227,13 +4905,20 @@ SCIP_RETCODE SCIPsdpiGetDualSol(
          SCIP_CALL( SCIPsdpiGetObjval(sdpi, objval) );
       }
 
-      /* we give the fixed values as the solution */
-      for (v = 0; v < sdpi->nvars; v++)
-         dualsol[v] = sdpi->sdpilb[v];
+      if ( sdpi->smallsdp )
+      {
+         BMScopyMemoryArray(dualsol, sdpi->smallsdpsol, sdpi->nvars);
+      }
+      else
+      {
+         /* we give the fixed values as the solution */
+         for (v = 0; v < sdpi->nvars; v++)
+            dualsol[v] = sdpi->sdpilb[v];
 
-      /* fill in value for one variable */
-      assert( 0 <= sdpi->onevarsdpidx && sdpi->onevarsdpidx < sdpi->nvars );
-      dualsol[sdpi->onevarsdpidx] = sdpi->onevarsdpoptval;
+         /* fill in value for one variable */
+         assert( 0 <= sdpi->onevarsdpidx && sdpi->onevarsdpidx < sdpi->nvars );
+         dualsol[sdpi->onevarsdpidx] = sdpi->onevarsdpoptval;
+      }
    }
    else
    {
@@ -4339,13 +5024,20 @@ SCIP_RETCODE SCIPsdpiGetPreoptimalSol(
 
       *success = FALSE;
 
-      /* we give the fixed values as the solution */
-      for (v = 0; v < sdpi->nvars; v++)
-         dualsol[v] = sdpi->sdpilb[v];
+      if ( sdpi->smallsdp )
+      {
+         BMScopyMemoryArray(dualsol, sdpi->smallsdpsol, sdpi->nvars);
+      }
+      else
+      {
+         /* we give the fixed values as the solution */
+         for (v = 0; v < sdpi->nvars; v++)
+            dualsol[v] = sdpi->sdpilb[v];
 
-      /* fill in value for one variable */
-      assert( 0 <= sdpi->onevarsdpidx && sdpi->onevarsdpidx < sdpi->nvars );
-      dualsol[sdpi->onevarsdpidx] = sdpi->onevarsdpoptval;
+         /* fill in value for one variable */
+         assert( 0 <= sdpi->onevarsdpidx && sdpi->onevarsdpidx < sdpi->nvars );
+         dualsol[sdpi->onevarsdpidx] = sdpi->onevarsdpoptval;
+      }
 
       if ( nblocks > -1 )
       {
@@ -4415,7 +5107,13 @@ SCIP_RETCODE SCIPsdpiGetPrimalBoundVars(
          ubvals[i] = 0.0;
       }
 
-      if ( sdpi->solvedonevarsdp == SCIP_ONEVAR_INFEASIBLE )
+      if ( sdpi->smallsdp )
+      {
+         assert( sdpi->solvedonevarsdp == SCIP_ONEVAR_OPTIMAL );
+         BMScopyMemoryArray(lbvals, sdpi->smallsdplbvals, sdpi->nvars);
+         BMScopyMemoryArray(ubvals, sdpi->smallsdpubvals, sdpi->nvars);
+      }
+      else if ( sdpi->solvedonevarsdp == SCIP_ONEVAR_INFEASIBLE )
       {
          /* fill in dual variables for single constraint */
          if ( sdpi->onevarsdpcertval > sdpi->feastol )
@@ -4675,6 +5373,139 @@ SCIP_RETCODE SCIPsdpiGetPrimalMatrix(
    return SCIP_OKAY;
 }
 
+/** returns a sparse copy of the primal matrix X in block memory, dropping entries of absolute value at most threshold
+ *
+ *  In contrast to SCIPsdpiGetPrimalMatrix(), the caller does not need to query the number of nonzeros and provide
+ *  arrays beforehand: the arrays are allocated with their exact sizes, such that they can be handed on without another
+ *  copy, and have to be freed with SCIPsdpiFreePrimalMatrixSparse(). If no primal matrix is available, *startXnblocknonz
+ *  is set to NULL.
+ *
+ *  @note last block will be the LP block (if one exists), see SCIPsdpiGetPrimalMatrix()
+ */
+SCIP_RETCODE SCIPsdpiGetPrimalMatrixSparse(
+   SCIP_SDPI*            sdpi,               /**< pointer to an SDP-interface structure */
+   BMS_BLKMEM*           blkmem,             /**< block memory to allocate the arrays in */
+   int                   nblocks,            /**< number of blocks (should be nsdpblocks + 1) */
+   SCIP_Real             threshold,          /**< entries with absolute value at most this value are not copied (0.0 keeps all nonzeros) */
+   int**                 startXnblocknonz,   /**< pointer to store the number of nonzeros in each block */
+   int***                startXrow,          /**< pointer to store row indices of X for each block */
+   int***                startXcol,          /**< pointer to store column indices of X for each block */
+   SCIP_Real***          startXval           /**< pointer to store values of X for each block */
+   )
+{
+   int* nallocated;
+   int b;
+
+   assert( sdpi != NULL );
+   assert( blkmem != NULL );
+   assert( nblocks > 0 );
+   assert( threshold >= 0.0 );
+   assert( startXnblocknonz != NULL );
+   assert( startXrow != NULL );
+   assert( startXcol != NULL );
+   assert( startXval != NULL );
+
+   *startXnblocknonz = NULL;
+   *startXrow = NULL;
+   *startXcol = NULL;
+   *startXval = NULL;
+
+   if ( sdpi->infeasible || sdpi->allfixed || sdpi->solvedonevarsdp > SCIP_ONEVAR_UNSOLVED )
+   {
+      SCIPdebugMessage("Problem was solved while preparing, no primal matrix available.\n");
+      return SCIP_OKAY;
+   }
+
+   BMS_CALL( BMSallocBufferMemoryArray(sdpi->bufmem, &nallocated, nblocks) );
+   SCIP_CALL( SCIPsdpiSolverGetPrimalNonzeros(sdpi->sdpisolver, nblocks, nallocated) );
+
+   BMS_CALL( BMSduplicateBlockMemoryArray(blkmem, startXnblocknonz, nallocated, nblocks) );
+   BMS_CALL( BMSallocBlockMemoryArray(blkmem, startXrow, nblocks) );
+   BMS_CALL( BMSallocBlockMemoryArray(blkmem, startXcol, nblocks) );
+   BMS_CALL( BMSallocBlockMemoryArray(blkmem, startXval, nblocks) );
+   for (b = 0; b < nblocks; b++)
+   {
+      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(*startXrow)[b], nallocated[b]) );
+      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(*startXcol)[b], nallocated[b]) );
+      BMS_CALL( BMSallocBlockMemoryArray(blkmem, &(*startXval)[b], nallocated[b]) );
+   }
+
+   /* the solver fills the arrays directly, without an intermediate dense copy of the blocks */
+   SCIP_CALL( SCIPsdpiSolverGetPrimalMatrix(sdpi->sdpisolver, nblocks, *startXnblocknonz, *startXrow, *startXcol, *startXval) );
+
+   for (b = 0; b < nblocks; b++)
+   {
+      int nnonz = 0;
+      int i;
+
+      assert( (*startXnblocknonz)[b] <= nallocated[b] );
+
+      /* remove the entries below the threshold in place */
+      for (i = 0; i < (*startXnblocknonz)[b]; i++)
+      {
+         if ( REALABS((*startXval)[b][i]) > threshold )
+         {
+            (*startXrow)[b][nnonz] = (*startXrow)[b][i];
+            (*startXcol)[b][nnonz] = (*startXcol)[b][i];
+            (*startXval)[b][nnonz] = (*startXval)[b][i];
+            ++nnonz;
+         }
+      }
+      (*startXnblocknonz)[b] = nnonz;
+
+      /* shrink the arrays to their exact size, such that they can be freed using the number of nonzeros */
+      if ( nnonz == 0 )
+      {
+         BMSfreeBlockMemoryArrayNull(blkmem, &(*startXval)[b], nallocated[b]);
+         BMSfreeBlockMemoryArrayNull(blkmem, &(*startXcol)[b], nallocated[b]);
+         BMSfreeBlockMemoryArrayNull(blkmem, &(*startXrow)[b], nallocated[b]);
+      }
+      else if ( nnonz < nallocated[b] )
+      {
+         BMS_CALL( BMSreallocBlockMemoryArray(blkmem, &(*startXrow)[b], nallocated[b], nnonz) );
+         BMS_CALL( BMSreallocBlockMemoryArray(blkmem, &(*startXcol)[b], nallocated[b], nnonz) );
+         BMS_CALL( BMSreallocBlockMemoryArray(blkmem, &(*startXval)[b], nallocated[b], nnonz) );
+      }
+   }
+
+   BMSfreeBufferMemoryArray(sdpi->bufmem, &nallocated);
+
+   return SCIP_OKAY;
+}
+
+/** frees the arrays returned by SCIPsdpiGetPrimalMatrixSparse() */
+void SCIPsdpiFreePrimalMatrixSparse(
+   BMS_BLKMEM*           blkmem,             /**< block memory the arrays were allocated in */
+   int                   nblocks,            /**< number of blocks */
+   int**                 startXnblocknonz,   /**< pointer to the number of nonzeros in each block */
+   int***                startXrow,          /**< pointer to row indices of X for each block */
+   int***                startXcol,          /**< pointer to column indices of X for each block */
+   SCIP_Real***          startXval           /**< pointer to values of X for each block */
+   )
+{
+   int b;
+
+   assert( blkmem != NULL );
+   assert( startXnblocknonz != NULL );
+   assert( startXrow != NULL );
+   assert( startXcol != NULL );
+   assert( startXval != NULL );
+
+   if ( *startXnblocknonz == NULL )
+      return;
+
+   for (b = 0; b < nblocks; b++)
+   {
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*startXval)[b], (*startXnblocknonz)[b]);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*startXcol)[b], (*startXnblocknonz)[b]);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*startXrow)[b], (*startXnblocknonz)[b]);
+   }
+   BMSfreeBlockMemoryArray(blkmem, startXval, nblocks);
+   BMSfreeBlockMemoryArray(blkmem, startXcol, nblocks);
+   BMSfreeBlockMemoryArray(blkmem, startXrow, nblocks);
+   BMSfreeBlockMemoryArray(blkmem, startXnblocknonz, nblocks);
+}
+
 /** returns the primal solution matrix (without LP rows) */
 SCIP_RETCODE SCIPsdpiGetPrimalSolutionMatrix(
    SCIP_SDPI*            sdpi,               /**< pointer to an SDP-interface structure */
@@ -4730,6 +5561,14 @@ SCIP_RETCODE SCIPsdpiGetPrimalSolutionMatrix(
    {
       SCIPdebugMessage("Infeasibility was detected while preparing problem, no primal solution available.\n");
    }
+   else if ( sdpi->smallsdp )
+   {
+      assert( sdpi->nsdpblocks == 1 );
+      assert( primalmatrices[0] != NULL );
+
+      BMScopyMemoryArray(primalmatrices[0], sdpi->smallsdpprimalmatrix, sdpi->sdpblocksizes[0] * sdpi->sdpblocksizes[0]);
+      *success = TRUE;
+   }
    else if ( sdpi->solvedonevarsdp > SCIP_ONEVAR_UNSOLVED )
    {
       SCIP_Real s = 1.0;
@@ -5220,21 +6059,55 @@ SCIP_RETCODE SCIPsdpiGetStatistics(
    SCIP_SDPI*            sdpi,               /**< SDP-interface structure */
    int*                  ninfeasible,        /**< pointer to store the total number of times infeasibility was detected in presolving */
    int*                  nallfixed,          /**< pointer to store the total number of times all variables were fixed */
-   int*                  nonevarsdp          /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nonevarsdp,         /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nworkspaceallocs    /**< pointer to store the total number of times the working space had to be enlarged */
    )
 {
    assert( sdpi != NULL );
    assert( ninfeasible != NULL );
    assert( nallfixed != NULL );
    assert( nonevarsdp != NULL );
+   assert( nworkspaceallocs != NULL );
 
    *ninfeasible = sdpi->ninfeasible;
    *nallfixed = sdpi->nallfixed;
    *nonevarsdp = sdpi->nonevarsdp;
+   *nworkspaceallocs = sdpi->nworkspaceallocs;
 
    return SCIP_OKAY;
 }
 
+/** returns the number of bytes allocated for the data of the SDPI and the maximal number since the last call of
+ *  SCIPsdpiResetPeakMemory()
+ *
+ *  This includes the copies of the problem data, the working space for preprocessing and the stored infeasibility
+ *  certificates, but not the memory of the SDP solver. The numbers are updated whenever an array of the SDPI is
+ *  (re)allocated.
+ */
+void SCIPsdpiGetMemory(
+   SCIP_SDPI*            sdpi,               /**< SDP-interface structure */
+   SCIP_Longint*         memory,             /**< pointer to store the number of allocated bytes */
+   SCIP_Longint*         peakmemory          /**< pointer to store the maximal number of allocated bytes (or NULL) */
+   )
+{
+   assert( sdpi != NULL );
+   assert( memory != NULL );
+
+   *memory = sdpi->memory;
+   if ( peakmemory != NULL )
+      *peakmemory = sdpi->peakmemory;
+}
+
+/** resets the maximal number of bytes allocated for the data of the SDPI to the current number */
+void SCIPsdpiResetPeakMemory(
+   SCIP_SDPI*            sdpi                /**< SDP-interface structure */
+   )
+{
+   assert( sdpi != NULL );
+
+   sdpi->peakmemory = sdpi->memory;
+}
+
 /**@} */
 
 
@@ -5385,6 +6258,7 @@ SCIP_RETCODE SCIPsdpiGetIntpar(
    {
    case SCIP_SDPPAR_SDPINFO:
    case SCIP_SDPPAR_NTHREADS:
+   case SCIP_SDPPAR_MAXITER:
    case SCIP_SDPPAR_USEPRESOLVING:
    case SCIP_SDPPAR_USESCALING:
    case SCIP_SDPPAR_SCALEOBJ:
@@ -5423,6 +6297,7 @@ SCIP_RETCODE SCIPsdpiSetIntpar(
       SCIP_CALL_PARAM( SCIPsdpiSolverSetIntpar(sdpi->sdpisolver, type, ival) );
       break;
    case SCIP_SDPPAR_NTHREADS:
+   case SCIP_SDPPAR_MAXITER:
       SCIP_CALL_PARAM( SCIPsdpiSolverSetIntpar(sdpi->sdpisolver, type, ival) );
       break;
    case SCIP_SDPPAR_SLATERCHECK:
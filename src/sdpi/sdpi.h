@@ -643,6 +643,38 @@ SCIP_RETCODE SCIPsdpiGetPrimalMatrix(
    SCIP_Real**           startXval           /**< pointer to store values of X */
    );
 
+/** returns a sparse copy of the primal matrix X in block memory, dropping entries of absolute value at most threshold
+ *
+ *  In contrast to SCIPsdpiGetPrimalMatrix(), the caller does not need to query the number of nonzeros and provide
+ *  arrays beforehand: the arrays are allocated with their exact sizes, such that they can be handed on without another
+ *  copy, and have to be freed with SCIPsdpiFreePrimalMatrixSparse(). If no primal matrix is available, *startXnblocknonz
+ *  is set to NULL.
+ *
+ *  @note last block will be the LP block (if one exists), see SCIPsdpiGetPrimalMatrix()
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsdpiGetPrimalMatrixSparse(
+   SCIP_SDPI*            sdpi,               /**< pointer to an SDP-interface structure */
+   BMS_BLKMEM*           blkmem,             /**< block memory to allocate the arrays in */
+   int                   nblocks,            /**< number of blocks (should be nsdpblocks + 1) */
+   SCIP_Real             threshold,          /**< entries with absolute value at most this value are not copied (0.0 keeps all nonzeros) */
+   int**                 startXnblocknonz,   /**< pointer to store the number of nonzeros in each block */
+   int***                startXrow,          /**< pointer to store row indices of X for each block */
+   int***                startXcol,          /**< pointer to store column indices of X for each block */
+   SCIP_Real***          startXval           /**< pointer to store values of X for each block */
+   );
+
+/** frees the arrays returned by SCIPsdpiGetPrimalMatrixSparse() */
+SCIP_EXPORT
+void SCIPsdpiFreePrimalMatrixSparse(
+   BMS_BLKMEM*           blkmem,             /**< block memory the arrays were allocated in */
+   int                   nblocks,            /**< number of blocks */
+   int**                 startXnblocknonz,   /**< pointer to the number of nonzeros in each block */
+   int***                startXrow,          /**< pointer to row indices of X for each block */
+   int***                startXcol,          /**< pointer to column indices of X for each block */
+   SCIP_Real***          startXval           /**< pointer to values of X for each block */
+   );
+
 /** returns the primal solution matrix (without LP rows) */
 SCIP_EXPORT
 SCIP_RETCODE SCIPsdpiGetPrimalSolutionMatrix(
@@ -706,7 +738,27 @@ SCIP_RETCODE SCIPsdpiGetStatistics(
    SCIP_SDPI*            sdpi,               /**< SDP-interface structure */
    int*                  ninfeasible,        /**< pointer to store the total number of times infeasibility was detected in presolving */
    int*                  nallfixed,          /**< pointer to store the total number of times all variables were fixed */
-   int*                  nonevarsdp          /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nonevarsdp,         /**< pointer to store the total number of times a one variable SDP was solved */
+   int*                  nworkspaceallocs    /**< pointer to store the total number of times the working space had to be enlarged */
+   );
+
+/** returns the number of bytes allocated for the data of the SDPI and the maximal number since the last call of
+ *  SCIPsdpiResetPeakMemory()
+ *
+ *  This includes the copies of the problem data, the working space for preprocessing and the stored infeasibility
+ *  certificates, but not the memory of the SDP solver.
+ */
+SCIP_EXPORT
+void SCIPsdpiGetMemory(
+   SCIP_SDPI*            sdpi,               /**< SDP-interface structure */
+   SCIP_Longint*         memory,             /**< pointer to store the number of allocated bytes */
+   SCIP_Longint*         peakmemory          /**< pointer to store the maximal number of allocated bytes (or NULL) */
+   );
+
+/** resets the maximal number of bytes allocated for the data of the SDPI to the current number */
+SCIP_EXPORT
+void SCIPsdpiResetPeakMemory(
+   SCIP_SDPI*            sdpi                /**< SDP-interface structure */
    );
 
 /**@} */
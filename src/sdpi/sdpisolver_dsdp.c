@@ -47,14 +47,11 @@
 #include "dsdp5.h"                           /* for DSDPUsePenalty, etc */
 #pragma GCC diagnostic warning "-Wstrict-prototypes"
 
-#ifdef OPENBLAS
-#include <cblas.h>
-#endif
-
 #include "blockmemshell/memory.h"            /* for memory allocation */
 #include "scip/def.h"                        /* for SCIP_Real, _Bool, ... */
 #include "scip/pub_misc.h"                   /* for sorting */
 #include "sdpi/sdpsolchecker.h"              /* to check solution with regards to feasibility tolerance */
+#include "sdpi/lapack_interface.h"           /* for the BLAS threading policy */
 #include "scip/pub_message.h"                /* for debug and error message */
 
 
@@ -193,6 +190,7 @@ struct SCIP_SDPiSolver
    SCIP_Real             objlimit;           /**< objective limit for SDP-solver */
    SCIP_Bool             sdpinfo;            /**< Should the SDP-solver output information to the screen? */
    int                   nthreads;           /**< number of threads the SDP solver should use (-1 = number of cores) */
+   int                   maxiter;            /**< maximal number of iterations of the SDP solver (-1 = solver default) */
    SCIP_Bool             penalty;            /**< Did the last solve use a penalty formulation? */
    SCIP_Bool             penaltyworbound;    /**< Was a penalty formulation solved without bounding r? */
    SCIP_Bool             feasorig;           /**< was the last problem solved with a penalty formulation and with original objective coefficents
@@ -250,6 +248,28 @@ int compLowerTriangPos(
    return i*(i+1)/2 + j;
 }
 
+/** returns whether the given indices are sorted non-decreasingly
+ *
+ *  The SDPI passes matrices sorted by row and then col, in which case the lower triangular positions are already
+ *  sorted and need not be sorted again.
+ */
+static
+SCIP_Bool isSortedInd(
+   const int*            ind,                /**< indices */
+   int                   n                   /**< number of indices */
+   )
+{
+   int j;
+
+   for (j = 1; j < n; ++j)
+   {
+      if ( ind[j-1] > ind[j] )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
 #ifndef NDEBUG
 /** test if a lower bound lb is not smaller than an upper bound ub, meaning that lb > ub - epsilon */
 static
@@ -563,6 +583,7 @@ SCIP_RETCODE SCIPsdpiSolverCreate(
    (*sdpisolver)->objlimit = SCIPsdpiSolverInfinity(*sdpisolver);
    (*sdpisolver)->sdpinfo = FALSE;
    (*sdpisolver)->nthreads = -1;
+   (*sdpisolver)->maxiter = -1;
    (*sdpisolver)->usedsetting = SCIP_SDPSOLVERSETTING_UNSOLVED;
    (*sdpisolver)->preoptimalsolexists = FALSE;
    (*sdpisolver)->preoptimalgap = -1.0;
@@ -1117,7 +1138,8 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
                }
 
                /* sort the arrays for this matrix (by non decreasing indices) as this might help the solving time of DSDP */
-               SCIPsortIntReal(sdpisolver->dsdpind + startind, sdpisolver->dsdpval + startind, sdpnblockvarnonz[block][blockvar]);
+               if ( ! isSortedInd(sdpisolver->dsdpind + startind, sdpnblockvarnonz[block][blockvar]) )
+                  SCIPsortIntReal(sdpisolver->dsdpind + startind, sdpisolver->dsdpval + startind, sdpnblockvarnonz[block][blockvar]);
 
                assert( blockindchanges[block] > -1 ); /* we shouldn't insert into blocks we removed */
 
@@ -1186,7 +1208,8 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
             }
 
             /* sort the arrays for this Matrix (by non decreasing indices) as this might help the solving time of DSDP */
-            SCIPsortIntReal(sdpisolver->dsdpconstind + startind, sdpisolver->dsdpconstval + startind, sdpconstnblocknonz[block]);
+            if ( ! isSortedInd(sdpisolver->dsdpconstind + startind, sdpconstnblocknonz[block]) )
+               SCIPsortIntReal(sdpisolver->dsdpconstind + startind, sdpisolver->dsdpconstval + startind, sdpconstnblocknonz[block]);
 
             assert( blockindchanges[block] > -1 ); /* we shouldn't insert into a block we removed */
 
@@ -1452,6 +1475,10 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
 
    DSDP_CALL( DSDPSetGapTolerance(sdpisolver->dsdp, sdpisolver->gaptol) );  /* set DSDP's tolerance for duality gap */
    DSDP_CALL( DSDPSetRTolerance(sdpisolver->dsdp, sdpisolver->sdpsolverfeastol) );    /* set DSDP's tolerance for the SDP-constraints */
+   if ( sdpisolver->maxiter >= 0 )
+   {
+      DSDP_CALL( DSDPSetMaxIts(sdpisolver->dsdp, sdpisolver->maxiter) );       /* set DSDP's iteration limit */
+   }
 #ifndef SCIP_DEBUG
    if ( sdpisolver->sdpinfo )
 #endif
@@ -1480,10 +1507,8 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
       }
    }
 
-#ifdef OPENBLAS
-   if ( sdpisolver->nthreads > 0 )
-      openblas_set_num_threads(sdpisolver->nthreads);
-#endif
+   /* set number of BLAS threads according to the threading policy */
+   (void) SCIPlapackSetSolverNThreads(sdpisolver->nthreads);
 
    /* start the solving process */
    DSDP_CALLM( DSDPSetup(sdpisolver->dsdp) );
@@ -2753,6 +2778,10 @@ SCIP_RETCODE SCIPsdpiSolverGetIntpar(
       *ival = sdpisolver->nthreads;
       SCIPdebugMessage("Getting sdpisolver number of threads: %d.\n", *ival);
       break;
+   case SCIP_SDPPAR_MAXITER:
+      *ival = sdpisolver->maxiter;
+      SCIPdebugMessage("Getting sdpisolver maximal number of iterations: %d.\n", *ival);
+      break;
    default:
       return SCIP_PARAMETERUNKNOWN;
    }
@@ -2779,6 +2808,10 @@ SCIP_RETCODE SCIPsdpiSolverSetIntpar(
       sdpisolver->nthreads = ival;
       SCIPdebugMessage("Setting sdpisolver number of threads to %d.\n", ival);
       break;
+   case SCIP_SDPPAR_MAXITER:
+      sdpisolver->maxiter = ival;
+      SCIPdebugMessage("Setting sdpisolver maximal number of iterations to %d.\n", ival);
+      break;
    default:
       return SCIP_PARAMETERUNKNOWN;
    }
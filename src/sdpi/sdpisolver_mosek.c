@@ -69,6 +69,7 @@
 #include "scip/pub_misc.h"                   /* for SCIPsnprintf() */
 #include "mosek.h"                           /* for MOSEK routines */
 #include "sdpi/sdpsolchecker.h"              /* to check solution with regards to feasibility tolerance */
+#include "sdpi/lapack_interface.h"           /* for the BLAS threading policy */
 #include "scip/pub_message.h"                /* for debug and error message */
 #include "tinycthread/tinycthread.h"         /* for thread local environments */
 
@@ -144,6 +145,7 @@ struct SCIP_SDPiSolver
    MSKsolstae            solstat;            /**< solution status of last call to MOSEK-optimizer */
    SCIP_Bool             timelimit;          /**< was the solver stopped because of the time limit? */
    int                   nthreads;           /**< number of threads the SDP solver should use (-1 = number of cores) */
+   int                   maxiter;            /**< maximal number of iterations of the SDP solver (-1 = solver default) */
    int                   niterations;        /**< number of SDP-iterations since the last solve call */
    int                   nsdpcalls;          /**< number of SDP-calls since the last solve call */
    SCIP_Bool             scaleobj;           /**< whether the objective should be scaled */
@@ -486,6 +488,7 @@ SCIP_RETCODE SCIPsdpiSolverCreate(
    (*sdpisolver)->usepresolving = TRUE;
    (*sdpisolver)->usescaling = TRUE;
    (*sdpisolver)->nthreads = -1;
+   (*sdpisolver)->maxiter = -1;
    (*sdpisolver)->terminationcode = MSK_RES_OK;
    (*sdpisolver)->solstat = MSK_SOL_STA_UNKNOWN;
    (*sdpisolver)->timelimit = FALSE;
@@ -850,10 +853,14 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
       MOSEK_CALL( MSK_linkfunctotaskstream(sdpisolver->msktask, MSK_STREAM_LOG, (MSKuserhandle_t) sdpisolver->messagehdlr, printstr) );/*lint !e641*/
    }
 
-   /* set number of threads */
-   if ( sdpisolver->nthreads > 0 )
+   /* set number of threads, also for -1 (number of cores), such that the threading policy (e.g., deterministic mode)
+    * applies; for 0, MOSEK chooses the number of threads itself */
+   MOSEK_CALL( MSK_putintparam(sdpisolver->msktask, MSK_IPAR_NUM_THREADS, SCIPlapackSetSolverNThreads(sdpisolver->nthreads)) );/*lint !e641*/
+
+   /* set iteration limit */
+   if ( sdpisolver->maxiter >= 0 )
    {
-      MOSEK_CALL( MSK_putintparam(sdpisolver->msktask, MSK_IPAR_NUM_THREADS, sdpisolver->nthreads) );/*lint !e641*/
+      MOSEK_CALL( MSK_putintparam(sdpisolver->msktask, MSK_IPAR_INTPNT_MAX_ITERATIONS, sdpisolver->maxiter) );/*lint !e641*/
    }
 
    /* only increase the counter if we don't use the penalty formulation to stay in line with the numbers in the general interface (where this is still the
@@ -2801,6 +2808,10 @@ SCIP_RETCODE SCIPsdpiSolverGetIntpar(
       *ival = sdpisolver->nthreads;
       SCIPdebugMessage("Getting sdpisolver number of threads: %d.\n", *ival);
       break;
+   case SCIP_SDPPAR_MAXITER:
+      *ival = sdpisolver->maxiter;
+      SCIPdebugMessage("Getting sdpisolver maximal number of iterations: %d.\n", *ival);
+      break;
    case SCIP_SDPPAR_USEPRESOLVING:
       *ival = (int) sdpisolver->usepresolving;
       SCIPdebugMessage("Getting usepresolving (%d).\n", *ival);
@@ -2835,6 +2846,10 @@ SCIP_RETCODE SCIPsdpiSolverSetIntpar(
       sdpisolver->nthreads = ival;
       SCIPdebugMessage("Setting sdpisolver number of threads to %d.\n", ival);
       break;
+   case SCIP_SDPPAR_MAXITER:
+      sdpisolver->maxiter = ival;
+      SCIPdebugMessage("Setting sdpisolver maximal number of iterations to %d.\n", ival);
+      break;
    case SCIP_SDPPAR_SDPINFO:
       assert( 0 <= ival && ival <= 1 );
       sdpisolver->sdpinfo = (SCIP_Bool) ival;
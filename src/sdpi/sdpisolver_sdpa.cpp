@@ -57,9 +57,6 @@
  */
 
 #include <assert.h>
-#ifdef OPENBLAS
-#include <cblas.h>
-#endif
 
 #include "sdpi/sdpisolver.h"
 
@@ -74,6 +71,7 @@
 #include "scip/def.h"                        /* for SCIP_Real, _Bool, ... */
 #include "scip/pub_misc.h"                   /* for sorting */
 #include "sdpi/sdpsolchecker.h"              /* to check solution with regards to feasibility tolerance */
+#include "sdpi/lapack_interface.h"           /* for the BLAS threading policy */
 #include "scip/pub_message.h"                /* for debug and error message */
 
 /* turn off lint warnings for whole file: */
@@ -194,6 +192,7 @@ struct SCIP_SDPiSolver
    SCIP_Bool             preoptimalsolexists;/**< saved feasible solution with gap less or equal preoptimalgap */
    SCIP_Real             preoptimalgap;      /**< gap at which a preoptimal solution should be saved for warmstarting purposes */
    int                   nthreads;           /**< number of threads the SDP solver should use (-1 = number of cores) */
+   int                   maxiter;            /**< maximal number of iterations of the SDP solver (-1 = solver default) */
 };
 
 
@@ -623,6 +622,7 @@ SCIP_RETCODE SCIPsdpiSolverCreate(
    (*sdpisolver)->preoptimalgap = -1.0;
 
    (*sdpisolver)->nthreads = -1;
+   (*sdpisolver)->maxiter = -1;
 
    return SCIP_OKAY;
 }
@@ -981,13 +981,13 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
    sdpisolver->sdpa = new SDPA();
    assert( sdpisolver->sdpa != 0 );
 
-   /* set number of threads (do this early, since this might affect factorization) */
-   if ( sdpisolver->nthreads > 0 )
+   /* set number of threads (do this early, since this might affect factorization); for 0, SDPA keeps its default */
    {
-#ifdef OPENBLAS
-      openblas_set_num_threads(sdpisolver->nthreads);
-#endif
-      sdpisolver->sdpa->setNumThreads(sdpisolver->nthreads);
+      int nthreads;
+
+      nthreads = SCIPlapackSetSolverNThreads(sdpisolver->nthreads);
+      if ( nthreads > 0 )
+         sdpisolver->sdpa->setNumThreads(nthreads);
    }
 
    /* set the penalty and rbound flags accordingly */
@@ -1450,6 +1450,10 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
 
    sdpisolver->sdpa->setParameterLowerBound(-1e20);
 
+   /* set the iteration limit (setParameterType() resets it to the default) */
+   if ( sdpisolver->maxiter >= 0 )
+      sdpisolver->sdpa->setParameterMaxIteration(sdpisolver->maxiter);
+
    /* set the objective limit */
    if ( ! SCIPsdpiSolverIsInfinity(sdpisolver, sdpisolver->objlimit) )
       sdpisolver->sdpa->setParameterUpperBound(sdpisolver->objlimit);
@@ -1705,6 +1709,8 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
       sdpisolver->sdpa->setParameterEpsilonStar(GAPTOLCHANGE * sdpisolver->gaptol);
       sdpisolver->sdpa->setParameterEpsilonDash(FEASTOLCHANGE * sdpisolver->sdpsolverfeastol);
       sdpisolver->sdpa->setParameterLowerBound(-1e20);
+      if ( sdpisolver->maxiter >= 0 )
+         sdpisolver->sdpa->setParameterMaxIteration(sdpisolver->maxiter);
 
       /* set the objective limit */
       if ( ! SCIPsdpiSolverIsInfinity(sdpisolver, sdpisolver->objlimit) )
@@ -1755,6 +1761,8 @@ SCIP_RETCODE SCIPsdpiSolverLoadAndSolveWithPenalty(
       sdpisolver->sdpa->setParameterEpsilonStar(GAPTOLCHANGE * GAPTOLCHANGE * sdpisolver->gaptol);
       sdpisolver->sdpa->setParameterEpsilonDash(FEASTOLCHANGE * FEASTOLCHANGE * sdpisolver->sdpsolverfeastol);
       sdpisolver->sdpa->setParameterLowerBound(-1e20);
+      if ( sdpisolver->maxiter >= 0 )
+         sdpisolver->sdpa->setParameterMaxIteration(sdpisolver->maxiter);
 
       /* set the objective limit */
       if ( ! SCIPsdpiSolverIsInfinity(sdpisolver, sdpisolver->objlimit) )
@@ -3323,6 +3331,10 @@ SCIP_RETCODE SCIPsdpiSolverGetIntpar(
       *ival = sdpisolver->nthreads;
       SCIPdebugMessage("Getting sdpisolver number of threads: %d.\n", *ival);
       break;
+   case SCIP_SDPPAR_MAXITER:
+      *ival = sdpisolver->maxiter;
+      SCIPdebugMessage("Getting sdpisolver maximal number of iterations: %d.\n", *ival);
+      break;
    default:
       return SCIP_PARAMETERUNKNOWN;
    }
@@ -3349,6 +3361,10 @@ SCIP_RETCODE SCIPsdpiSolverSetIntpar(
       sdpisolver->nthreads = ival;
       SCIPdebugMessage("Setting sdpisolver number of threads to %d.\n", ival);
       break;
+   case SCIP_SDPPAR_MAXITER:
+      sdpisolver->maxiter = ival;
+      SCIPdebugMessage("Setting sdpisolver maximal number of iterations to %d.\n", ival);
+      break;
    default:
       return SCIP_PARAMETERUNKNOWN;
    }
@@ -179,9 +179,12 @@ SCIP_RETCODE SCIPsdpSolcheckerCheck(
    /* check sdp constraints */
    if ( nsdpblocks > 0 )
    {
-      SCIP_Real* fullsdpmatrix;
+      SCIP_Real* sdpmatrix;
       SCIP_Real eigenvalue;
       int maxblocksize = 0;
+      int blocksize;
+      int row;
+      int col;
 
       /* allocate memory */
       if ( nsdpblocks == 1 )
@@ -196,20 +199,17 @@ SCIP_RETCODE SCIPsdpSolcheckerCheck(
          }
       }
 
-      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &fullsdpmatrix, maxblocksize * maxblocksize) );/*lint !e647*/
+      /* LAPACK works on the lower triangular part in packed storage, so we do not need the full matrix */
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &sdpmatrix, (maxblocksize * (maxblocksize + 1)) / 2) );/*lint !e647*/
 
       for (b = 0; b < nsdpblocks; b++)
       {
          if ( blockindchanges[b] > -1 )
          {
-            /* initialize lower triangular part of fullsdpmatrix with zero */
-            for (i = 0; i < sdpblocksizes[b] - nremovedinds[b]; i++)
-            {
-               for (j = 0; j <= i; j++)
-               {
-                  fullsdpmatrix[i * (sdpblocksizes[b] - nremovedinds[b]) + j] = 0.0; /*lint !e679*/
-               }
-            }
+            blocksize = sdpblocksizes[b] - nremovedinds[b];
+
+            /* initialize lower triangular part of sdpmatrix with zero */
+            BMSclearMemoryArray(sdpmatrix, (blocksize * (blocksize + 1)) / 2);
 
             /* iterate over all non-fixed variables and add the corresponding nonzeros */
             for (v = 0; v < sdpnblockvars[b]; v++)
@@ -218,8 +218,10 @@ SCIP_RETCODE SCIPsdpSolcheckerCheck(
                {
                   for (i = 0; i < sdpnblockvarnonz[b][v]; i++)
                   {
-                     fullsdpmatrix[((sdprow[b][v][i] - indchanges[b][sdprow[b][v][i]]) * (sdpblocksizes[b] - nremovedinds[b])) +
-                                   sdpcol[b][v][i] - indchanges[b][sdpcol[b][v][i]]] += solvector[sdpvar[b][v]] * sdpval[b][v][i];/*lint !e679*/
+                     row = sdprow[b][v][i] - indchanges[b][sdprow[b][v][i]];
+                     col = sdpcol[b][v][i] - indchanges[b][sdpcol[b][v][i]];
+                     assert( col <= row );
+                     sdpmatrix[(row * (row + 1)) / 2 + col] += solvector[sdpvar[b][v]] * sdpval[b][v][i];
                   }
                }
             }
@@ -229,35 +231,28 @@ SCIP_RETCODE SCIPsdpSolcheckerCheck(
             {
                for (i = 0; i < sdpconstnblocknonz[b]; i++)
                {
-                  fullsdpmatrix[((sdpconstrow[b][i] - indchanges[b][sdpconstrow[b][i]]) * (sdpblocksizes[b] - nremovedinds[b])) +
-                     sdpconstcol[b][i] - indchanges[b][sdpconstcol[b][i]]] -= sdpconstval[b][i];/*lint !e679*/
-               }
-            }
-
-            /* extend to full symmetric matrix for LAPACK */
-            for (i = 0; i < sdpblocksizes[b] - nremovedinds[b]; i++)
-            {
-               for (j = 0; j < i; j++)
-               {
-                  fullsdpmatrix[j * (sdpblocksizes[b] - nremovedinds[b]) + i] = fullsdpmatrix[i * (sdpblocksizes[b] - nremovedinds[b]) + j];/*lint !e679*/
+                  row = sdpconstrow[b][i] - indchanges[b][sdpconstrow[b][i]];
+                  col = sdpconstcol[b][i] - indchanges[b][sdpconstcol[b][i]];
+                  assert( col <= row );
+                  sdpmatrix[(row * (row + 1)) / 2 + col] -= sdpconstval[b][i];
                }
             }
 
             /* compute smallest eigenvalue using LAPACK */
-            SCIP_CALL( SCIPlapackComputeIthEigenvalue(bufmem, FALSE, sdpblocksizes[b] - nremovedinds[b], fullsdpmatrix, 1, &eigenvalue, NULL) );
+            SCIP_CALL( SCIPlapackComputeIthEigenvaluePacked(bufmem, FALSE, blocksize, sdpmatrix, 1, &eigenvalue, NULL) );
 
             if ( eigenvalue < - feastol )
             {
                SCIPdebugMessage("solution found infeasible (feastol=%g) for dual sdp constraint %d, smallest eigenvector %.10g\n",
                   feastol, b, eigenvalue);
-               BMSfreeBufferMemoryArray(bufmem, &fullsdpmatrix);
+               BMSfreeBufferMemoryArray(bufmem, &sdpmatrix);
                *infeasible = TRUE;
                return SCIP_OKAY;
             }
          }
       }
 
-      BMSfreeBufferMemoryArray(bufmem, &fullsdpmatrix);
+      BMSfreeBufferMemoryArray(bufmem, &sdpmatrix);
    }
 
    *infeasible = FALSE;
@@ -427,9 +422,12 @@ SCIP_RETCODE SCIPsdpSolcheckerCheckAndGetViolDual(
    /* check sdp constraints */
    if ( nsdpblocks > 0 )
    {
-      SCIP_Real* fullsdpmatrix;
+      SCIP_Real* sdpmatrix;
       SCIP_Real eigenvalue;
       int maxblocksize = 0;
+      int blocksize;
+      int row;
+      int col;
 
       /* allocate memory */
       if ( nsdpblocks == 1 )
@@ -444,20 +442,17 @@ SCIP_RETCODE SCIPsdpSolcheckerCheckAndGetViolDual(
          }
       }
 
-      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &fullsdpmatrix, maxblocksize * maxblocksize) );/*lint !e647*/
+      /* LAPACK works on the lower triangular part in packed storage, so we do not need the full matrix */
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &sdpmatrix, (maxblocksize * (maxblocksize + 1)) / 2) );/*lint !e647*/
 
       for (b = 0; b < nsdpblocks; b++)
       {
          if ( blockindchanges[b] > -1 )
          {
-            /* initialize lower triangular part of fullsdpmatrix with zero */
-            for (i = 0; i < sdpblocksizes[b] - nremovedinds[b]; i++)
-            {
-               for (j = 0; j <= i; j++)
-               {
-                  fullsdpmatrix[i * (sdpblocksizes[b] - nremovedinds[b]) + j] = 0.0; /*lint !e679*/
-               }
-            }
+            blocksize = sdpblocksizes[b] - nremovedinds[b];
+
+            /* initialize lower triangular part of sdpmatrix with zero */
+            BMSclearMemoryArray(sdpmatrix, (blocksize * (blocksize + 1)) / 2);
 
             /* iterate over all non-fixed variables and add the corresponding nonzeros */
             for (v = 0; v < sdpnblockvars[b]; v++)
@@ -466,8 +461,10 @@ SCIP_RETCODE SCIPsdpSolcheckerCheckAndGetViolDual(
                {
                   for (i = 0; i < sdpnblockvarnonz[b][v]; i++)
                   {
-                     fullsdpmatrix[((sdprow[b][v][i] - indchanges[b][sdprow[b][v][i]]) * (sdpblocksizes[b] - nremovedinds[b])) +
-                                   sdpcol[b][v][i] - indchanges[b][sdpcol[b][v][i]]] += solvector[sdpvar[b][v]] * sdpval[b][v][i];/*lint !e679*/
+                     row = sdprow[b][v][i] - indchanges[b][sdprow[b][v][i]];
+                     col = sdpcol[b][v][i] - indchanges[b][sdpcol[b][v][i]];
+                     assert( col <= row );
+                     sdpmatrix[(row * (row + 1)) / 2 + col] += solvector[sdpvar[b][v]] * sdpval[b][v][i];
                   }
                }
             }
@@ -477,22 +474,15 @@ SCIP_RETCODE SCIPsdpSolcheckerCheckAndGetViolDual(
             {
                for (i = 0; i < sdpconstnblocknonz[b]; i++)
                {
-                  fullsdpmatrix[((sdpconstrow[b][i] - indchanges[b][sdpconstrow[b][i]]) * (sdpblocksizes[b] - nremovedinds[b])) +
-                     sdpconstcol[b][i] - indchanges[b][sdpconstcol[b][i]]] -= sdpconstval[b][i];/*lint !e679*/
-               }
-            }
-
-            /* extend to full symmetric matrix for LAPACK */
-            for (i = 0; i < sdpblocksizes[b] - nremovedinds[b]; i++)
-            {
-               for (j = 0; j < i; j++)
-               {
-                  fullsdpmatrix[j * (sdpblocksizes[b] - nremovedinds[b]) + i] = fullsdpmatrix[i * (sdpblocksizes[b] - nremovedinds[b]) + j];/*lint !e679*/
+                  row = sdpconstrow[b][i] - indchanges[b][sdpconstrow[b][i]];
+                  col = sdpconstcol[b][i] - indchanges[b][sdpconstcol[b][i]];
+                  assert( col <= row );
+                  sdpmatrix[(row * (row + 1)) / 2 + col] -= sdpconstval[b][i];
                }
             }
 
             /* compute smallest eigenvalue using LAPACK */
-            SCIP_CALL( SCIPlapackComputeIthEigenvalue(bufmem, FALSE, sdpblocksizes[b] - nremovedinds[b], fullsdpmatrix, 1, &eigenvalue, NULL) );
+            SCIP_CALL( SCIPlapackComputeIthEigenvaluePacked(bufmem, FALSE, blocksize, sdpmatrix, 1, &eigenvalue, NULL) );
 
             viol = MAX(-eigenvalue, 0.0);
             *sumabsviolsdp += viol;
@@ -508,13 +498,12 @@ SCIP_RETCODE SCIPsdpSolcheckerCheckAndGetViolDual(
             {
                SCIPdebugMessage("solution found infeasible (feastol=%.10g) for dual SDP constraint %d, smallest eigenvector %.10g\n",
                      feastol, b, eigenvalue);
-               BMSfreeBufferMemoryArray(bufmem, &fullsdpmatrix);
                *infeasible = TRUE;
             }
          }
       }
 
-      BMSfreeBufferMemoryArray(bufmem, &fullsdpmatrix);
+      BMSfreeBufferMemoryArray(bufmem, &sdpmatrix);
    }
 
    return SCIP_OKAY;
@@ -49,33 +49,22 @@
 
 #ifdef ARPACK
 
-/** determine whether linear combination with value alpha is feasible */
+/** determine whether linear combination with value alpha is feasible
+ *
+ *  The ARPACK data keeps the sparse operator and workspace between calls and starts from the last eigenvector.
+ */
 static
 SCIP_RETCODE SCIPoneVarFeasibleArpackSparse(
-   BMS_BUFMEM*           bufmem,             /**< buffer memory */
-   int                   blocksize,          /**< size of the SDP-block */
+   SCIP_ARPACKONEVAR*    arpackdata,         /**< data for eigenvector computations */
    SCIP_Real             alpha,              /**< variable value to test */
-   int                   sdpnnonz,           /**< number of nonzero elements in the SDP-constraint-matrix */
-   int*                  sdprow,             /**< array of row-indices of nonzero matrix entries */
-   int*                  sdpcol,             /**< array of column-indices of nonzero matrix entries */
-   SCIP_Real*            sdpval,             /**< array of nonzero values */
-   int                   sdpconstnnonz,      /**< number of nonzero elements in the constant matrix of the SDP-block */
-   int*                  sdpconstrow,        /**< array of row-indices of constant matrix */
-   int*                  sdpconstcol,        /**< array of column-indices of constant matrix */
-   SCIP_Real*            sdpconstval,        /**< array of nonzero values of entries of constant matrix */
    SCIP_Real*            eigenvalue,         /**< pointer to store eigenvalue */
    SCIP_Real*            eigenvector         /**< corresponding eigenvector */
    )
 {
-   assert( sdpconstnnonz == 0 || sdpconstrow != NULL );
-   assert( sdpconstnnonz == 0 || sdpconstcol != NULL );
-   assert( sdpconstnnonz == 0 || sdpconstval != NULL );
-   assert( sdpnnonz == 0 || sdprow != NULL );
-   assert( sdpnnonz == 0 || sdpcol != NULL );
-   assert( sdpnnonz == 0 || sdpval != NULL );
+   assert( arpackdata != NULL );
    assert( eigenvalue != NULL );
 
-   SCIP_CALL( SCIParpackComputeSmallestEigenvectorOneVar(bufmem, blocksize, alpha, sdpnnonz, sdprow, sdpcol, sdpval, sdpconstnnonz, sdpconstrow, sdpconstcol, sdpconstval, eigenvalue, eigenvector) );
+   SCIP_CALL( SCIParpackOneVarComputeSmallestEigenvector(arpackdata, alpha, eigenvalue, eigenvector) );
 
    return SCIP_OKAY;
 }
@@ -181,7 +170,9 @@ SCIP_RETCODE SCIPsolveOneVarSDP(
    SCIP_Real eigenvalue;
    SCIP_Real supergradient = SCIP_INVALID;
    SCIP_Real mu;
-#ifndef ARPACK
+#ifdef ARPACK
+   SCIP_ARPACKONEVAR* arpackdata = NULL;
+#else
    int r;
    int c;
    int i;
@@ -215,8 +206,11 @@ SCIP_RETCODE SCIPsolveOneVarSDP(
 
    BMS_CALL( BMSallocBufferMemoryArray(bufmem, &eigenvector, blocksize) );
 
+#ifdef ARPACK
+   /* set up sparse operator mu A - B once for all eigenvector computations */
+   SCIP_CALL( SCIParpackCreateOneVar(bufmem, &arpackdata, blocksize, sdpnnonz, sdprow, sdpcol, sdpval, sdpconstnnonz, sdpconstrow, sdpconstcol, sdpconstval) );
+#else
    /* fill in full matrices */
-#ifndef ARPACK
    BMS_CALL( BMSallocClearBufferMemoryArray(bufmem, &fullconstmatrix, blocksize * blocksize) );
    BMS_CALL( BMSallocClearBufferMemoryArray(bufmem, &fullmatrix, blocksize * blocksize) );
    BMS_CALL( BMSallocBufferMemoryArray(bufmem, &tmpmatrix, blocksize * blocksize) );
@@ -244,7 +238,7 @@ SCIP_RETCODE SCIPsolveOneVarSDP(
 
    /* check upper bound */
 #ifdef ARPACK
-   SCIP_CALL( SCIPoneVarFeasibleArpackSparse(bufmem, blocksize, ub, sdpnnonz, sdprow, sdpcol, sdpval, sdpconstnnonz, sdpconstrow, sdpconstcol, sdpconstval, &eigenvalue, eigenvector) );
+   SCIP_CALL( SCIPoneVarFeasibleArpackSparse(arpackdata, ub, &eigenvalue, eigenvector) );
 #else
    SCIP_CALL( SCIPoneVarFeasible(bufmem, blocksize, tmpmatrix, fullconstmatrix, fullmatrix, ub, &eigenvalue, eigenvector) );
 #endif
@@ -271,7 +265,7 @@ SCIP_RETCODE SCIPsolveOneVarSDP(
 
    /* otherwise check lower bound */
 #ifdef ARPACK
-   SCIP_CALL( SCIPoneVarFeasibleArpackSparse(bufmem, blocksize, lb, sdpnnonz, sdprow, sdpcol, sdpval, sdpconstnnonz, sdpconstrow, sdpconstcol, sdpconstval, &eigenvalue, eigenvector) );
+   SCIP_CALL( SCIPoneVarFeasibleArpackSparse(arpackdata, lb, &eigenvalue, eigenvector) );
 #else
    SCIP_CALL( SCIPoneVarFeasible(bufmem, blocksize, tmpmatrix, fullconstmatrix, fullmatrix, lb, &eigenvalue, eigenvector) );
 #endif
@@ -325,7 +319,7 @@ SCIP_RETCODE SCIPsolveOneVarSDP(
 
       /* compute eigenvalue and eigenvector */
 #ifdef ARPACK
-      SCIP_CALL( SCIPoneVarFeasibleArpackSparse(bufmem, blocksize, mu, sdpnnonz, sdprow, sdpcol, sdpval, sdpconstnnonz, sdpconstrow, sdpconstcol, sdpconstval, &eigenvalue, eigenvector) );
+      SCIP_CALL( SCIPoneVarFeasibleArpackSparse(arpackdata, mu, &eigenvalue, eigenvector) );
 #else
       SCIP_CALL( SCIPoneVarFeasible(bufmem, blocksize, tmpmatrix, fullconstmatrix, fullmatrix, mu, &eigenvalue, eigenvector) );
 #endif
@@ -359,6 +353,9 @@ SCIP_RETCODE SCIPsolveOneVarSDP(
    BMSfreeBufferMemoryArrayNull(bufmem, &tmpmatrix);
    BMSfreeBufferMemoryArrayNull(bufmem, &fullmatrix);
    BMSfreeBufferMemoryArrayNull(bufmem, &fullconstmatrix);
+#ifdef ARPACK
+   SCIParpackFreeOneVar(bufmem, &arpackdata);
+#endif
    BMSfreeBufferMemoryArray(bufmem, &eigenvector);
 
    return SCIP_OKAY;
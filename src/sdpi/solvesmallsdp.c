@@ -0,0 +1,655 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   solvesmallsdp.c
+ * @brief  Solve SDP with few variables and one SDP block
+ * @author SCIP-SDP developers
+ *
+ * We use a primal barrier method in the variables y for the problem
+ * \f[
+ *    \min\{c^T y : Z(y) := \sum_j A_j y_j - A_0 \succeq 0,\ \ell \leq y \leq u\},
+ * \f]
+ * i.e., we minimize \f$t\, c^T y - \log\det Z(y) - \sum_j (\log(y_j - \ell_j) + \log(u_j - y_j))\f$ for increasing
+ * \f$t\f$ by Newton's method. With the eigenvector decomposition \f$Z = Q \Lambda Q^T\f$ and
+ * \f$S_j = \Lambda^{-1/2} Q^T A_j Q \Lambda^{-1/2}\f$, the gradient of \f$-\log\det Z(y)\f$ is \f$-\mbox{tr}(S_j)\f$ and
+ * the Hessian is \f$\langle S_i, S_j \rangle\f$. Since the number of variables is small, the Newton system is tiny and
+ * the costs are dominated by the eigenvector decomposition.
+ *
+ * The matrix \f$X = Z^{-1} / t\f$ is psd. Together with the multipliers of the bounds that absorb the residuals
+ * \f$c_j - \langle A_j, X \rangle\f$, it forms a feasible primal solution, so its objective is a valid lower bound. We stop
+ * if it is close enough to \f$c^T y\f$.
+ *
+ * If \f$Z(y) \not\succ 0\f$ at the center of the bounds, a phase one minimizes s subject to \f$Z(y) + s I \succ 0\f$
+ * until s becomes negative.
+ */
+
+#include <math.h>
+
+#include "scip/pub_misc.h"
+#include "sdpi/solvesmallsdp.h"
+#include "sdpi/lapack_interface.h"
+
+/** Checks if a BMSallocMemory-call was successfull, otherwise returns SCIP_NOMEMORY */
+#define BMS_CALL(x)   do                                                                                      \
+                      {                                                                                       \
+                          if( NULL == (x) )                                                                   \
+                          {                                                                                   \
+                             SCIPerrorMessage("No memory in function call\n");                                \
+                             return SCIP_NOMEMORY;                                                            \
+                          }                                                                                   \
+                      }                                                                                       \
+                      while( FALSE )
+
+#define BARRIERFACTOR     10.0     /**< factor by which the barrier parameter t is increased */
+#define MAXBARRIERPARAM   1e12     /**< maximal barrier parameter t */
+#define NEWTONTOL         1e-10    /**< tolerance on the squared Newton decrement for the centering steps */
+#define ARMIJOFACTOR      0.25     /**< factor in the sufficient decrease condition of the line search */
+#define MINSTEPSIZE       1e-10    /**< minimal step size in the line search */
+#define BOUNDSTEPFACTOR   0.99     /**< fraction of the distance to the bounds that may be used in one step */
+
+
+/** computes eigenvector decomposition of Z(y) = sum_j A_j y_j - A_0 */
+static
+SCIP_RETCODE computeEigenDecomposition(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real**           fullmatrices,       /**< dense matrices A_j */
+   SCIP_Real*            fullconstmatrix,    /**< dense constant matrix A_0 */
+   const SCIP_Real*      y,                  /**< point */
+   SCIP_Real*            tmpmatrix,          /**< temporary matrix */
+   SCIP_Real*            eigenvalues,        /**< array to store eigenvalues in ascending order */
+   SCIP_Real*            eigenvectors        /**< array to store eigenvectors as rows */
+   )
+{
+   int i;
+   int j;
+
+   for (i = 0; i < blocksize * blocksize; ++i)
+      tmpmatrix[i] = - fullconstmatrix[i];
+
+   for (j = 0; j < nvars; ++j)
+   {
+      if ( y[j] == 0.0 )
+         continue;
+
+      for (i = 0; i < blocksize * blocksize; ++i)
+         tmpmatrix[i] += y[j] * fullmatrices[j][i];
+   }
+
+   SCIP_CALL( SCIPlapackComputeEigenvectorDecomposition(bufmem, blocksize, tmpmatrix, eigenvalues, eigenvectors) );
+
+   return SCIP_OKAY;
+}
+
+/** computes the value of the barrier function (assumes that Z(y) is positive definite and y is strictly within its finite bounds) */
+static
+SCIP_Real barrierValue(
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   nvars,              /**< number of variables */
+   const SCIP_Real*      obj,                /**< objective coefficients of variables */
+   const SCIP_Real*      lb,                 /**< lower bounds of variables */
+   const SCIP_Real*      ub,                 /**< upper bounds of variables */
+   SCIP_Real             infinity,           /**< infinity value */
+   SCIP_Real             t,                  /**< barrier parameter */
+   const SCIP_Real*      y,                  /**< point */
+   const SCIP_Real*      eigenvalues         /**< eigenvalues of Z(y) */
+   )
+{
+   SCIP_Real val = 0.0;
+   int j;
+   int k;
+
+   for (j = 0; j < nvars; ++j)
+   {
+      val += t * obj[j] * y[j];
+      if ( lb[j] > -infinity )
+         val -= log(y[j] - lb[j]);
+      if ( ub[j] < infinity )
+         val -= log(ub[j] - y[j]);
+   }
+
+   for (k = 0; k < blocksize; ++k)
+      val -= log(eigenvalues[k]);
+
+   return val;
+}
+
+/** computes gradient and Hessian of the barrier function and the traces of S_j */
+static
+SCIP_RETCODE computeDerivatives(
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real**           fullmatrices,       /**< dense matrices A_j */
+   const SCIP_Real*      obj,                /**< objective coefficients of variables */
+   const SCIP_Real*      lb,                 /**< lower bounds of variables */
+   const SCIP_Real*      ub,                 /**< upper bounds of variables */
+   SCIP_Real             infinity,           /**< infinity value */
+   SCIP_Real             t,                  /**< barrier parameter */
+   const SCIP_Real*      y,                  /**< point */
+   const SCIP_Real*      eigenvalues,        /**< eigenvalues of Z(y) */
+   SCIP_Real*            eigenvectors,       /**< eigenvectors of Z(y) as rows */
+   SCIP_Real*            scale,              /**< array of length blocksize to store the scaling factors */
+   SCIP_Real*            tmpmatrix,          /**< temporary matrix */
+   SCIP_Real**           scaledmatrices,     /**< arrays to store the matrices S_j */
+   SCIP_Real*            traces,             /**< array to store the traces of S_j */
+   SCIP_Real*            gradient,           /**< array to store the gradient */
+   SCIP_Real*            hessian             /**< array to store the Hessian */
+   )
+{
+   int i;
+   int j;
+   int k;
+   int l;
+
+   for (k = 0; k < blocksize; ++k)
+   {
+      assert( eigenvalues[k] > 0.0 );
+      scale[k] = 1.0 / sqrt(eigenvalues[k]);
+   }
+
+   /* compute S_j = Lambda^{-1/2} Q^T A_j Q Lambda^{-1/2}; the eigenvector rows are the columns of Q in column-major order */
+   for (j = 0; j < nvars; ++j)
+   {
+      SCIP_Real* S;
+
+      S = scaledmatrices[j];
+      SCIP_CALL( SCIPlapackMatrixMatrixMult(blocksize, blocksize, fullmatrices[j], FALSE, blocksize, blocksize, eigenvectors, FALSE, tmpmatrix) );
+      SCIP_CALL( SCIPlapackMatrixMatrixMult(blocksize, blocksize, eigenvectors, TRUE, blocksize, blocksize, tmpmatrix, FALSE, S) );
+
+      traces[j] = 0.0;
+      for (k = 0; k < blocksize; ++k)
+      {
+         for (l = 0; l < blocksize; ++l)
+            S[k * blocksize + l] *= scale[k] * scale[l];
+         traces[j] += S[k * blocksize + k];
+      }
+   }
+
+   for (i = 0; i < nvars; ++i)
+   {
+      gradient[i] = t * obj[i] - traces[i];
+      if ( lb[i] > -infinity )
+         gradient[i] -= 1.0 / (y[i] - lb[i]);
+      if ( ub[i] < infinity )
+         gradient[i] += 1.0 / (ub[i] - y[i]);
+
+      for (j = 0; j <= i; ++j)
+      {
+         SCIP_Real val = 0.0;
+
+         for (k = 0; k < blocksize * blocksize; ++k)
+            val += scaledmatrices[i][k] * scaledmatrices[j][k];
+
+         hessian[i * nvars + j] = val;
+         hessian[j * nvars + i] = val;
+      }
+
+      if ( lb[i] > -infinity )
+         hessian[i * nvars + i] += 1.0 / ((y[i] - lb[i]) * (y[i] - lb[i]));
+      if ( ub[i] < infinity )
+         hessian[i * nvars + i] += 1.0 / ((ub[i] - y[i]) * (ub[i] - y[i]));
+   }
+
+   return SCIP_OKAY;
+}
+
+/** computes the gap between c^T y and the objective of the primal solution X = Z^{-1} / t with bound multipliers */
+static
+SCIP_Real computeGap(
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   nvars,              /**< number of variables */
+   const SCIP_Real*      obj,                /**< objective coefficients of variables */
+   const SCIP_Real*      lb,                 /**< lower bounds of variables */
+   const SCIP_Real*      ub,                 /**< upper bounds of variables */
+   SCIP_Real             t,                  /**< barrier parameter */
+   const SCIP_Real*      y,                  /**< point */
+   const SCIP_Real*      traces              /**< traces of S_j, i.e., t <A_j, X> */
+   )
+{
+   SCIP_Real gap;
+   int j;
+
+   gap = blocksize / t;
+   for (j = 0; j < nvars; ++j)
+   {
+      SCIP_Real residual;
+
+      residual = obj[j] - traces[j] / t;
+      if ( residual > 0.0 )
+         gap += residual * (y[j] - lb[j]);
+      else
+         gap -= residual * (ub[j] - y[j]);
+   }
+
+   return gap;
+}
+
+/** runs the barrier method from the strictly feasible point y
+ *
+ *  In phase one, the last variable is s and the method stops successfully as soon as s is negative. Otherwise, the
+ *  method stops successfully if the relative gap is at most gaptol. On success, eigenvalues, eigenvectors and traces
+ *  correspond to y and t.
+ */
+static
+SCIP_RETCODE runBarrier(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real**           fullmatrices,       /**< dense matrices A_j */
+   SCIP_Real*            fullconstmatrix,    /**< dense constant matrix A_0 */
+   const SCIP_Real*      obj,                /**< objective coefficients of variables */
+   const SCIP_Real*      lb,                 /**< lower bounds of variables */
+   const SCIP_Real*      ub,                 /**< upper bounds of variables */
+   SCIP_Real             infinity,           /**< infinity value */
+   SCIP_Bool             phaseone,           /**< whether we run phase one */
+   SCIP_Real             gaptol,             /**< relative gap tolerance */
+   int                   maxiter,            /**< maximal number of Newton steps */
+   SCIP_Real*            y,                  /**< strictly feasible start point, will be overwritten */
+   SCIP_Real*            t,                  /**< pointer to barrier parameter */
+   SCIP_Real*            eigenvalues,        /**< array to store eigenvalues of Z(y) */
+   SCIP_Real*            eigenvectors,       /**< array to store eigenvectors of Z(y) */
+   SCIP_Real**           scaledmatrices,     /**< arrays to store the matrices S_j */
+   SCIP_Real*            traces,             /**< array to store the traces of S_j */
+   SCIP_Real*            tmpmatrix,          /**< temporary matrix */
+   int*                  niterations,        /**< pointer to update the number of Newton steps */
+   SCIP_Bool*            success             /**< pointer to store whether the method stopped successfully */
+   )
+{
+   SCIP_Real* trialeigenvalues;
+   SCIP_Real* trialeigenvectors;
+   SCIP_Real* scale;
+   SCIP_Real* gradient;
+   SCIP_Real* hessian;
+   SCIP_Real* rhs;
+   SCIP_Real* direction;
+   SCIP_Real* ytrial;
+   SCIP_Real fval;
+   int j;
+
+   assert( success != NULL );
+
+   *success = FALSE;
+
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &trialeigenvalues, blocksize) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &trialeigenvectors, blocksize * blocksize) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &scale, blocksize) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &gradient, nvars) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &hessian, nvars * nvars) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &rhs, nvars) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &direction, nvars) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &ytrial, nvars) );
+
+   SCIP_CALL( computeEigenDecomposition(bufmem, blocksize, nvars, fullmatrices, fullconstmatrix, y, tmpmatrix, eigenvalues, eigenvectors) );
+   assert( eigenvalues[0] > 0.0 );
+   fval = barrierValue(blocksize, nvars, obj, lb, ub, infinity, *t, y, eigenvalues);
+
+   while ( *niterations < maxiter )
+   {
+      SCIP_Real decrement = 0.0;
+      SCIP_Real alpha = 1.0;
+      SCIP_Real ftrial = SCIP_INVALID;
+
+      SCIP_CALL( computeDerivatives(blocksize, nvars, fullmatrices, obj, lb, ub, infinity, *t, y, eigenvalues, eigenvectors,
+            scale, tmpmatrix, scaledmatrices, traces, gradient, hessian) );
+
+      /* solve Newton system */
+      for (j = 0; j < nvars; ++j)
+         rhs[j] = - gradient[j];
+      SCIP_CALL( SCIPlapackLinearSolve(bufmem, nvars, nvars, hessian, rhs, direction) );
+      ++(*niterations);
+
+      for (j = 0; j < nvars; ++j)
+         decrement -= gradient[j] * direction[j];
+
+      /* the primal solution for the current point is valid even if we are not on the central path, so check the gap in every step */
+      if ( ! phaseone )
+      {
+         SCIP_Real gap;
+         SCIP_Real pobj = 0.0;
+
+         for (j = 0; j < nvars; ++j)
+            pobj += obj[j] * y[j];
+
+         gap = computeGap(blocksize, nvars, obj, lb, ub, *t, y, traces);
+         SCIPdebugMessage("t = %g: primal objective %.15g, gap %g, Newton decrement %g.\n", *t, pobj, gap, decrement);
+
+         if ( gap <= gaptol * MAX(1.0, REALABS(pobj)) )
+         {
+            *success = TRUE;
+            break;
+         }
+      }
+
+      /* if we are close to the central path, increase barrier parameter */
+      if ( decrement <= NEWTONTOL )
+      {
+         /* in phase one, the gap to the minimal s is about (blocksize + number of bounds) / t on the central path; stop if
+          * s cannot become negative anymore (the problem is then probably infeasible and will be handled by the solver) */
+         if ( phaseone && y[nvars - 1] - (blocksize + 2 * (nvars - 1)) / *t > 0.0 )
+         {
+            SCIPdebugMessage("Phase one: minimal s is positive (s = %g, t = %g).\n", y[nvars - 1], *t);
+            break;
+         }
+
+         if ( *t * BARRIERFACTOR > MAXBARRIERPARAM )
+            break;
+
+         *t *= BARRIERFACTOR;
+         fval = barrierValue(blocksize, nvars, obj, lb, ub, infinity, *t, y, eigenvalues);
+         continue;
+      }
+
+      /* determine maximal step size such that we stay strictly within the bounds */
+      for (j = 0; j < nvars; ++j)
+      {
+         if ( direction[j] < 0.0 && lb[j] > -infinity )
+            alpha = MIN(alpha, BOUNDSTEPFACTOR * (y[j] - lb[j]) / (- direction[j]));
+         else if ( direction[j] > 0.0 && ub[j] < infinity )
+            alpha = MIN(alpha, BOUNDSTEPFACTOR * (ub[j] - y[j]) / direction[j]);
+      }
+
+      /* backtracking line search */
+      while ( alpha >= MINSTEPSIZE )
+      {
+         for (j = 0; j < nvars; ++j)
+            ytrial[j] = y[j] + alpha * direction[j];
+
+         SCIP_CALL( computeEigenDecomposition(bufmem, blocksize, nvars, fullmatrices, fullconstmatrix, ytrial, tmpmatrix, trialeigenvalues, trialeigenvectors) );
+
+         if ( trialeigenvalues[0] > 0.0 )
+         {
+            ftrial = barrierValue(blocksize, nvars, obj, lb, ub, infinity, *t, ytrial, trialeigenvalues);
+            if ( ftrial <= fval - ARMIJOFACTOR * alpha * decrement )
+               break;
+         }
+         alpha /= 2.0;
+      }
+
+      /* stop if no progress is possible */
+      if ( alpha < MINSTEPSIZE )
+      {
+         SCIPdebugMessage("Line search failed at t = %g.\n", *t);
+         break;
+      }
+
+      BMScopyMemoryArray(y, ytrial, nvars);
+      BMScopyMemoryArray(eigenvalues, trialeigenvalues, blocksize);
+      BMScopyMemoryArray(eigenvectors, trialeigenvectors, blocksize * blocksize);
+      fval = ftrial;
+
+      if ( phaseone && y[nvars - 1] < 0.0 )
+      {
+         *success = TRUE;
+         break;
+      }
+   }
+
+   BMSfreeBufferMemoryArray(bufmem, &ytrial);
+   BMSfreeBufferMemoryArray(bufmem, &direction);
+   BMSfreeBufferMemoryArray(bufmem, &rhs);
+   BMSfreeBufferMemoryArray(bufmem, &hessian);
+   BMSfreeBufferMemoryArray(bufmem, &gradient);
+   BMSfreeBufferMemoryArray(bufmem, &scale);
+   BMSfreeBufferMemoryArray(bufmem, &trialeigenvectors);
+   BMSfreeBufferMemoryArray(bufmem, &trialeigenvalues);
+
+   return SCIP_OKAY;
+}
+
+/** fills the lower triangular part of a sparse matrix into a dense symmetric matrix */
+static
+void fillDenseMatrix(
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   nnonz,              /**< number of nonzeros */
+   const int*            row,                /**< row-indices of nonzeros */
+   const int*            col,                /**< column-indices of nonzeros */
+   const SCIP_Real*      val,                /**< values of nonzeros */
+   SCIP_Real*            fullmatrix          /**< array of length blocksize * blocksize to store the matrix */
+   )
+{
+   int i;
+
+   for (i = 0; i < blocksize * blocksize; ++i)
+      fullmatrix[i] = 0.0;
+
+   for (i = 0; i < nnonz; ++i)
+   {
+      assert( 0 <= row[i] && row[i] < blocksize );
+      assert( 0 <= col[i] && col[i] < blocksize );
+
+      fullmatrix[row[i] * blocksize + col[i]] += val[i];
+      if ( row[i] != col[i] )
+         fullmatrix[col[i] * blocksize + row[i]] += val[i];
+   }
+}
+
+/** solves SDP with few variables with finite bounds and one SDP block by a dense barrier method in the variables
+ *
+ *  The problem is \f$\min\{c^T y : \sum_j A_j y_j - A_0 \succeq 0,\ \ell \leq y \leq u\}\f$. If the method converges,
+ *  objval contains the objective of a feasible primal solution (X, lbvals, ubvals) and therefore a valid lower bound;
+ *  otherwise objval is SCIP_INVALID and the problem has to be solved by other means.
+ */
+SCIP_RETCODE SCIPsolveSmallSDP(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   int                   nvars,              /**< number of variables */
+   const SCIP_Real*      obj,                /**< objective coefficients of variables */
+   const SCIP_Real*      lb,                 /**< lower bounds of variables */
+   const SCIP_Real*      ub,                 /**< upper bounds of variables */
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   sdpconstnnonz,      /**< number of nonzero elements in the constant matrix of the SDP-block */
+   int*                  sdpconstrow,        /**< array of row-indices of constant matrix */
+   int*                  sdpconstcol,        /**< array of column-indices of constant matrix */
+   SCIP_Real*            sdpconstval,        /**< array of nonzero values of entries of constant matrix */
+   int*                  sdpnnonz,           /**< number of nonzero elements in the matrix of each variable */
+   int**                 sdprow,             /**< array of row-indices of nonzero matrix entries for each variable */
+   int**                 sdpcol,             /**< array of column-indices of nonzero matrix entries for each variable */
+   SCIP_Real**           sdpval,             /**< array of nonzero values for each variable */
+   SCIP_Real             infinity,           /**< infinity value */
+   SCIP_Real             gaptol,             /**< relative gap tolerance */
+   int                   maxiter,            /**< maximal number of Newton steps */
+   SCIP_Real*            sol,                /**< array of length nvars to store the solution */
+   SCIP_Real*            lbvals,             /**< array of length nvars to store the primal values corresponding to the lower bounds */
+   SCIP_Real*            ubvals,             /**< array of length nvars to store the primal values corresponding to the upper bounds */
+   SCIP_Real*            primalmatrix,       /**< array of length blocksize * blocksize to store the primal matrix (or NULL) */
+   SCIP_Real*            objval,             /**< pointer to store the objective value of the primal solution */
+   int*                  niterations         /**< pointer to store the number of Newton steps */
+   )
+{
+   SCIP_Real** fullmatrices;
+   SCIP_Real** scaledmatrices;
+   SCIP_Real* fullconstmatrix;
+   SCIP_Real* tmpmatrix;
+   SCIP_Real* eigenvalues;
+   SCIP_Real* eigenvectors;
+   SCIP_Real* traces;
+   SCIP_Real* y;
+   SCIP_Real* ylb;
+   SCIP_Real* yub;
+   SCIP_Real* yobj;
+   SCIP_Real t = 1.0;
+   SCIP_Bool success;
+   int j;
+   int k;
+
+   assert( bufmem != NULL );
+   assert( nvars > 0 );
+   assert( obj != NULL );
+   assert( lb != NULL );
+   assert( ub != NULL );
+   assert( blocksize > 0 );
+   assert( sdpconstnnonz == 0 || (sdpconstrow != NULL && sdpconstcol != NULL && sdpconstval != NULL) );
+   assert( sdpnnonz != NULL );
+   assert( sol != NULL );
+   assert( lbvals != NULL );
+   assert( ubvals != NULL );
+   assert( objval != NULL );
+   assert( niterations != NULL );
+
+   *objval = SCIP_INVALID;
+   *niterations = 0;
+
+   /* can currently only treat the case with finite lower and upper bounds */
+   for (j = 0; j < nvars; ++j)
+   {
+      if ( lb[j] <= -infinity || ub[j] >= infinity || lb[j] >= ub[j] )
+         return SCIP_OKAY;
+   }
+
+   SCIPdebugMessage("Solve SDP with %d variables and block size %d.\n", nvars, blocksize);
+
+   /* allocate memory; we reserve space for the additional variable of phase one */
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &fullmatrices, nvars + 1) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &scaledmatrices, nvars + 1) );
+   for (j = 0; j <= nvars; ++j)
+   {
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &fullmatrices[j], blocksize * blocksize) );
+      BMS_CALL( BMSallocBufferMemoryArray(bufmem, &scaledmatrices[j], blocksize * blocksize) );
+   }
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &fullconstmatrix, blocksize * blocksize) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &tmpmatrix, blocksize * blocksize) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &eigenvalues, blocksize) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &eigenvectors, blocksize * blocksize) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &traces, nvars + 1) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &y, nvars + 1) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &ylb, nvars + 1) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &yub, nvars + 1) );
+   BMS_CALL( BMSallocBufferMemoryArray(bufmem, &yobj, nvars + 1) );
+
+   /* set up dense matrices */
+   fillDenseMatrix(blocksize, sdpconstnnonz, sdpconstrow, sdpconstcol, sdpconstval, fullconstmatrix);
+   for (j = 0; j < nvars; ++j)
+   {
+      assert( sdpnnonz[j] == 0 || (sdprow[j] != NULL && sdpcol[j] != NULL && sdpval[j] != NULL) );
+      fillDenseMatrix(blocksize, sdpnnonz[j], sdprow[j], sdpcol[j], sdpval[j], fullmatrices[j]);
+   }
+
+   /* start in the center of the bounds */
+   for (j = 0; j < nvars; ++j)
+      y[j] = (lb[j] + ub[j]) / 2.0;
+
+   SCIP_CALL( computeEigenDecomposition(bufmem, blocksize, nvars, fullmatrices, fullconstmatrix, y, tmpmatrix, eigenvalues, eigenvectors) );
+
+   /* if necessary, run phase one with additional variable s for the identity matrix to find a strictly feasible point */
+   if ( eigenvalues[0] <= 0.0 )
+   {
+      for (j = 0; j < nvars; ++j)
+      {
+         ylb[j] = lb[j];
+         yub[j] = ub[j];
+         yobj[j] = 0.0;
+      }
+      ylb[nvars] = -infinity;
+      yub[nvars] = infinity;
+      yobj[nvars] = 1.0;
+      y[nvars] = 1.0 - eigenvalues[0];
+
+      for (k = 0; k < blocksize * blocksize; ++k)
+         fullmatrices[nvars][k] = 0.0;
+      for (k = 0; k < blocksize; ++k)
+         fullmatrices[nvars][k * blocksize + k] = 1.0;
+
+      SCIP_CALL( runBarrier(bufmem, blocksize, nvars + 1, fullmatrices, fullconstmatrix, yobj, ylb, yub, infinity, TRUE, gaptol, maxiter,
+            y, &t, eigenvalues, eigenvectors, scaledmatrices, traces, tmpmatrix, niterations, &success) );
+
+      if ( ! success )
+      {
+         SCIPdebugMessage("Phase one did not find a strictly feasible point after %d iterations.\n", *niterations);
+         goto TERMINATE;
+      }
+      t = 1.0;
+   }
+
+   /* run phase two */
+   SCIP_CALL( runBarrier(bufmem, blocksize, nvars, fullmatrices, fullconstmatrix, obj, lb, ub, infinity, FALSE, gaptol, maxiter,
+         y, &t, eigenvalues, eigenvectors, scaledmatrices, traces, tmpmatrix, niterations, &success) );
+
+   if ( ! success )
+   {
+      SCIPdebugMessage("Barrier method did not converge after %d iterations.\n", *niterations);
+      goto TERMINATE;
+   }
+
+   /* The primal solution is X = Z^{-1} / t with <A_j, X> = tr(S_j) / t and bound multipliers that absorb the residuals.
+    * Its objective is <A_0, X> + lb^T lbvals - ub^T ubvals, where <A_0, X> = sum_j y_j <A_j, X> - <Z, X>. */
+   *objval = - blocksize / t;
+   for (j = 0; j < nvars; ++j)
+   {
+      SCIP_Real residual;
+
+      residual = obj[j] - traces[j] / t;
+      lbvals[j] = MAX(residual, 0.0);
+      ubvals[j] = MAX(-residual, 0.0);
+      sol[j] = y[j];
+
+      *objval += y[j] * traces[j] / t + lb[j] * lbvals[j] - ub[j] * ubvals[j];
+   }
+
+   if ( primalmatrix != NULL )
+   {
+      int l;
+      int r;
+
+      for (k = 0; k < blocksize * blocksize; ++k)
+         primalmatrix[k] = 0.0;
+
+      for (k = 0; k < blocksize; ++k)
+      {
+         SCIP_Real factor;
+
+         factor = 1.0 / (t * eigenvalues[k]);
+         for (r = 0; r < blocksize; ++r)
+         {
+            for (l = 0; l < blocksize; ++l)
+               primalmatrix[r * blocksize + l] += factor * eigenvectors[k * blocksize + r] * eigenvectors[k * blocksize + l];
+         }
+      }
+   }
+
+   SCIPdebugMessage("Solved SDP with %d variables in %d iterations, objective %.15g.\n", nvars, *niterations, *objval);
+
+ TERMINATE:
+   BMSfreeBufferMemoryArray(bufmem, &yobj);
+   BMSfreeBufferMemoryArray(bufmem, &yub);
+   BMSfreeBufferMemoryArray(bufmem, &ylb);
+   BMSfreeBufferMemoryArray(bufmem, &y);
+   BMSfreeBufferMemoryArray(bufmem, &traces);
+   BMSfreeBufferMemoryArray(bufmem, &eigenvectors);
+   BMSfreeBufferMemoryArray(bufmem, &eigenvalues);
+   BMSfreeBufferMemoryArray(bufmem, &tmpmatrix);
+   BMSfreeBufferMemoryArray(bufmem, &fullconstmatrix);
+   for (j = nvars; j >= 0; --j)
+   {
+      BMSfreeBufferMemoryArray(bufmem, &scaledmatrices[j]);
+      BMSfreeBufferMemoryArray(bufmem, &fullmatrices[j]);
+   }
+   BMSfreeBufferMemoryArray(bufmem, &scaledmatrices);
+   BMSfreeBufferMemoryArray(bufmem, &fullmatrices);
+
+   return SCIP_OKAY;
+}
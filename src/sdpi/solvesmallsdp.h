@@ -0,0 +1,84 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/* This file is part of SCIPSDP - a solving framework for mixed-integer      */
+/* semidefinite programs based on SCIP.                                      */
+/*                                                                           */
+/* Copyright (C) 2011-2013 Discrete Optimization, TU Darmstadt,              */
+/*                         EDOM, FAU Erlangen-Nürnberg                       */
+/*               2014-2023 Discrete Optimization, TU Darmstadt               */
+/*                                                                           */
+/*                                                                           */
+/* Licensed under the Apache License, Version 2.0 (the "License");           */
+/* you may not use this file except in compliance with the License.          */
+/* You may obtain a copy of the License at                                   */
+/*                                                                           */
+/*     http://www.apache.org/licenses/LICENSE-2.0                            */
+/*                                                                           */
+/* Unless required by applicable law or agreed to in writing, software       */
+/* distributed under the License is distributed on an "AS IS" BASIS,         */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  */
+/* See the License for the specific language governing permissions and       */
+/* limitations under the License.                                            */
+/*                                                                           */
+/*                                                                           */
+/* Based on SCIP - Solving Constraint Integer Programs                       */
+/* Copyright (C) 2002-2023 Zuse Institute Berlin                             */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   solvesmallsdp.h
+ * @brief  Solve SDP with few variables and one SDP block
+ * @author SCIP-SDP developers
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_SOLVESMALLSDP_H__
+#define __SCIP_SOLVESMALLSDP_H__
+
+#include "scip/def.h"
+#include "blockmemshell/memory.h"
+#include "scip/type_retcode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** solves SDP with few variables with finite bounds and one SDP block by a dense barrier method in the variables
+ *
+ *  The problem is \f$\min\{c^T y : \sum_j A_j y_j - A_0 \succeq 0,\ \ell \leq y \leq u\}\f$. If the method converges,
+ *  objval contains the objective of a feasible primal solution (X, lbvals, ubvals) and therefore a valid lower bound;
+ *  otherwise objval is SCIP_INVALID and the problem has to be solved by other means.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsolveSmallSDP(
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   int                   nvars,              /**< number of variables */
+   const SCIP_Real*      obj,                /**< objective coefficients of variables */
+   const SCIP_Real*      lb,                 /**< lower bounds of variables */
+   const SCIP_Real*      ub,                 /**< upper bounds of variables */
+   int                   blocksize,          /**< size of the SDP-block */
+   int                   sdpconstnnonz,      /**< number of nonzero elements in the constant matrix of the SDP-block */
+   int*                  sdpconstrow,        /**< array of row-indices of constant matrix */
+   int*                  sdpconstcol,        /**< array of column-indices of constant matrix */
+   SCIP_Real*            sdpconstval,        /**< array of nonzero values of entries of constant matrix */
+   int*                  sdpnnonz,           /**< number of nonzero elements in the matrix of each variable */
+   int**                 sdprow,             /**< array of row-indices of nonzero matrix entries for each variable */
+   int**                 sdpcol,             /**< array of column-indices of nonzero matrix entries for each variable */
+   SCIP_Real**           sdpval,             /**< array of nonzero values for each variable */
+   SCIP_Real             infinity,           /**< infinity value */
+   SCIP_Real             gaptol,             /**< relative gap tolerance */
+   int                   maxiter,            /**< maximal number of Newton steps */
+   SCIP_Real*            sol,                /**< array of length nvars to store the solution */
+   SCIP_Real*            lbvals,             /**< array of length nvars to store the primal values corresponding to the lower bounds */
+   SCIP_Real*            ubvals,             /**< array of length nvars to store the primal values corresponding to the upper bounds */
+   SCIP_Real*            primalmatrix,       /**< array of length blocksize * blocksize to store the primal matrix (or NULL) */
+   SCIP_Real*            objval,             /**< pointer to store the objective value of the primal solution */
+   int*                  niterations         /**< pointer to store the number of Newton steps */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
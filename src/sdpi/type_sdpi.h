@@ -63,7 +63,8 @@ enum SCIP_SDPParam
    SCIP_SDPPAR_PENINFEASADJUST= 13,     /**< gap- or feastol will be multiplied by this before checking for infeasibility using the penalty formulation */
    SCIP_SDPPAR_USEPRESOLVING  = 14,     /**< whether presolving should be used */
    SCIP_SDPPAR_USESCALING     = 15,     /**< whether the the SDP-solver should use scaling */
-   SCIP_SDPPAR_SCALEOBJ       = 16      /**< whether the objective should be scaled */
+   SCIP_SDPPAR_SCALEOBJ       = 16,     /**< whether the objective should be scaled */
+   SCIP_SDPPAR_MAXITER        = 17      /**< maximal number of iterations of the SDP-solver, not supported by all solvers (-1 = solver default) */
 };
 typedef enum SCIP_SDPParam SCIP_SDPPARAM;
 